@@ -14,6 +14,7 @@
 
 #include "s3d/core.h"
 #include "s3d/engine_object.h"
+#include "s3d/profiler.h"
 #include "s3d/ui/colors.h"
 #include "s3d/ui/button.h"
 #include "s3d/ui/label.h"
@@ -25,6 +26,7 @@
 #include "obj/gameboard.h"
 #include "obj/player.h"
 #include "obj/ai.h"
+#include "obj/solver.h"
 
 
 static Texture * bgImage = NULL;
@@ -76,17 +78,19 @@ static void nextGame(void * sender, const void * evt) {
     }
 }
 
-static void initGame(size_t w, size_t h, size_t size, size_t count) {
+static void initGame(size_t w, size_t h, size_t size, Rules rules) {
     game = SceneData_create();
     assert(game != NULL);
 
     if(bgImage != NULL) {
         Image * img = Image_create(0, 0, w, h, bgImage);
-        E_Obj_insertToList(game->gameData, (E_Obj*) img);
+        E_Obj_insertToScene(game, (E_Obj*) img);
+        Profiler_setName(img, "background");
     }
 
-    board = GameBoard_create((w - size)/2, (h - size) * 0.8, size, count, gameEnd);
-    E_Obj_insertToList(game->gameData, (E_Obj*) board);
+    board = GameBoard_create((w - size)/2, (h - size) * 0.8, size, rules, gameEnd);
+    E_Obj_insertToScene(game, (E_Obj*) board);
+    Profiler_setName(board, "board");
 
     Player * p1 = Player_create("Player1", 0, timeOut);
     Player * p2 = Player_create("Player2", 0, timeOut);
@@ -100,7 +104,8 @@ static void initGame(size_t w, size_t h, size_t size, size_t count) {
     panelGameOver = Panel_create((w - 360)/2, (h - 360)/2, 360, 300);
     panelGameOver->background = COLOR_CHANGE_OPACITY(UI_PANEL_BG_COLOR, 0.8);
     panelGameOver->events.visible = false;
-    E_Obj_insertToList(game->gameData, (E_Obj*) panelGameOver);
+    E_Obj_insertToScene(game, (E_Obj*) panelGameOver);
+    Profiler_setName(panelGameOver, "game over panel");
 
     Label * label = Label_create(panelGameOver->width/2, 50, "Game Over");
     label->foreground = COLOR_WHITE;
@@ -128,25 +133,29 @@ static TextField * name2;
 static CheckBox * ai1;
 static CheckBox * ai2;
 
-#define AI_SEARCH_DEPTH 3
+#define AI_SEARCH_DEPTH 8
+#define AI_TIME_LIMIT (PLAYER_TIME_PER_TURN * 0.5)
+#define AI_SOLVER_NODE_LIMIT 20000
 
 static void startGame(void * sender, const void * evt) {
     if(!Player_setName(board->player1, name1->text)) return;
     if(!Player_setName(board->player2, name2->text)) return;
 
     if(ai1->value) {
-        AI * ai = AI_create(AI_SEARCH_DEPTH);
+        AI * ai = AI_create(AI_SEARCH_DEPTH, AI_DEFAULT_EVAL_CACHE_SIZE);
+        AI_setSolver(ai, SOLVER_DEFAULT_TABLE_SIZE, AI_SOLVER_NODE_LIMIT);
+        AI_setTimeLimit(ai, AI_TIME_LIMIT);
         Player_setAI(board->player1, ai);
     } else {
-        if(board->player1->ai) AI_destruct(board->player1->ai);
         Player_setAI(board->player1, NULL);
     }
 
     if(ai2->value) {
-        AI * ai = AI_create(AI_SEARCH_DEPTH);
+        AI * ai = AI_create(AI_SEARCH_DEPTH, AI_DEFAULT_EVAL_CACHE_SIZE);
+        AI_setSolver(ai, SOLVER_DEFAULT_TABLE_SIZE, AI_SOLVER_NODE_LIMIT);
+        AI_setTimeLimit(ai, AI_TIME_LIMIT);
         Player_setAI(board->player2, ai);
     } else {
-        if(board->player2->ai) AI_destruct(board->player2->ai);
         Player_setAI(board->player2, NULL);
     }
 
@@ -159,12 +168,14 @@ static void initMainMenu(size_t w, size_t h) {
 
     if(bgImage != NULL) {
         Image * img = Image_create(0, 0, w, h, bgImage);
-        E_Obj_insertToList(mainMenu->gameData, (E_Obj*) img);
+        E_Obj_insertToScene(mainMenu, (E_Obj*) img);
+        Profiler_setName(img, "background");
     }
 
     Panel * panel = Panel_create((w - 500)/2, (h - 380)/2, 500, 380);
     panel->background = COLOR_CHANGE_OPACITY(panel->background, 0.95);
-    E_Obj_insertToList(mainMenu->gameData, (E_Obj*) panel);
+    E_Obj_insertToScene(mainMenu, (E_Obj*) panel);
+    Profiler_setName(panel, "menu panel");
 
     Label * label = Label_create(30, 80, "Player 1 name:");
     Panel_insertChild(panel, (E_Obj*) label);
@@ -198,7 +209,7 @@ int main(int argc, char **argv) {
     CORE_init(argc, argv, &core);
 
     CORE_loadTexture("data/img.bmp", &bgImage, true);
-    initGame(core.window_width, core.window_height, 650, 20);
+    initGame(core.window_width, core.window_height, 650, (Rules){20, 20, 5});
     initMainMenu(core.window_width, core.window_height);
 
     CORE_setSceneData(mainMenu);    
@@ -1,8 +1,15 @@
- #include "ai.h"
+#define _POSIX_C_SOURCE 200809L
+
+#include "ai.h"
 
 
 #include <stdlib.h>
+#include <string.h>
 #include <limits.h>
+#include <time.h>
+#include "solver.h"
+#include "zobrist.h"
+#include "evalcache.h"
 
 #define MAX(a, b) ({ __typeof__ (a) _a = (a); __typeof__ (b) _b = (b); _a > _b ? _a : _b; })
 #define MIN(a, b) ({ __typeof__ (a) _a = (a); __typeof__ (b) _b = (b); _a < _b ? _a : _b; })
@@ -10,68 +17,179 @@
 
 #define NODE_BUFFER_SIZE 128
 
+//selective search
+#define LMR_FULL_MOVES 3        /** moves searched to full depth before reductions */
+#define LMR_LATE_MOVES 8        /** moves reduced by one more ply from this one */
+#define LMR_VERY_LATE_MOVES 16  /** and again from this one */
+#define LMR_MIN_DEPTH 3         /** reduce only nodes with at least this remaining depth */
+#define ABORT_CHECK_MASK 0xFF   /** check time every 256 nodes */
+
+//salts of evaluation cache keys, score depends on side to move and side of AI
+#define EVAL_TURN_O_KEY 0x6A09E667F3BCC909ULL
+#define EVAL_AI_O_KEY 0xBB67AE8584CAA73BULL
+
 
 typedef struct {
     Node data[NODE_BUFFER_SIZE];
     unsigned int count;
 } Nodes;
 
+typedef enum {
+    THREAT_NONE, THREAT_THREE, THREAT_FOUR, THREAT_FIVE
+} Threat;
+
+//class of move from orderMoves, quiet moves are ordered by potential of lines
+#define ORDER_CLASS(key) ((key) >> 16)
+#define CLASS_OWN_THREE (2 * THREAT_THREE + 1)
+#define CLASS_OWN_FOUR (2 * THREAT_FOUR + 1)
+#define CLASS_BLOCK_FIVE (2 * THREAT_FIVE)
+#define CLASS_QUIET (2 * THREAT_THREE)      /** moves up to block of three may be reduced */
+
+static const int THREAT_DIRECTIONS[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+
+struct _AI_Kernel {
+    void (*getPosibleMoves)(Nodes * nodes, AI * ai);
+    Node (*checkForWin)(AI * ai);
+    int (*evaluate)(AI * ai, Symbol turnNow);
+    Threat (*threat)(AI * ai, Node node, Symbol symbol, int * potential);
+};
+
+typedef struct _AI_Kernel AI_Kernel;
+
+#ifdef AI_STATS
+#define STAT(expr) (expr)
+#define LINE_SIZE AI_PV_MAX_LENGTH
+#else
+#define STAT(expr)
+#define LINE_SIZE 1
+#endif
+
+//principal variation below node
+typedef struct {
+    Node data[LINE_SIZE];
+    unsigned int count;
+} Line;
+
 
-static int alphabeta(AI * ai, Node node, unsigned int depth,
-                     int alpha, int beta, Symbol turnNow);
+static Node search(AI * ai);
 
-static void getPosibleMoves(Nodes * nodes, AI * ai);
+static Node searchRoot(AI * ai, Nodes * nodes, unsigned int depth);
 
-static Node checkForWin(AI * ai);
+static int alphabeta(AI * ai, Node node, unsigned int depth, unsigned int ply,
+                     int alpha, int beta, Symbol turnNow, Line * pv);
+
+static void orderMoves(AI * ai, Nodes * nodes, Symbol turn, int * keys);
 
 static int evaluate(AI * ai, Symbol turnNow);
 
-static int evaluateNode(AI * ai, Node node, Symbol turnNow);
+static Node randomMove(AI * ai);
+
+static const AI_Kernel * selectKernel(Rules rules);
+
+static double currentTime(void);
+
+#ifdef AI_STATS
+static void appendLine(Line * pv, Node node, const Line * line);
+#endif
 
 
 
-AI * AI_create(unsigned int search_depth) {
+AI * AI_create(unsigned int search_depth, unsigned int eval_cache_size) {
     if(search_depth == 0) return NULL;
 
     AI * ai = malloc(sizeof(AI));
     if(ai == NULL) return NULL;
 
+    ai->eval_cache = NULL;
+    if(eval_cache_size > 0) {
+        ai->eval_cache = EvalCache_create(eval_cache_size);
+        if(ai->eval_cache == NULL) {
+            free(ai);
+            return NULL;
+        }
+    }
+    ai->hash = 0;
+    ai->eval_probes = 0;
+    ai->eval_hits = 0;
+
     ai->gameData = NULL;
-    ai->cell_count = 0;
+    ai->rules = (Rules){0, 0, 0};
+    ai->kernel = NULL;
     ai->search_depth = search_depth;
     ai->symbol = Symbol_None;
     ai->values = NULL;
+    ai->solver = NULL;
+    ai->solver_node_limit = 0;
+    ai->reductions = true;
+    ai->extensions = true;
+    ai->time_limit = 0.0;
+    ai->iteration = 0;
+    ai->visited = 0;
+    ai->deadline = 0.0;
+    ai->aborted = false;
+#ifdef AI_STATS
+    memset(&ai->stats, 0, sizeof(AI_Stats));
+#endif
 
     return ai;
 }
 
+bool AI_setSolver(AI * ai, unsigned int table_size, unsigned long node_limit) {
+    if(ai == NULL) return false;
+
+    if(ai->solver) {
+        Solver_destruct(ai->solver);
+        ai->solver = NULL;
+    }
+    if(table_size == 0) return true;
+
+    ai->solver = Solver_create(table_size);
+    ai->solver_node_limit = node_limit;
+    return ai->solver != NULL;
+}
+
+void AI_setSelectiveSearch(AI * ai, bool reductions, bool extensions) {
+    if(ai == NULL) return;
+    ai->reductions = reductions;
+    ai->extensions = extensions;
+}
+
+void AI_setTimeLimit(AI * ai, double seconds) {
+    if(ai == NULL) return;
+    ai->time_limit = MAX(seconds, 0.0);
+}
+
 void AI_destruct(AI * ai) {
     if(ai != NULL) {
         if(ai->gameData) free(ai->gameData);
         if(ai->values) free(ai->values);
+        if(ai->solver) Solver_destruct(ai->solver);
+        if(ai->eval_cache) EvalCache_destruct(ai->eval_cache);
         free(ai);
     }
 }
 
-void AI_refeshGameData(AI * ai, Cell * cells, unsigned int count, Symbol symbol) {
-    if(ai == NULL || cells == NULL || count == 0 || symbol == Symbol_None) return;
+void AI_refeshGameData(AI * ai, Cell * cells, Rules rules, Symbol symbol) {
+    if(ai == NULL || cells == NULL || !Rules_valid(rules) || symbol == Symbol_None) return;
 
-    if(ai->gameData == NULL) {
-        ai->gameData = malloc(sizeof(Symbol) * count * count);
-        ai->values = malloc(sizeof(int) * count * count);
-    } else if(ai->cell_count != count) {
-        Symbol * newData = realloc(ai->gameData, sizeof(Symbol) * count * count);
+    unsigned int size = rules.width * rules.height;
+    if(ai->gameData == NULL || ai->rules.width * ai->rules.height != size) {
+        Symbol * newData = realloc(ai->gameData, sizeof(Symbol) * size);
         if(newData == NULL) return;
         ai->gameData = newData;
-        int * newValues = malloc(sizeof(int) * count * count);
+        int * newValues = realloc(ai->values, sizeof(int) * size);
         if(newValues == NULL) return;
         ai->values = newValues;
     }
 
-    ai->cell_count = count;
+    if(ai->kernel == NULL || !Rules_equal(ai->rules, rules)) {
+        ai->kernel = selectKernel(rules);
+        EvalCache_clear(ai->eval_cache);
+    }
+    ai->rules = rules;
     ai->symbol = symbol;
 
-    for(unsigned int i = 0; i < ai->cell_count * ai->cell_count; ++i) {
+    for(unsigned int i = 0; i < size; ++i) {
         ai->gameData[i] = cells[i].symbol;
     }
 }
@@ -81,297 +199,416 @@ void AI_refeshGameData(AI * ai, Cell * cells, unsigned int count, Symbol symbol)
 //###############################################################################################
 
 Node AI_doTurn(AI * ai) {
-    if(ai == NULL) return (Node){.x = -1, .y = -1};
+    if(ai == NULL || ai->kernel == NULL) return (Node){.x = -1, .y = -1};
 
-    int max = INT_MIN;
-    int value;
-    Node best = {.x = -1, .y = -1};
-    Node node;
+#ifdef AI_STATS
+    memset(&ai->stats, 0, sizeof(AI_Stats));
+    double start = currentTime();
+    Node best = search(ai);
+    ai->stats.time = currentTime() - start;
+    return best;
+#else
+    return search(ai);
+#endif
+}
+
+double AI_getEvalCacheHitRate(const AI * ai) {
+    if(ai == NULL || ai->eval_probes == 0) return 0.0;
+    return (double) ai->eval_hits / ai->eval_probes;
+}
+
+const AI_Stats * AI_getStats(const AI * ai) {
+#ifdef AI_STATS
+    return ai != NULL ? &ai->stats : NULL;
+#else
+    (void) ai;
+    return NULL;
+#endif
+}
 
-    Node win = checkForWin(ai);
+void AI_Stats_writeJSON(const AI_Stats * stats, FILE * file) {
+    if(stats == NULL || file == NULL) return;
+
+    fprintf(file, "{\"nodes\":%lu,\"evaluations\":%lu,\"eval_hits\":%lu,\"cutoffs\":%lu,\"first_cutoffs\":%lu,\"researches\":%lu,"
+            "\"tt_probes\":%lu,\"tt_hits\":%lu,\"solver_nodes\":%lu,\"max_depth\":%u,"
+            "\"time\":%.6f,\"score\":%d,\"depths\":[",
+            stats->nodes, stats->evaluations, stats->eval_hits, stats->cutoffs, stats->first_cutoffs, stats->researches,
+            stats->tt_probes, stats->tt_hits, stats->solver_nodes, stats->max_depth,
+            stats->time, stats->score);
+    for(unsigned int i = 0; i < stats->depth_count; ++i) {
+        fprintf(file, "%s{\"depth\":%u,\"nodes\":%lu,\"time\":%.6f,\"branching\":%.3f}",
+                i ? "," : "", i + 1, stats->depth_nodes[i], stats->depth_time[i], stats->depth_branching[i]);
+    }
+    fprintf(file, "],\"pv\":[");
+    for(unsigned int i = 0; i < stats->pv_length; ++i) {
+        fprintf(file, "%s[%d,%d]", i ? "," : "", stats->pv[i].x, stats->pv[i].y);
+    }
+    fprintf(file, "]}");
+}
+
+static Node search(AI * ai) {
+    Node win = ai->kernel->checkForWin(ai);
     if(win.x >= 0 && win.y >= 0) {
+        STAT(ai->stats.pv[0] = win);
+        STAT(ai->stats.pv_length = 1);
         return win;
     }
 
+    //forced win by threats
+    if(ai->solver != NULL) {
+        if(Solver_isSharp(ai->solver, ai->gameData, ai->rules, ai->symbol)) {
+            Solver_Solution solution;
+            Solver_solve(ai->solver, ai->gameData, ai->rules, ai->symbol,
+                         ai->solver_node_limit, &solution);
+#ifdef AI_STATS
+            ai->stats.solver_nodes = solution.nodes;
+            ai->stats.tt_probes = solution.probes;
+            ai->stats.tt_hits = solution.hits;
+#endif
+            if(solution.result == Solver_Win && solution.line_length > 0) {
+#ifdef AI_STATS
+                ai->stats.pv_length = MIN(solution.line_length, (unsigned int) AI_PV_MAX_LENGTH);
+                memcpy(ai->stats.pv, solution.line, sizeof(Node) * ai->stats.pv_length);
+#endif
+                return solution.line[0];
+            }
+        }
+    }
+
+    //iterative deepening, result of the deepest finished iteration is played
     Nodes nodes;
-    getPosibleMoves(&nodes, ai);
-    for(int i = 0; i < (int) nodes.count; ++i) {
-        node = nodes.data[i];
-        value = alphabeta(ai, nodes.data[i], ai->search_depth - 1, INT_MIN, INT_MAX, ai->symbol);
-        if(value > max) {
+    Node best = {.x = -1, .y = -1};
+    int keys[NODE_BUFFER_SIZE];
+    double start = currentTime();
+    ai->deadline = start + ai->time_limit;
+    ai->aborted = false;
+    ai->visited = 0;
+    ai->hash = Zobrist_hash(ai->gameData, ai->rules.width * ai->rules.height);
+    ai->kernel->getPosibleMoves(&nodes, ai);
+    orderMoves(ai, &nodes, ai->symbol, keys);
+
+    //shallow iterations only pay off for time limit and per depth statistics
+    unsigned int first = 1;
+#ifndef AI_STATS
+    if(ai->time_limit <= 0.0) first = ai->search_depth;
+#endif
+    for(unsigned int depth = first; depth <= ai->search_depth; ++depth) {
+        Node node = searchRoot(ai, &nodes, depth);
+        if(ai->aborted) break;
+        best = node;
+
+        //next iteration takes several times longer than all previous
+        if(ai->time_limit > 0.0 && (currentTime() - start) * 2.0 > ai->time_limit) break;
+    }
+
+    return best;
+}
+
+static Node searchRoot(AI * ai, Nodes * nodes, unsigned int depth) {
+    int max = INT_MIN;
+    int value;
+    Node best = {.x = -1, .y = -1};
+    Node node;
+    Line line;
+
+#ifdef AI_STATS
+    Line pv = {.count = 0};
+    unsigned long start_nodes = ai->stats.nodes;
+    double start = currentTime();
+#endif
+
+    ai->iteration = depth;
+
+    for(unsigned int i = 0; i < nodes->count; ++i) {
+        node = nodes->data[i];
+        line.count = 0;
+        value = alphabeta(ai, node, depth - 1, 1, max, INT_MAX, ai->symbol, &line);
+        if(ai->aborted) return best;
+        if(value > max || i == 0) {
             max = value;
             best = node;
+            STAT(appendLine(&pv, node, &line));
+
+            //best move first in next iteration
+            memmove(nodes->data + 1, nodes->data, sizeof(Node) * i);
+            nodes->data[0] = node;
         }
     }
 
+#ifdef AI_STATS
+    AI_Stats * stats = &ai->stats;
+    if(depth <= AI_STATS_MAX_DEPTH) {
+        unsigned int i = depth - 1;
+        stats->depth_nodes[i] = stats->nodes - start_nodes;
+        stats->depth_time[i] = currentTime() - start;
+        stats->depth_branching[i] = i == 0 || stats->depth_nodes[i - 1] == 0 ?
+                    (double) stats->depth_nodes[i] :
+                    (double) stats->depth_nodes[i] / stats->depth_nodes[i - 1];
+        stats->depth_count = depth;
+    }
+    stats->score = max;
+    stats->pv_length = pv.count;
+    memcpy(stats->pv, pv.data, sizeof(Node) * pv.count);
+#endif
+
     return best;
 }
 
-static int alphabeta(AI * ai, Node node, unsigned int depth,
-                     int alpha, int beta, Symbol turnNow) {
+static int alphabeta(AI * ai, Node node, unsigned int depth, unsigned int ply,
+                     int alpha, int beta, Symbol turnNow, Line * pv) {
 
-    int index = node.x + node.y * ai->cell_count;
+    int index = node.x + node.y * ai->rules.width;
+    uint64_t key = Zobrist_key(index, turnNow);
     ai->gameData[index] = turnNow;
+    ai->hash ^= key;
+
+#ifdef AI_STATS
+    ++ai->stats.nodes;
+    ai->stats.max_depth = MAX(ai->stats.max_depth, ply);
+#else
+    (void) pv;
+#endif
+
+    //out of time, first iteration always finishes
+    if((++ai->visited & ABORT_CHECK_MASK) == 0 && ai->time_limit > 0.0 &&
+            ai->iteration > 1 && currentTime() > ai->deadline) {
+        ai->aborted = true;
+    }
+    if(ai->aborted) {
+        ai->gameData[index] = Symbol_None;
+        ai->hash ^= key;
+        return 0;
+    }
 
     Nodes nodes;
-    getPosibleMoves(&nodes, ai);
+    if(depth > 0) ai->kernel->getPosibleMoves(&nodes, ai);
 
     if(depth <= 0 || nodes.count == 0) {
         int value = evaluate(ai, turnNow);
         ai->gameData[index] = Symbol_None;
+        ai->hash ^= key;
         return value;
-    } else if(turnNow == ai->symbol) {
-        //AI
-        int value = INT_MAX;
-        Symbol next_turn = OPPOSITE(turnNow);
+    }
 
-        for(unsigned int i = 0; i < nodes.count; ++i) {
-            value = MIN(value, alphabeta(ai, nodes.data[i], depth - 1, alpha, beta, next_turn));
-            beta = MIN(beta, value);
-            if(beta <= alpha) {
-                break;
-            }
-        }
+    Symbol next_turn = OPPOSITE(turnNow);
+    int keys[NODE_BUFFER_SIZE];
+    orderMoves(ai, &nodes, next_turn, keys);
 
-        ai->gameData[index] = Symbol_None;
-        return value;
-    } else {
-        //opponent
-        int value = INT_MIN;
-        Symbol next_turn = OPPOSITE(turnNow);
+    //threat of five has to be blocked, other moves lose
+    if(ORDER_CLASS(keys[0]) >= CLASS_BLOCK_FIVE) {
+        while(ORDER_CLASS(keys[nodes.count - 1]) < CLASS_BLOCK_FIVE) --nodes.count;
+    }
 
-        for(unsigned int i = 0; i < nodes.count; ++i) {
-            value = MAX(value, alphabeta(ai, nodes.data[i], depth - 1, alpha, beta, next_turn));
-            alpha = MAX(alpha, value);
-            if(alpha >= beta) {
-                break;
+    //AI moved -> opponent minimizes
+    bool minimize = turnNow == ai->symbol;
+    int value = minimize ? INT_MAX : INT_MIN;
+    Line line;
+    int child;
+    unsigned int child_depth, reduced_depth, reduction;
+    int class;
+
+    for(unsigned int i = 0; i < nodes.count; ++i) {
+        child_depth = depth - 1;
+        reduced_depth = child_depth;
+        class = ORDER_CLASS(keys[i]);
+        if(ai->extensions && class >= CLASS_OWN_THREE && (class & 1) &&
+                (class >= CLASS_OWN_FOUR || child_depth == 0) &&
+                ply + depth < ai->iteration + ai->iteration / 2) {
+            //forcing move, open three only at horizon, at most half of iteration depth is added to one line
+            reduced_depth = ++child_depth;
+        } else if(ai->reductions && class <= CLASS_QUIET && i >= LMR_FULL_MOVES && depth >= LMR_MIN_DEPTH) {
+            //late quiet move
+            reduction = 1 + (i >= LMR_LATE_MOVES) + (i >= LMR_VERY_LATE_MOVES);
+            reduced_depth = child_depth - MIN(reduction, child_depth);
+        }
+
+        line.count = 0;
+        if(i == 0) {
+            child = alphabeta(ai, nodes.data[i], child_depth, ply + 1, alpha, beta, next_turn, &line);
+        } else {
+            //later moves are only proved worse with null window
+            int null_alpha = minimize ? beta - 1 : alpha;
+            int null_beta = minimize ? beta : alpha + 1;
+            child = alphabeta(ai, nodes.data[i], reduced_depth, ply + 1, null_alpha, null_beta, next_turn, &line);
+            if(reduced_depth < child_depth && (minimize ? child < beta : child > alpha) && !ai->aborted) {
+                //reduced move improves the bound, search it to full depth
+                STAT(++ai->stats.researches);
+                line.count = 0;
+                child = alphabeta(ai, nodes.data[i], child_depth, ply + 1, null_alpha, null_beta, next_turn, &line);
+            }
+            if(child > alpha && child < beta && !ai->aborted) {
+                line.count = 0;
+                child = alphabeta(ai, nodes.data[i], child_depth, ply + 1, alpha, beta, next_turn, &line);
             }
         }
+        if(ai->aborted) break;
 
-        ai->gameData[index] = Symbol_None;
-        return value;
+        if(minimize ? child < value : child > value) {
+            value = child;
+            STAT(appendLine(pv, nodes.data[i], &line));
+        }
+        if(minimize) {
+            beta = MIN(beta, value);
+        } else {
+            alpha = MAX(alpha, value);
+        }
+        if(alpha >= beta) {
+            STAT(++ai->stats.cutoffs);
+            STAT(ai->stats.first_cutoffs += i == 0);
+            break;
+        }
     }
+
+    ai->gameData[index] = Symbol_None;
+    ai->hash ^= key;
+    return value;
 }
 
-#define SEARCH_RANGE 1
+static int evaluate(AI * ai, Symbol turnNow) {
+    STAT(++ai->stats.evaluations);
+    if(ai->eval_cache == NULL) return ai->kernel->evaluate(ai, turnNow);
 
-static void getPosibleMoves(Nodes * nodes, AI * ai) {
-    nodes->count = 0;
-
-    int x, y;
-    int i, j;
-    bool add;
-
-    for(x = 0; x < (int) ai->cell_count; ++x) {
-        for(y = 0; y < (int) ai->cell_count; ++y) {
-            if(ai->gameData[x + y * ai->cell_count] == Symbol_None) {
-                add = false;
-                for(i = -SEARCH_RANGE; i <= SEARCH_RANGE; ++i) {
-                    if(x + i < 0) continue;
-                    if(x + i >= (int) ai->cell_count) break;
-                    for(j = -SEARCH_RANGE; j <= SEARCH_RANGE; ++j) {
-                        if(y + j < 0) continue;
-                        if(y + j >= (int) ai->cell_count) break;
-                        if(ai->gameData[x + i + (y + j) * ai->cell_count] != Symbol_None) {
-                            add = true;
-                            goto ADD;
-                        }
-                    }
-                }
-ADD:
-                if(add) {
-                    if(nodes->count < NODE_BUFFER_SIZE) {
-                        nodes->data[nodes->count].x = x;
-                        nodes->data[nodes->count].y = y;
-                        ++nodes->count;
-                    } else {
-                        return;
-                    }
-                }
-            }
-        }
+    uint64_t key = ai->hash ^ (turnNow == Symbol_O ? EVAL_TURN_O_KEY : 0) ^
+            (ai->symbol == Symbol_O ? EVAL_AI_O_KEY : 0);
+    int value;
+    ++ai->eval_probes;
+    if(EvalCache_probe(ai->eval_cache, key, &value)) {
+        ++ai->eval_hits;
+        STAT(++ai->stats.eval_hits);
+        return value;
     }
 
-    if(nodes->count == 0) {
-        int range = ai->cell_count / 4;
-        range = range % 2 != 0 ? range + 1 : range;
-        srand(time(0));
-        int x = ai->cell_count / 2 + (rand() % range - range / 2);
-        srand(time(0));
-        int y = ai->cell_count / 2 + (rand() % range - range / 2);
-        x = x % ai->cell_count;
-        y = y % ai->cell_count;
-        nodes->data[0].x = x;
-        nodes->data[0].y = y;
-        nodes->count = 1;
-    }
+    value = ai->kernel->evaluate(ai, turnNow);
+    EvalCache_store(ai->eval_cache, key, value);
+    return value;
 }
 
-static Node checkForWin(AI * ai) {
-
-    int x, y;
-    int dx, dy;
-    int offset;
-    int gap_index;
-    int nx, ny;
-    Symbol s;
-
-    for(x = 0; x < (int) ai->cell_count; ++x) {
-        for(y = 0; y < (int) ai->cell_count; ++y) {
-            if(ai->gameData[x + y * ai->cell_count] != ai->symbol) continue;
-
-            for(dx = -1; dx <= 1; ++dx) {
-                for(dy = -1; dy <= 1; ++dy) {
-                    if(dx == 0 && dy == 0) continue;
-                    gap_index = -1;
-                    for(offset = 1; offset < 5; ++offset) {
-                        nx = x + offset * dx;
-                        ny = y + offset * dy;
-
-                        if(nx < 0 || nx >= (int) ai->cell_count) break;
-                        if(ny < 0 || ny >= (int) ai->cell_count) break;
-
-                        s = ai->gameData[nx + ny * ai->cell_count];
-                        if(s == Symbol_None) {
-                            if(gap_index >= 0) break;
-                            gap_index = offset;
-                        } else if (s != ai->symbol) {
-                            break;
-                        }
-                    }
-                    if(gap_index >= 0 && offset == 5) return (Node){.x=x+gap_index*dx, .y=y+gap_index*dy};
-                }
-            }
-
+/**
+ * Sort moves, forcing moves are searched first:
+ * own five > block of five > own four > block of four > own open three > block of three > quiet.
+ * Class of move is 2 * threat + 1 for own threat and 2 * threat for blocking one, moves of
+ * same class are sorted by potential of lines of both sides.
+ */
+static void orderMoves(AI * ai, Nodes * nodes, Symbol turn, int * keys) {
+    Node node;
+    int class, key;
+    int own, opponent;
+    unsigned int i, j;
+
+    for(i = 0; i < nodes->count; ++i) {
+        node = nodes->data[i];
+        class = MAX(2 * (int) ai->kernel->threat(ai, node, turn, &own) + 1,
+                    2 * (int) ai->kernel->threat(ai, node, OPPOSITE(turn), &opponent));
+        if(class == 1) class = 0;
+        key = (class << 16) + own + opponent;
+
+        //insertion sort, stable for equal keys
+        for(j = i; j > 0 && keys[j - 1] < key; --j) {
+            keys[j] = keys[j - 1];
+            nodes->data[j] = nodes->data[j - 1];
         }
+        keys[j] = key;
+        nodes->data[j] = node;
     }
-
-    return (Node){.x=-1, .y=-1};
 }
 
+#define SEARCH_RANGE 1
 
-#define ABS(val) (val < 0 ? val * -1 : val)
-
-static int evaluate(AI * ai, Symbol turnNow) {
-    int value = 0;
+static Node randomMove(AI * ai) {
+    int range_x = ai->rules.width / 4;
+    int range_y = ai->rules.height / 4;
+    range_x = range_x % 2 != 0 ? range_x + 1 : range_x;
+    range_y = range_y % 2 != 0 ? range_y + 1 : range_y;
+    srand(time(0));
+    int x = ai->rules.width / 2 + (range_x > 0 ? rand() % range_x - range_x / 2 : 0);
+    srand(time(0));
+    int y = ai->rules.height / 2 + (range_y > 0 ? rand() % range_y - range_y / 2 : 0);
+    return (Node){.x = x % ai->rules.width, .y = y % ai->rules.height};
+}
 
-    //evalueate all cells
-    Node node;
-    int current;
-    for(unsigned int x = 0; x < ai->cell_count; ++x) {
-        for(unsigned int y = 0; y < ai->cell_count; ++y) {
-            node.x = x;
-            node.y = y;
-            current = evaluateNode(ai, node, turnNow);
-            ai->values[x + y * ai->cell_count] = current;
-            value += current;
-        }
-    }
+static double currentTime(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
 
-    return value;
+#ifdef AI_STATS
+static void appendLine(Line * pv, Node node, const Line * line) {
+    pv->data[0] = node;
+    pv->count = MIN(line->count + 1, (unsigned int) LINE_SIZE);
+    memcpy(pv->data + 1, line->data, sizeof(Node) * (pv->count - 1));
 }
+#endif
 
 typedef enum {
-    FIVE = 1000000,
+    WIN = 1000000,
     FOUR = 5000,
     FOUR_BLOCKED = 1000,
     THREE = 500,
     THREE_BLOCKED = 200,
     TWO = 100,
-    TWO_BLOCKED = 20
+    TWO_BLOCKED = 20,
+    ONE = 20,
+    ONE_BLOCKED = 4
 } Score;
 
-static int OPEN_SCORE[3] = {TWO, THREE, FOUR};
-static int BLOCKED_SCORE[3] = {TWO_BLOCKED, THREE_BLOCKED, FOUR_BLOCKED};
+//indexed by number of symbols missing to win line
+static int OPEN_SCORE[RULES_MAX_WIN_LENGTH - 1] = {0, FOUR, THREE, TWO, ONE};
+static int BLOCKED_SCORE[RULES_MAX_WIN_LENGTH - 1] = {0, FOUR_BLOCKED, THREE_BLOCKED, TWO_BLOCKED, ONE_BLOCKED};
 
 #define EVAL_MAX_GAPS 1
 #define SIGN(val) ((0 < val) - (val < 0))
 
-static int evaluateNode(AI * ai, Node node, Symbol turnNow) {
-
-    Symbol origin = ai->gameData[node.x + node.y * ai->cell_count];
-    if(origin == Symbol_None) return 0;
-
-    int value = 0;
-
-    int offset;
-    int cnt;
-    int gaps;
-    int x, y;
-    int dx, dy;
-    Symbol current;
-
-    for(dx = -1; dx <= 1; ++dx) {
-        for(dy = -1; dy <= 1; ++dy) {
-            if(dx == 0 && dy == 0) continue;
-
-            //process symbols
-            for(offset = 0, cnt = 0, gaps = 0; offset < 5; ++offset) {
-                x = node.x + offset * dx;
-                y = node.y + offset * dy;
-
-                if(x < 0 || y < 0) break;
-                if(x >= (int) ai->cell_count || y >= (int) ai->cell_count) break;
-
-                current = ai->gameData[x + y * ai->cell_count];
-                if(current == origin) {
-                    if(gaps > EVAL_MAX_GAPS) break;
-                    ++cnt;
-                } else if(current == Symbol_None) {
-                    ++gaps;
-                } else {
-                    break;
-                }
-            }
-
-            //add score
-            if(cnt < 2) continue;
 
-            int sign = 1;
-            if(turnNow == Symbol_None) {
-                sign = ai->symbol == origin ? 1 : -1;
-            } else if(turnNow == ai->symbol) {
-                sign = ai->symbol == origin ? 1 : -2;
-            } else {
-                sign = ai->symbol == origin ? 2 : -1;
-            }
-
-            if(cnt == 5) {
-                value += FIVE * sign;
-            } else {
-                if(offset != 5) {
-                    //blocked from end side
-                    x = node.x - dx;
-                    y = node.y - dy;
-                    if(x >= 0 && x < (int) ai->cell_count && y >= 0 && y < (int) ai->cell_count) {
-                        current = ai->gameData[x + y * ai->cell_count];
-                        if(current != OPPOSITE(origin)) {
-                            //add only if not blocked from start
-                            value += BLOCKED_SCORE[cnt - 2] * sign;
-                        }
-                    }
-                } else {
-                    //opened from end side
-                    x = node.x - dx;
-                    y = node.y - dy;
-                    if(x >= 0 && x < (int) ai->cell_count && y >= 0 && y < (int) ai->cell_count) {
-                        current = ai->gameData[x + y * ai->cell_count];
-                        if(current != OPPOSITE(origin)) {
-                            //opened from both sides
-                            value += OPEN_SCORE[cnt - 2] * sign;
-                        } else {
-                            //blocked from beginning
-                            value += BLOCKED_SCORE[cnt - 2] * sign;
-                        }
-                    } else {
-                        //blocked from beginning
-                        value += BLOCKED_SCORE[cnt - 2] * sign;
-                    }
-                }
-            }
-
-        }
+//generic kernel
+#define KERNEL(name) name##_generic
+#define K_WIDTH ((int) ai->rules.width)
+#define K_HEIGHT ((int) ai->rules.height)
+#define K_WIN ((int) ai->rules.win_length)
+#include "ai_kernel.h"
+
+//3x3, k = 3
+#define KERNEL(name) name##_3x3x3
+#define K_WIDTH 3
+#define K_HEIGHT 3
+#define K_WIN 3
+#include "ai_kernel.h"
+
+//15x15, k = 5
+#define KERNEL(name) name##_15x15x5
+#define K_WIDTH 15
+#define K_HEIGHT 15
+#define K_WIN 5
+#include "ai_kernel.h"
+
+//19x19, k = 5
+#define KERNEL(name) name##_19x19x5
+#define K_WIDTH 19
+#define K_HEIGHT 19
+#define K_WIN 5
+#include "ai_kernel.h"
+
+//20x20, k = 5 (default board of the game)
+#define KERNEL(name) name##_20x20x5
+#define K_WIDTH 20
+#define K_HEIGHT 20
+#define K_WIN 5
+#include "ai_kernel.h"
+
+
+static const struct {
+    Rules rules;
+    const AI_Kernel * kernel;
+} KERNELS[] = {
+    {{3, 3, 3}, &kernel_3x3x3},
+    {{15, 15, 5}, &kernel_15x15x5},
+    {{19, 19, 5}, &kernel_19x19x5},
+    {{20, 20, 5}, &kernel_20x20x5}
+};
+
+static const AI_Kernel * selectKernel(Rules rules) {
+    for(unsigned int i = 0; i < sizeof(KERNELS) / sizeof(KERNELS[0]); ++i) {
+        if(Rules_equal(KERNELS[i].rules, rules)) return KERNELS[i].kernel;
     }
-
-    return value;
+    return &kernel_generic;
 }
@@ -1,28 +1,124 @@
 #ifndef AI_H
 #define AI_H
 
+#include <stdio.h>
+#include <stdint.h>
 #include "cell.h"
+#include "rules.h"
+
+//search statistics, build with AI_NO_STATS defined to compile them out
+#ifndef AI_NO_STATS
+#define AI_STATS
+#endif
+
+#define AI_DEFAULT_EVAL_CACHE_SIZE (1 << 16)
+
+#define AI_STATS_MAX_DEPTH 32
+#define AI_PV_MAX_LENGTH AI_STATS_MAX_DEPTH
 
 typedef struct {
     int x;
     int y;
 } Node;
 
+struct _Solver;
+struct _AI_Kernel;
+struct _EvalCache;
+
+//statistics of last AI_doTurn
+typedef struct {
+    unsigned long nodes;            /** visited nodes of all iterations */
+    unsigned long evaluations;      /** static evaluations of leaf nodes */
+    unsigned long eval_hits;        /** leaf scores found in evaluation cache */
+    unsigned long cutoffs;          /** alpha-beta cutoffs */
+    unsigned long first_cutoffs;    /** cutoffs caused by first searched move */
+    unsigned long researches;       /** reduced moves searched again to full depth */
+    unsigned long tt_probes;        /** node table probes of solver */
+    unsigned long tt_hits;          /** node table hits of solver */
+    unsigned long solver_nodes;
+    unsigned int max_depth;         /** deepest ply reached */
+
+    //iterative deepening, index 0 is depth 1
+    unsigned int depth_count;
+    unsigned long depth_nodes[AI_STATS_MAX_DEPTH];
+    double depth_time[AI_STATS_MAX_DEPTH];      /** seconds */
+    double depth_branching[AI_STATS_MAX_DEPTH]; /** effective branching factor */
+
+    double time;                    /** seconds of whole turn */
+    int score;
+    Node pv[AI_PV_MAX_LENGTH];      /** principal variation of deepest iteration */
+    unsigned int pv_length;
+} AI_Stats;
+
 typedef struct {
     unsigned int search_depth;
     Symbol symbol;
-    unsigned int cell_count;
+    Rules rules;
     Symbol * gameData;
 
+    //board routines specialised for rules
+    const struct _AI_Kernel * kernel;
+
     int * values;
+
+    //static scores of positions, keyed by hash of gameData
+    struct _EvalCache * eval_cache;
+    uint64_t hash;
+    unsigned long eval_probes;
+    unsigned long eval_hits;
+
+    //proof-number solver, used in sharp positions
+    struct _Solver * solver;
+    unsigned long solver_node_limit;
+
+    //selective search
+    bool reductions;        /** late move reductions of quiet moves */
+    bool extensions;        /** extensions of fours and open threes */
+    double time_limit;      /** seconds per turn (0 -> only depth limit) */
+
+    //state of running search
+    unsigned int iteration;
+    unsigned long visited;
+    double deadline;        /** end of turn on monotonic clock [s] */
+    bool aborted;
+
+#ifdef AI_STATS
+    AI_Stats stats;
+#endif
 } AI;
 
 /**
  * @brief AI_create
  * @param search_depth
+ * @param eval_cache_size Number of entries of evaluation cache (0 -> no cache)
+ * @return
+ */
+AI * AI_create(unsigned int search_depth, unsigned int eval_cache_size);
+
+/**
+ * @brief AI_setSolver Enable/disable proof-number solver for sharp positions
+ * @param ai
+ * @param table_size Size of solver node table (0 -> disable solver)
+ * @param node_limit Maximum number of solver nodes per turn
  * @return
  */
-AI * AI_create(unsigned int search_depth);
+bool AI_setSolver(AI * ai, unsigned int table_size, unsigned long node_limit);
+
+/**
+ * @brief AI_setSelectiveSearch Enable/disable selective search (both enabled by default)
+ * @param ai
+ * @param reductions Search quiet moves after first few with reduced depth
+ * @param extensions Search forcing moves (four, open three) one ply deeper
+ */
+void AI_setSelectiveSearch(AI * ai, bool reductions, bool extensions);
+
+/**
+ * @brief AI_setTimeLimit Limit time of iterative deepening, result of the last
+ *        finished iteration is played
+ * @param ai
+ * @param seconds Time per turn (0 -> search always to full depth)
+ */
+void AI_setTimeLimit(AI * ai, double seconds);
 
 /**
  * @brief AI_destruct
@@ -34,10 +130,10 @@ void AI_destruct(AI * ai);
  * @brief AI_refeshGameData
  * @param ai
  * @param cells
- * @param count
+ * @param rules Size of board and win length
  * @param symbol
  */
-void AI_refeshGameData(AI * ai, Cell * cells, unsigned int count, Symbol symbol);
+void AI_refeshGameData(AI * ai, Cell * cells, Rules rules, Symbol symbol);
 
 /**
  * @brief AI_doTurn
@@ -46,5 +142,26 @@ void AI_refeshGameData(AI * ai, Cell * cells, unsigned int count, Symbol symbol)
  */
 Node AI_doTurn(AI * ai);
 
+/**
+ * @brief AI_getEvalCacheHitRate Ratio of leaf evaluations found in cache since AI was created
+ * @param ai
+ * @return
+ */
+double AI_getEvalCacheHitRate(const AI * ai);
+
+/**
+ * @brief AI_getStats Statistics of last search
+ * @param ai
+ * @return NULL if statistics are compiled out
+ */
+const AI_Stats * AI_getStats(const AI * ai);
+
+/**
+ * @brief AI_Stats_writeJSON Write statistics as one line of JSON
+ * @param stats
+ * @param file
+ */
+void AI_Stats_writeJSON(const AI_Stats * stats, FILE * file);
+
 
 #endif // AI_H
@@ -0,0 +1,275 @@
+/**
+ * Board routines of AI, included by ai.c once for each specialised rule set.
+ *
+ * Before including define:
+ *  KERNEL(name)    name of generated function
+ *  K_WIDTH         number of columns
+ *  K_HEIGHT        number of rows
+ *  K_WIN           symbols in line needed to win (at most RULES_MAX_WIN_LENGTH)
+ *
+ * With constant size and win length the compiler folds index arithmetic and
+ * unrolls line scans, the generic kernel defines them from ai->rules.
+ */
+
+#define K_INDEX(x, y) ((x) + (y) * K_WIDTH)
+
+
+static void KERNEL(getPosibleMoves)(Nodes * nodes, AI * ai) {
+    nodes->count = 0;
+
+    int x, y;
+    int i, j;
+    bool add;
+
+    for(x = 0; x < K_WIDTH; ++x) {
+        for(y = 0; y < K_HEIGHT; ++y) {
+            if(ai->gameData[K_INDEX(x, y)] == Symbol_None) {
+                add = false;
+                for(i = -SEARCH_RANGE; i <= SEARCH_RANGE; ++i) {
+                    if(x + i < 0) continue;
+                    if(x + i >= K_WIDTH) break;
+                    for(j = -SEARCH_RANGE; j <= SEARCH_RANGE; ++j) {
+                        if(y + j < 0) continue;
+                        if(y + j >= K_HEIGHT) break;
+                        if(ai->gameData[K_INDEX(x + i, y + j)] != Symbol_None) {
+                            add = true;
+                            goto ADD;
+                        }
+                    }
+                }
+ADD:
+                if(add) {
+                    if(nodes->count < NODE_BUFFER_SIZE) {
+                        nodes->data[nodes->count].x = x;
+                        nodes->data[nodes->count].y = y;
+                        ++nodes->count;
+                    } else {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+
+    if(nodes->count == 0) {
+        nodes->data[0] = randomMove(ai);
+        nodes->count = 1;
+    }
+}
+
+static Node KERNEL(checkForWin)(AI * ai) {
+
+    int x, y;
+    int dx, dy;
+    int offset;
+    int gap_index;
+    int nx, ny;
+    Symbol s;
+
+    for(x = 0; x < K_WIDTH; ++x) {
+        for(y = 0; y < K_HEIGHT; ++y) {
+            if(ai->gameData[K_INDEX(x, y)] != ai->symbol) continue;
+
+            for(dx = -1; dx <= 1; ++dx) {
+                for(dy = -1; dy <= 1; ++dy) {
+                    if(dx == 0 && dy == 0) continue;
+                    gap_index = -1;
+                    for(offset = 1; offset < K_WIN; ++offset) {
+                        nx = x + offset * dx;
+                        ny = y + offset * dy;
+
+                        if(nx < 0 || nx >= K_WIDTH) break;
+                        if(ny < 0 || ny >= K_HEIGHT) break;
+
+                        s = ai->gameData[K_INDEX(nx, ny)];
+                        if(s == Symbol_None) {
+                            if(gap_index >= 0) break;
+                            gap_index = offset;
+                        } else if (s != ai->symbol) {
+                            break;
+                        }
+                    }
+                    if(gap_index >= 0 && offset == K_WIN) return (Node){.x=x+gap_index*dx, .y=y+gap_index*dy};
+                }
+            }
+
+        }
+    }
+
+    return (Node){.x=-1, .y=-1};
+}
+
+static int KERNEL(evaluateNode)(AI * ai, Node node, Symbol turnNow) {
+
+    Symbol origin = ai->gameData[K_INDEX(node.x, node.y)];
+    if(origin == Symbol_None) return 0;
+
+    int value = 0;
+
+    int offset;
+    int cnt;
+    int gaps;
+    int x, y;
+    int dx, dy;
+    Symbol current;
+
+    for(dx = -1; dx <= 1; ++dx) {
+        for(dy = -1; dy <= 1; ++dy) {
+            if(dx == 0 && dy == 0) continue;
+
+            //process symbols
+            for(offset = 0, cnt = 0, gaps = 0; offset < K_WIN; ++offset) {
+                x = node.x + offset * dx;
+                y = node.y + offset * dy;
+
+                if(x < 0 || y < 0) break;
+                if(x >= K_WIDTH || y >= K_HEIGHT) break;
+
+                current = ai->gameData[K_INDEX(x, y)];
+                if(current == origin) {
+                    if(gaps > EVAL_MAX_GAPS) break;
+                    ++cnt;
+                } else if(current == Symbol_None) {
+                    ++gaps;
+                } else {
+                    break;
+                }
+            }
+
+            //add score
+            if(cnt < 2) continue;
+
+            int sign = 1;
+            if(turnNow == Symbol_None) {
+                sign = ai->symbol == origin ? 1 : -1;
+            } else if(turnNow == ai->symbol) {
+                sign = ai->symbol == origin ? 1 : -2;
+            } else {
+                sign = ai->symbol == origin ? 2 : -1;
+            }
+
+            if(cnt == K_WIN) {
+                value += WIN * sign;
+            } else {
+                if(offset != K_WIN) {
+                    //blocked from end side
+                    x = node.x - dx;
+                    y = node.y - dy;
+                    if(x >= 0 && x < K_WIDTH && y >= 0 && y < K_HEIGHT) {
+                        current = ai->gameData[K_INDEX(x, y)];
+                        if(current != OPPOSITE(origin)) {
+                            //add only if not blocked from start
+                            value += BLOCKED_SCORE[K_WIN - cnt] * sign;
+                        }
+                    }
+                } else {
+                    //opened from end side
+                    x = node.x - dx;
+                    y = node.y - dy;
+                    if(x >= 0 && x < K_WIDTH && y >= 0 && y < K_HEIGHT) {
+                        current = ai->gameData[K_INDEX(x, y)];
+                        if(current != OPPOSITE(origin)) {
+                            //opened from both sides
+                            value += OPEN_SCORE[K_WIN - cnt] * sign;
+                        } else {
+                            //blocked from beginning
+                            value += BLOCKED_SCORE[K_WIN - cnt] * sign;
+                        }
+                    } else {
+                        //blocked from beginning
+                        value += BLOCKED_SCORE[K_WIN - cnt] * sign;
+                    }
+                }
+            }
+
+        }
+    }
+
+    return value;
+}
+
+static int KERNEL(evaluate)(AI * ai, Symbol turnNow) {
+    int value = 0;
+
+    //evalueate all cells
+    Node node;
+    int current;
+    for(int x = 0; x < K_WIDTH; ++x) {
+        for(int y = 0; y < K_HEIGHT; ++y) {
+            node.x = x;
+            node.y = y;
+            current = KERNEL(evaluateNode)(ai, node, turnNow);
+            ai->values[K_INDEX(x, y)] = current;
+            value += current;
+        }
+    }
+
+    return value;
+}
+
+static Threat KERNEL(threat)(AI * ai, Node node, Symbol symbol, int * potential) {
+    Threat threat = THREAT_NONE;
+    *potential = 0;
+
+    //line through node, node is in the middle, cells outside of board are blocked
+    Symbol line[2 * RULES_MAX_WIN_LENGTH + 1];
+    int d, offset, start, i;
+    int x, y;
+    int own;
+
+    for(d = 0; d < 4; ++d) {
+        for(offset = -K_WIN; offset <= K_WIN; ++offset) {
+            x = node.x + offset * THREAT_DIRECTIONS[d][0];
+            y = node.y + offset * THREAT_DIRECTIONS[d][1];
+            if(offset == 0) {
+                line[K_WIN] = symbol;
+            } else if(x < 0 || y < 0 || x >= K_WIDTH || y >= K_HEIGHT) {
+                line[offset + K_WIN] = OPPOSITE(symbol);
+            } else {
+                line[offset + K_WIN] = ai->gameData[K_INDEX(x, y)];
+            }
+        }
+
+        //windows of win length containing node
+        for(start = 1; start <= K_WIN; ++start) {
+            for(i = start, own = 0; i < start + K_WIN; ++i) {
+                if(line[i] == symbol) ++own;
+                else if(line[i] != Symbol_None) break;
+            }
+            if(i < start + K_WIN) continue;
+            *potential += own * own;
+            if(own == K_WIN) return THREAT_FIVE;
+            if(own == K_WIN - 1) threat = THREAT_FOUR;
+        }
+        if(threat != THREAT_NONE) continue;
+
+        //open three -> empty ends around win length - 1 cells missing one symbol
+        for(start = 2; start <= K_WIN; ++start) {
+            if(line[start - 1] != Symbol_None || line[start + K_WIN - 1] != Symbol_None) continue;
+            for(i = start, own = 0; i < start + K_WIN - 1; ++i) {
+                if(line[i] == symbol) ++own;
+                else if(line[i] != Symbol_None) break;
+            }
+            if(i == start + K_WIN - 1 && own == K_WIN - 2) {
+                threat = THREAT_THREE;
+                break;
+            }
+        }
+    }
+
+    return threat;
+}
+
+static const AI_Kernel KERNEL(kernel) = {
+    .getPosibleMoves = KERNEL(getPosibleMoves),
+    .checkForWin = KERNEL(checkForWin),
+    .evaluate = KERNEL(evaluate),
+    .threat = KERNEL(threat)
+};
+
+
+#undef K_INDEX
+#undef KERNEL
+#undef K_WIDTH
+#undef K_HEIGHT
+#undef K_WIN
@@ -8,51 +8,8 @@
 
 static void render(void * obj, const Event_Render * evt) {
     Cell * cell = (Cell*) obj;
-
-    if(cell->mouseOn && cell->symbol == Symbol_None) {
-        Render_setColor(&COLOR_LIGHTER(cell->background, 0.1));
-    } else {
-        Render_setColor(&cell->background);
-    }
-    Render_fillRectangle(&cell->position, cell->size, cell->size);
-    Color border = COLOR_LIGHTER(cell->background, 0.4);
-    Render_setColor(&border);
-    Render_drawRectangle(&cell->position, cell->size, cell->size);
-
-    switch (cell->symbol) {
-    case Symbol_X:
-        Render_setColor(&X_COLOR);
-
-        Point2D pts[4];
-        pts[0] = pts[1] = cell->position;
-
-        pts[0].x += cell->size * 0.2;
-        pts[0].y += cell->size * 0.2;
-        pts[1].x += cell->size * 0.8;
-        pts[1].y += cell->size * 0.8;
-
-        pts[2].x = pts[1].x;
-        pts[2].y = pts[0].y;
-        pts[3].x = pts[0].x;
-        pts[3].y = pts[1].y;
-
-        Render_lineWidth(3);
-        Render_drawLine(&pts[0], &pts[1]);
-        Render_drawLine(&pts[2], &pts[3]);
-        Render_lineWidth(RENDER_DEFAULT_LINE_WIDTH);
-        break;
-    case Symbol_O:
-        Render_setColor(&O_COLOR);
-
-        Point2D center = cell->position;
-        center.x += cell->size/2;
-        center.y += cell->size/2;
-
-        Render_lineWidth(3);
-        Render_drawEllipse(&center, cell->size * 0.3, cell->size * 0.3);
-        Render_lineWidth(RENDER_DEFAULT_LINE_WIDTH);
-        break;
-    }
+    Cell_View view = {cell->symbol, cell->background, cell->mouseOn};
+    Cell_render(cell, &view);
 }
 
 static void mouseMoveEvt(void * obj, SceneData * scene, const Event_Mouse * evt) {
@@ -92,3 +49,99 @@ void Cell_init(Cell * cell, int x, int y, size_t size) {
         cell->mouseOn = false;
     }
 }
+
+void Cell_render(const Cell * cell, const Cell_View * view) {
+    Cell_renderFill(cell, view);
+    Cell_renderBorder(cell, view);
+    Cell_renderSymbol(cell, view);
+}
+
+void Cell_renderFill(const Cell * cell, const Cell_View * view) {
+    Point2D position = cell->position;
+    Color background = view->background;
+
+    if(view->mouseOn && view->symbol == Symbol_None) {
+        Render_setColor(&COLOR_LIGHTER(background, 0.1));
+    } else {
+        Render_setColor(&background);
+    }
+    Render_fillRectangle(&position, cell->size, cell->size);
+}
+
+void Cell_renderBorder(const Cell * cell, const Cell_View * view) {
+    Point2D position = cell->position;
+    Color border = COLOR_LIGHTER(view->background, 0.4);
+    Render_setColor(&border);
+    Render_drawRectangle(&position, cell->size, cell->size);
+}
+
+bool Cell_isPlain(const Cell_View * view) {
+    const Color plain = CELL_BG_COLOR;
+    if(view->mouseOn && view->symbol == Symbol_None) return false;
+
+    return view->background.red == plain.red && view->background.green == plain.green &&
+            view->background.blue == plain.blue && view->background.alpha == plain.alpha;
+}
+
+static void drawSymbol(Point2D position, GLfloat size, Symbol symbol) {
+    switch (symbol) {
+    case Symbol_X: {
+        Point2D pts[4];
+        pts[0] = pts[1] = position;
+
+        pts[0].x += size * 0.2;
+        pts[0].y += size * 0.2;
+        pts[1].x += size * 0.8;
+        pts[1].y += size * 0.8;
+
+        pts[2].x = pts[1].x;
+        pts[2].y = pts[0].y;
+        pts[3].x = pts[0].x;
+        pts[3].y = pts[1].y;
+
+        Render_lineWidth(3);
+        Render_drawLine(&pts[0], &pts[1]);
+        Render_drawLine(&pts[2], &pts[3]);
+        Render_lineWidth(RENDER_DEFAULT_LINE_WIDTH);
+        break;
+    }
+    case Symbol_O: {
+        Point2D center = position;
+        center.x += size/2;
+        center.y += size/2;
+
+        Render_lineWidth(3);
+        Render_drawEllipse(&center, size * 0.3, size * 0.3);
+        Render_lineWidth(RENDER_DEFAULT_LINE_WIDTH);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void Cell_renderSymbol(const Cell * cell, const Cell_View * view) {
+    if(view->symbol == Symbol_None) return;
+
+    Render_setColor(view->symbol == Symbol_X ? &X_COLOR : &O_COLOR);
+    drawSymbol(cell->position, cell->size, view->symbol);
+}
+
+void Cell_recordSymbol(Render_Geometry * geometry, Symbol symbol, GLfloat size) {
+    Point2D origin = {0, 0, COLOR_WHITE};
+
+    Render_beginGeometry(geometry);
+    Render_setColor(&COLOR_WHITE);
+    drawSymbol(origin, size, symbol);
+    Render_endGeometry();
+}
+
+bool Cell_symbolInstance(const Cell * cell, const Cell_View * view, GLfloat unit_size, Render_Instance * instance) {
+    if(view->symbol == Symbol_None) return false;
+
+    instance->x = cell->position.x;
+    instance->y = cell->position.y;
+    instance->size = cell->size / unit_size;
+    instance->color = view->symbol == Symbol_X ? X_COLOR : O_COLOR;
+    return true;
+}
@@ -24,6 +24,13 @@ typedef struct {
     bool mouseOn;
 } Cell;
 
+//state of cell changed by game, render thread reads its published copy
+typedef struct {
+    Symbol symbol;
+    Color background;
+    bool mouseOn;
+} Cell_View;
+
 /**
  * @brief Field_init
  * @param field
@@ -33,4 +40,61 @@ typedef struct {
  */
 void Cell_init(Cell * cell, int x, int y, size_t size);
 
+//view of empty cell without highlight, board grid is made of cells with this view
+#define CELL_VIEW_PLAIN (Cell_View){Symbol_None, CELL_BG_COLOR, false}
+
+/**
+ * @brief Cell_render Render cell with published state
+ * @param cell
+ * @param view
+ */
+void Cell_render(const Cell * cell, const Cell_View * view);
+
+/**
+ * @brief Cell_renderFill Render background of cell (highlighted under cursor)
+ * @param cell
+ * @param view
+ */
+void Cell_renderFill(const Cell * cell, const Cell_View * view);
+
+/**
+ * @brief Cell_renderBorder
+ * @param cell
+ * @param view
+ */
+void Cell_renderBorder(const Cell * cell, const Cell_View * view);
+
+/**
+ * @brief Cell_renderSymbol
+ * @param cell
+ * @param view
+ */
+void Cell_renderSymbol(const Cell * cell, const Cell_View * view);
+
+/**
+ * @brief Cell_recordSymbol Record white symbol of cell with given size placed at
+ *        origin, unit geometry of instances created by Cell_symbolInstance
+ * @param geometry
+ * @param symbol
+ * @param size
+ */
+void Cell_recordSymbol(Render_Geometry * geometry, Symbol symbol, GLfloat size);
+
+/**
+ * @brief Cell_symbolInstance Placement and color of symbol of cell
+ * @param cell
+ * @param view
+ * @param unit_size Size of recorded symbol (Cell_recordSymbol)
+ * @param instance
+ * @return False if cell has no symbol
+ */
+bool Cell_symbolInstance(const Cell * cell, const Cell_View * view, GLfloat unit_size, Render_Instance * instance);
+
+/**
+ * @brief Cell_isPlain Does cell look same as CELL_VIEW_PLAIN (apart from symbol)?
+ * @param view
+ * @return
+ */
+bool Cell_isPlain(const Cell_View * view);
+
 #endif // CELL_H
@@ -0,0 +1,61 @@
+#include "evalcache.h"
+
+#include <stdlib.h>
+
+//marks used entry, so empty entry never matches key 0
+#define VALID_BIT (1ULL << 32)
+
+
+EvalCache * EvalCache_create(unsigned int size) {
+    if(size == 0) return NULL;
+
+    //round down to power of two
+    unsigned int entries = 1;
+    while(entries <= size / 2) entries <<= 1;
+
+    EvalCache * cache = malloc(sizeof(EvalCache));
+    if(cache == NULL) return NULL;
+
+    cache->table = malloc(sizeof(EvalCache_Entry) * entries);
+    if(cache->table == NULL) {
+        free(cache);
+        return NULL;
+    }
+    cache->mask = entries - 1;
+    EvalCache_clear(cache);
+
+    return cache;
+}
+
+void EvalCache_destruct(EvalCache * cache) {
+    if(cache != NULL) {
+        if(cache->table) free(cache->table);
+        free(cache);
+    }
+}
+
+void EvalCache_clear(EvalCache * cache) {
+    if(cache == NULL) return;
+
+    for(unsigned int i = 0; i <= cache->mask; ++i) {
+        atomic_init(&cache->table[i].check, 0);
+        atomic_init(&cache->table[i].data, 0);
+    }
+}
+
+bool EvalCache_probe(const EvalCache * cache, uint64_t key, int * score) {
+    EvalCache_Entry * entry = &cache->table[key & cache->mask];
+    uint64_t data = atomic_load_explicit(&entry->data, memory_order_relaxed);
+    uint64_t check = atomic_load_explicit(&entry->check, memory_order_relaxed);
+    if((data & VALID_BIT) == 0 || (check ^ data) != key) return false;
+
+    *score = (int32_t) (uint32_t) data;
+    return true;
+}
+
+void EvalCache_store(EvalCache * cache, uint64_t key, int score) {
+    EvalCache_Entry * entry = &cache->table[key & cache->mask];
+    uint64_t data = (uint64_t) (uint32_t) score | VALID_BIT;
+    atomic_store_explicit(&entry->check, key ^ data, memory_order_relaxed);
+    atomic_store_explicit(&entry->data, data, memory_order_relaxed);
+}
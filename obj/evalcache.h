@@ -0,0 +1,60 @@
+#ifndef EVALCACHE_H
+#define EVALCACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+//entry of cache, check word is key ^ data so torn writes of parallel searches are never returned
+typedef struct {
+    _Atomic uint64_t check;
+    _Atomic uint64_t data;
+} EvalCache_Entry;
+
+/**
+ * Direct-mapped cache of static evaluations keyed by position hash.
+ * Entries are always replaced, access is lock-free and may be shared
+ * by searches running in parallel.
+ */
+typedef struct _EvalCache {
+    EvalCache_Entry * table;
+    unsigned int mask;
+} EvalCache;
+
+/**
+ * @brief EvalCache_create
+ * @param size Number of entries (rounded down to power of two)
+ * @return
+ */
+EvalCache * EvalCache_create(unsigned int size);
+
+/**
+ * @brief EvalCache_destruct
+ * @param cache
+ */
+void EvalCache_destruct(EvalCache * cache);
+
+/**
+ * @brief EvalCache_clear Remove all entries
+ * @param cache
+ */
+void EvalCache_clear(EvalCache * cache);
+
+/**
+ * @brief EvalCache_probe
+ * @param cache
+ * @param key Position hash including side to move
+ * @param score Cached score (written only on hit)
+ * @return True on hit
+ */
+bool EvalCache_probe(const EvalCache * cache, uint64_t key, int * score);
+
+/**
+ * @brief EvalCache_store
+ * @param cache
+ * @param key Position hash including side to move
+ * @param score
+ */
+void EvalCache_store(EvalCache * cache, uint64_t key, int score);
+
+#endif // EVALCACHE_H
@@ -2,8 +2,66 @@
 
 #include <assert.h>
 #include "ai.h"
+#include "../s3d/damage.h"
 
 
+static void damageCell(GameBoard * board, const Cell * cell) {
+    //border and symbols use smoothed lines
+    Damage_markRect(board->position.x + cell->position.x - 2, board->position.y + cell->position.y - 2,
+                    cell->size + 4, cell->size + 4);
+}
+
+
+static void * searchWorker(void * args) {
+    GameBoard * board = (GameBoard*) args;
+    board->searchResult = AI_doTurn(board->search);
+    //release -> result is visible to update thread
+    atomic_store_explicit(&board->searchDone, true, memory_order_release);
+    return NULL;
+}
+
+static bool startSearch(GameBoard * board, AI * ai) {
+    board->search = ai;
+    atomic_store(&board->searchDone, false);
+    if(pthread_create(&board->searchThread, NULL, searchWorker, board)) {
+        board->search = NULL;
+        return false;
+    }
+    return true;
+}
+
+static void joinSearch(GameBoard * board) {
+    if(board->search == NULL) return;
+    pthread_join(board->searchThread, NULL);
+    board->search = NULL;
+}
+
+static void applyTurn(GameBoard * board, AI * ai, Node turn) {
+    assert(turn.x != -1 && turn.y != -1);
+    bool AI_turn = GameBoard_turn(board, turn.x, turn.y, ai->symbol);
+    assert(AI_turn);
+}
+
+static void buildGeometry(GameBoard * board, unsigned int geometry) {
+    const Cell_View plain = CELL_VIEW_PLAIN;
+    const unsigned int count = board->rules.width * board->rules.height;
+    unsigned int i;
+
+    //all fills and then all borders -> two batches
+    Render_beginGeometry(&board->tiles);
+    for(i = 0; i < count; ++i) {
+        Cell_renderFill(&board->cells[i], &plain);
+    }
+    for(i = 0; i < count; ++i) {
+        Cell_renderBorder(&board->cells[i], &plain);
+    }
+    Render_endGeometry();
+
+    Cell_recordSymbol(&board->symbols[Symbol_X], Symbol_X, board->cell_size);
+    Cell_recordSymbol(&board->symbols[Symbol_O], Symbol_O, board->cell_size);
+    board->geometry_built = geometry;
+}
+
 static void destruct(void * obj) {
     GameBoard * board = (GameBoard*) obj;
     GameBoard_destruct(board);
@@ -12,20 +70,40 @@ static void destruct(void * obj) {
 static void render(void * obj, const Event_Render * evt) {
     GameBoard * board = (GameBoard*) obj;
 
-    if(board->cells != NULL) {
-        Render_applyOffset(board->position.x, board->position.y, 0.0);
+    if(board->cells != NULL && Render_pushTransform()) {
+        const GameBoard_View * view = TripleBuffer_read(&board->view);
+
+        Render_translate(board->position.x, board->position.y);
+
+        //grid of plain cells, then highlighted cells (hover, last move) and symbols
+        if(board->geometry_built != view->geometry) buildGeometry(board, view->geometry);
+        Render_drawGeometry(&board->tiles);
+        const unsigned int count = board->rules.width * board->rules.height;
+        for(unsigned int i = 0; i < count; ++i) {
+            if(!Cell_isPlain(&view->cells[i])) {
+                Cell_renderFill(&board->cells[i], &view->cells[i]);
+                Cell_renderBorder(&board->cells[i], &view->cells[i]);
+            }
+        }
 
-        //render fields
-        Cell * cell;
-        for(unsigned int i = 0; i < board->cell_count * board->cell_count; ++i) {
-            cell = &board->cells[i];
-            if(cell->events->render) cell->events->render(cell, evt);
+        //X symbols from start of instances, O symbols from end
+        unsigned int xs = 0, os = 0;
+        Render_Instance instance;
+        for(unsigned int i = 0; i < count; ++i) {
+            if(!Cell_symbolInstance(&board->cells[i], &view->cells[i], board->cell_size, &instance)) continue;
+            if(view->cells[i].symbol == Symbol_X) {
+                board->instances[xs++] = instance;
+            } else {
+                board->instances[count - ++os] = instance;
+            }
         }
+        Render_drawInstances(&board->symbols[Symbol_X], board->instances, xs);
+        Render_drawInstances(&board->symbols[Symbol_O], board->instances + count - os, os);
 
         //render win line
-        if(board->gameEnd && board->line->x != -1) {
-            float fSize = (float)board->size / (float)board->cell_count;
-            Point2D start = board->line[0], end = board->line[1];
+        if(view->gameEnd && view->line[0].x != -1) {
+            float fSize = board->cell_size;
+            Point2D start = view->line[0], end = view->line[1];
             start.x = (start.x + 0.5) * fSize;
             start.y = (start.y + 0.5) * fSize;
             end.x = (end.x + 0.5) * fSize;
@@ -36,7 +114,7 @@ static void render(void * obj, const Event_Render * evt) {
             Render_lineWidth(RENDER_DEFAULT_LINE_WIDTH);
         }
 
-        Render_clearOffset();
+        Render_popTransform();
     }
 
     //render player info
@@ -44,41 +122,59 @@ static void render(void * obj, const Event_Render * evt) {
     if(board->player2->events->render) board->player2->events->render(board->player2, evt);
 }
 
+static void resize(void * obj, const Event_Resize * evt) {
+    (void) evt;
+    GameBoard * board = (GameBoard*) obj;
+    ++board->geometry;
+}
+
 static void mouseMoveEvt(void * obj, SceneData * scene, const Event_Mouse * evt) {
     GameBoard * board = (GameBoard*) obj;
 
-    if(IN_RANGE(evt->x, board->position.x, board->position.x + board->size)) {
-        if(IN_RANGE(evt->y, board->position.y, board->position.y + board->size)) {
-            Event_Mouse board_evt = *evt;
-            board_evt.x -= board->position.x;
-            board_evt.y -= board->position.y;
-            board_evt.sender = board;
-
-            Cell * cell;
-            for(unsigned int i = 0; i < board->cell_count * board->cell_count; ++i) {
-                cell = &board->cells[i];
-                if(cell->events->mouseMoveEvt) cell->events->mouseMoveEvt(cell, scene, &board_evt);
-            }
-        }
+    //only cell under cursor and cell that was left receive event
+    int index = HitGrid_cellAt(&board->grid, evt->x, evt->y);
+    if(index == board->hoverCell) return;
+
+    Event_Mouse board_evt = *evt;
+    board_evt.sender = board;
+    Cell * cell;
+
+    //leave, coordinates outside of board
+    if(board->hoverCell >= 0) {
+        board_evt.x = -1;
+        board_evt.y = -1;
+        cell = &board->cells[board->hoverCell];
+        if(cell->events->mouseMoveEvt) cell->events->mouseMoveEvt(cell, scene, &board_evt);
+        damageCell(board, cell);
+    }
+
+    //enter
+    if(index >= 0) {
+        board_evt.x = evt->x - board->position.x;
+        board_evt.y = evt->y - board->position.y;
+        cell = &board->cells[index];
+        if(cell->events->mouseMoveEvt) cell->events->mouseMoveEvt(cell, scene, &board_evt);
+        damageCell(board, cell);
     }
+
+    board->hoverCell = index;
 }
 
 static void mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * evt) {
+    (void) scene;
     GameBoard * board = (GameBoard*) obj;
 
     Player * player = board->firstPlayerOnTurn ? board->player1 : board->player2;
 
+    //AI is on turn
+    if(board->search != NULL) return;
+
     if(player->ai == NULL || true) {
         //homan move
-        if(IN_RANGE(evt->x, board->position.x, board->position.x + board->size)) {
-            if(IN_RANGE(evt->y, board->position.y, board->position.y + board->size)) {
-                if(evt->state == EVT_M_DOWN) {
-                    float fSize = (float)board->size / (float)board->cell_count;
-                    unsigned int x = (evt->x - board->position.x) / fSize;
-                    unsigned int y = (evt->y - board->position.y) / fSize;
-                    GameBoard_turn(board, x, y, board->firstPlayerOnTurn ? Symbol_X : Symbol_O);
-                }
-            }
+        int index = HitGrid_cellAt(&board->grid, evt->x, evt->y);
+        if(index >= 0 && evt->state == EVT_M_DOWN) {
+            GameBoard_turn(board, index % board->rules.width, index / board->rules.width,
+                           board->firstPlayerOnTurn ? Symbol_X : Symbol_O);
         }
     }
 }
@@ -93,32 +189,60 @@ static void update(void * obj, SceneData * scene, const Event_Update * evt) {
     if(board->player2->events->update) board->player2->events->update(board->player2, scene, evt);
 
 
-    //AI move
+    //AI move, search does not block update loop (clock of players, input)
     Player * player = board->firstPlayerOnTurn ? board->player1 : board->player2;
-    if(player->ai != NULL) {
-        AI_refeshGameData(player->ai, board->cells, board->cell_count,
+    if(board->search != NULL) {
+        if(!atomic_load_explicit(&board->searchDone, memory_order_acquire)) return;
+        AI * ai = board->search;
+        joinSearch(board);
+        //AI of player could be replaced while it was searching
+        if(ai == player->ai) applyTurn(board, ai, board->searchResult);
+    } else if(player->ai != NULL) {
+        //game data are copied to AI before search starts
+        AI_refeshGameData(player->ai, board->cells, board->rules,
                           board->firstPlayerOnTurn ? Symbol_X : Symbol_O);
-        Node turn = AI_doTurn(player->ai);
-        assert(turn.x != -1 && turn.y != -1);
-        bool AI_turn = GameBoard_turn(board, turn.x, turn.y, player->ai->symbol);
-        assert(AI_turn);
+        if(!startSearch(board, player->ai)) {
+            //no thread, search blocks update
+            applyTurn(board, player->ai, AI_doTurn(player->ai));
+        }
+    }
+}
+
+static void publish(void * obj) {
+    GameBoard * board = (GameBoard*) obj;
+
+    GameBoard_View * view = TripleBuffer_writeBuffer(&board->view);
+    view->gameEnd = board->gameEnd;
+    view->geometry = board->geometry;
+    view->line[0] = board->line[0];
+    view->line[1] = board->line[1];
+    for(unsigned int i = 0; i < board->rules.width * board->rules.height; ++i) {
+        view->cells[i].symbol = board->cells[i].symbol;
+        view->cells[i].background = board->cells[i].background;
+        view->cells[i].mouseOn = board->cells[i].mouseOn;
     }
+    TripleBuffer_publish(&board->view);
+
+    //player info
+    if(board->player1 != NULL && board->player1->events->publish) board->player1->events->publish(board->player1);
+    if(board->player2 != NULL && board->player2->events->publish) board->player2->events->publish(board->player2);
 }
 
 static const E_Obj_Evts e_obj_evts = {
     .destruct = destruct,
     .render = render,
-    .resize = NULL,
+    .resize = resize,
     .update = update,
     .mouseMoveEvt = mouseMoveEvt,
     .mouseButtonEvt = mouseButtonEvt,
     .pressKeyEvt = NULL,
     .releaseKeyEvt = NULL,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = publish
 };
 
-GameBoard * GameBoard_create(int x, int y, size_t size, unsigned int count, GameEnd gameEndEvt) {
-    if(count < 3) return NULL;
+GameBoard * GameBoard_create(int x, int y, size_t size, Rules rules, GameEnd gameEndEvt) {
+    if(!Rules_valid(rules)) return NULL;
 
     GameBoard * board = malloc(sizeof(GameBoard));
     if(board == NULL) return NULL;
@@ -127,34 +251,66 @@ GameBoard * GameBoard_create(int x, int y, size_t size, unsigned int count, Game
     board->position.x = x;
     board->position.y = y;
     board->size = size;
-    board->cell_count = count;
+    board->rules = rules;
+    board->cell_size = (float)size / (float)MAX(rules.width, rules.height);
+    HitGrid_init(&board->grid, x, y, board->cell_size, board->cell_size, rules.width, rules.height);
+    board->hoverCell = -1;
     board->firstPlayerOnTurn = true;
+    board->search = NULL;
+    atomic_init(&board->searchDone, false);
     board->line = malloc(sizeof(Point2D) * 2);
-    board->line[0].x = -1;
     board->gameEnd = false;
     board->gameEndEvt = gameEndEvt;
-
-    board->cells = malloc(sizeof(Cell) * count * count);
-    if(board->cells == NULL) {
+    board->player1 = NULL;
+    board->player2 = NULL;
+    Render_initGeometry(&board->tiles);
+    Render_initGeometry(&board->symbols[Symbol_X]);
+    Render_initGeometry(&board->symbols[Symbol_O]);
+    board->geometry = 1;
+    board->geometry_built = 0;
+
+    board->cells = malloc(sizeof(Cell) * rules.width * rules.height);
+    board->instances = malloc(sizeof(Render_Instance) * rules.width * rules.height);
+    if(board->line == NULL || board->cells == NULL || board->instances == NULL) {
+        free(board->line);
+        free(board->cells);
+        free(board->instances);
         free(board);
         return NULL;
     }
+    board->line[0].x = -1;
 
-    float fSize = (float)size / (float)count;
-    for(unsigned int x = 0; x < board->cell_count; ++x) {
-        for(unsigned int y = 0; y < board->cell_count; ++y) {
-            Cell_init(&board->cells[x + y * board->cell_count],
+    float fSize = board->cell_size;
+    for(unsigned int x = 0; x < rules.width; ++x) {
+        for(unsigned int y = 0; y < rules.height; ++y) {
+            Cell_init(&board->cells[x + y * rules.width],
                     x * fSize, y * fSize, fSize);
         }
     }
 
+    if(!TripleBuffer_init(&board->view, sizeof(GameBoard_View) +
+                          sizeof(Cell_View) * rules.width * rules.height)) {
+        free(board->line);
+        free(board->cells);
+        free(board->instances);
+        free(board);
+        return NULL;
+    }
+    publish(board);
+
     return board;
 }
 
 void GameBoard_destruct(GameBoard * board) {
     if(board != NULL) {
+        joinSearch(board);
         if(board->cells) free(board->cells);
         if(board->line) free(board->line);
+        TripleBuffer_destruct(&board->view);
+        Render_destructGeometry(&board->tiles);
+        Render_destructGeometry(&board->symbols[Symbol_X]);
+        Render_destructGeometry(&board->symbols[Symbol_O]);
+        free(board->instances);
         free(board);
     }
 }
@@ -164,25 +320,29 @@ static Cell * last_placed_cell;
 bool GameBoard_turn(GameBoard * board, unsigned int x, unsigned int y, Symbol symbol) {
     if(board == NULL) return false;
     if(board->gameEnd) return false;
-    if(x >= board->cell_count || y >= board->cell_count) return false;
+    if(x >= board->rules.width || y >= board->rules.height) return false;
     if(board->cells == NULL) return false;
 
     //place symbol
     if(last_placed_cell != NULL) {
         last_placed_cell->background = CELL_BG_COLOR;
+        damageCell(board, last_placed_cell);
     }
-    Cell * cell = &board->cells[x + y * board->cell_count];
+    Cell * cell = &board->cells[x + y * board->rules.width];
     last_placed_cell = cell;
     if(cell->symbol != Symbol_None) return false;
     cell->symbol = symbol;
     cell->background = CELL_BG_PLACE_COLOR;
+    damageCell(board, cell);
 
     //check winner
     Point2D line[2];
-    if(GameBoard_find5InLine(board, line)) {
+    if(GameBoard_findWinLine(board, line)) {
         board->line[0] = line[0];
         board->line[1] = line[1];
         board->gameEnd = true;
+        //win line crosses board, handler can change any object
+        Damage_markAll();
         if(board->gameEndEvt) board->gameEndEvt(board->firstPlayerOnTurn ? board->player1 : board->player2);
     }
 
@@ -201,13 +361,17 @@ bool GameBoard_turn(GameBoard * board, unsigned int x, unsigned int y, Symbol sy
 
 void GameBoard_clearGame(GameBoard * board) {
     if(board != NULL) {
-        for(unsigned int i = 0; i < board->cell_count * board->cell_count; ++i) {
+        //search of previous game, its move is dropped
+        joinSearch(board);
+        for(unsigned int i = 0; i < board->rules.width * board->rules.height; ++i) {
             board->cells[i].symbol = Symbol_None;
             board->cells[i].background = CELL_BG_COLOR;
         }
         board->gameEnd = false;
         board->firstPlayerOnTurn = true;
         board->line[0].x = -1;
+        Damage_markRect(board->position.x - 2, board->position.y - 2,
+                        board->cell_size * board->rules.width + 4, board->cell_size * board->rules.height + 4);
         if(board->player1 != NULL && board->player2 != NULL) {
             Player_activate(board->player1);
             Player_deactivate(board->player2);
@@ -215,80 +379,41 @@ void GameBoard_clearGame(GameBoard * board) {
     }
 }
 
-bool GameBoard_find5InLine(GameBoard * board, Point2D * start_end) {
+bool GameBoard_findWinLine(GameBoard * board, Point2D * start_end) {
     if(board == NULL || start_end == NULL) return false;
 
-    unsigned int i;
+    static const int DIRECTIONS[4][2] = {{1, 0}, {0, 1}, {1, 1}, {-1, 1}};
+
+    const int width = board->rules.width;
+    const int height = board->rules.height;
+    const int k = board->rules.win_length;
+    int i, d, dx, dy;
     Symbol symbol;
-    for(unsigned int x = 0; x < board->cell_count; ++x) {
-        for(unsigned int y = 0; y < board->cell_count; ++y) {
+    for(int x = 0; x < width; ++x) {
+        for(int y = 0; y < height; ++y) {
 
-            if(board->cells[x + y * board->cell_count].symbol == Symbol_None) {
+            symbol = board->cells[x + y * width].symbol;
+            if(symbol == Symbol_None) {
                 continue;
             }
 
-            //horizontal
-            if(x + 5 < board->cell_count) {
-                symbol = board->cells[x + y * board->cell_count].symbol;
-                for(i = 0; i < 5; ++i) {
-                    if(symbol != board->cells[x + i + y * board->cell_count].symbol) {
-                        break;
-                    }
-                }
-                if(i == 5) {
-                    start_end[0].y = start_end[1].y = y;
-                    start_end[0].x = x;
-                    start_end[1].x = x + 4;
-                    return true;
-                }
-            }
-
-            //vertical
-            if(y + 5 < board->cell_count) {
-                symbol = board->cells[x + y * board->cell_count].symbol;
-                for(i = 0; i < 5; ++i) {
-                    if(symbol != board->cells[x + (y + i) * board->cell_count].symbol) {
-                        break;
-                    }
-                }
-                if(i == 5) {
-                    start_end[0].x = start_end[1].x = x;
-                    start_end[0].y = y;
-                    start_end[1].y = y + 4;
-                    return true;
-                }
-            }
-
-            //digonal 1
-            if(y + 5 < board->cell_count && x + 5 < board->cell_count) {
-                symbol = board->cells[x + y * board->cell_count].symbol;
-                for(i = 0; i < 5; ++i) {
-                    if(symbol != board->cells[x + i + (y + i) * board->cell_count].symbol) {
-                        break;
-                    }
-                }
-                if(i == 5) {
-                    start_end[0].x = x;
-                    start_end[0].y = y;
-                    start_end[1].x = x + 4;
-                    start_end[1].y = y + 4;
-                    return true;
-                }
-            }
+            //horizontal, vertical, digonal 1, digonal 2
+            for(d = 0; d < 4; ++d) {
+                dx = DIRECTIONS[d][0];
+                dy = DIRECTIONS[d][1];
+                if(x + (k - 1) * dx < 0 || x + (k - 1) * dx >= width) continue;
+                if(y + (k - 1) * dy >= height) continue;
 
-            //digonal 2
-            if(y + 5 < board->cell_count && x - 5 >= 0) {
-                symbol = board->cells[x + y * board->cell_count].symbol;
-                for(i = 0; i < 5; ++i) {
-                    if(symbol != board->cells[x - i + (y + i) * board->cell_count].symbol) {
+                for(i = 1; i < k; ++i) {
+                    if(symbol != board->cells[x + i * dx + (y + i * dy) * width].symbol) {
                         break;
                     }
                 }
-                if(i == 5) {
+                if(i == k) {
                     start_end[0].x = x;
                     start_end[0].y = y;
-                    start_end[1].x = x - 4;
-                    start_end[1].y = y + 4;
+                    start_end[1].x = x + (k - 1) * dx;
+                    start_end[1].y = y + (k - 1) * dy;
                     return true;
                 }
             }
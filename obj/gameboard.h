@@ -2,47 +2,80 @@
 #define GAMEBOARD_H
 
 
+#include <pthread.h>
+#include <stdatomic.h>
+
 #include "../s3d/engine_object.h"
 #include "../s3d/linkedlist.h"
 #include "../s3d/render.h"
+#include "../s3d/triplebuffer.h"
+#include "../s3d/hittest.h"
 
 #include "cell.h"
 #include "player.h"
+#include "rules.h"
 
 typedef void (*GameEnd)(void * winner);
 
+//state of board changed by game, render thread reads its published copy
+typedef struct {
+    bool gameEnd;
+    Point2D line[2];
+    unsigned int geometry;  /** geometry has to be rebuilt if it differs from built one */
+    Cell_View cells[];  /** rules.width * rules.height */
+} GameBoard_View;
+
 typedef struct {
     //[engine object event]
     const E_Obj_Evts * events;
     //[data]
     Point2D position;
     GLfloat size;
+    GLfloat cell_size;
 
     Cell * cells;
-    unsigned int cell_count;
+    Rules rules;
+    HitGrid grid;   /** cells in scene coordinates */
+    int hoverCell;  /** index of cell under cursor (-1 -> none) */
 
     Player * player1;
     Player * player2;
     bool firstPlayerOnTurn;
 
+    //AI search of player on turn runs on own thread, update applies its result
+    AI * search;            /** AI of running search (NULL -> none) */
+    pthread_t searchThread;
+    atomic_bool searchDone;
+    Node searchResult;
+
     Point2D * line;
     bool gameEnd;
     GameEnd gameEndEvt;
+
+    //published render state (GameBoard_View)
+    TripleBuffer view;
+
+    //geometry built once per resize (render thread)
+    Render_Geometry tiles;          /** fills and borders of plain cells */
+    Render_Geometry symbols[2];     /** unit X and O (index = Symbol) */
+    Render_Instance * instances;    /** symbols of all cells */
+    unsigned int geometry;          /** changed by resize (update thread) */
+    unsigned int geometry_built;    /** geometry of tiles and symbols (render thread) */
 } GameBoard;
 
 /**
  * @brief GameBoard_create
  * @param x
  * @param y
- * @param size
- * @param count
+ * @param size Size of longer side of board
+ * @param rules Number of columns, rows and win length
  * @param gameEndEvt
  * @return
  */
-GameBoard * GameBoard_create(int x, int y, size_t size, unsigned int count, GameEnd gameEndEvt);
+GameBoard * GameBoard_create(int x, int y, size_t size, Rules rules, GameEnd gameEndEvt);
 
 /**
- * @brief GameBoard_destruct
+ * @brief GameBoard_destruct Waits for running AI search
  * @param board
  */
 void GameBoard_destruct(GameBoard * board);
@@ -56,17 +89,17 @@ void GameBoard_destruct(GameBoard * board);
 bool GameBoard_turn(GameBoard * board, unsigned int x, unsigned int y, Symbol symbol);
 
 /**
- * @brief GameBoard_clearGame
+ * @brief GameBoard_clearGame Start new game, waits for running AI search and drops its move
  * @param board
  */
 void GameBoard_clearGame(GameBoard * board);
 
 /**
- * @brief GameBoard_find5InLine
+ * @brief GameBoard_findWinLine Find line of rules.win_length equal symbols
  * @param board
  * @param start_end
  */
-bool GameBoard_find5InLine(GameBoard * board, Point2D * start_end);
+bool GameBoard_findWinLine(GameBoard * board, Point2D * start_end);
 
 /**
  * @brief GameBoard_setPlayers
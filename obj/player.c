@@ -1,12 +1,25 @@
 #include "player.h"
 
 #include <stdlib.h>
+#include <string.h>
+#include "../s3d/damage.h"
 
 #define BG_COLOR (Color){0.259, 0.267, 0.314, 0.600}
 #define BORDER_COLOR (Color){0.800, 0.800, 0.800, 0.500}
 #define STRING_COLOR (Color){0.900, 0.900, 0.900, 1.000}
 #define STRING_ACTIVE_COLOR (Color){0.900, 0.900, 0.100, 1.000}
 
+#define HEIGHT 70
+
+
+static void damage(Player * p) {
+    Damage_markRect(p->position.x - 2, p->position.y - 2, p->width + 4, HEIGHT + 4);
+}
+
+static int timeBarWidth(Player * p) {
+    return (p->width - 50) * MAX(1.0 - p->time / PLAYER_TIME_PER_TURN, 0.0);
+}
+
 static void destruct(void * obj) {
     Player * p = (Player*) obj;
     Player_destruct(p);
@@ -14,26 +27,27 @@ static void destruct(void * obj) {
 
 static void render(void * obj, const Event_Render * evt) {
     Player * p = (Player*) obj;
+    const Player_View * view = TripleBuffer_read(&p->view);
 
     //outline
     Render_setColor(&BG_COLOR);
-    Render_fillRectangle(&p->position, p->width, 70);
+    Render_fillRectangle(&p->position, p->width, HEIGHT);
     Render_setColor(&BORDER_COLOR);
-    Render_drawRectangle(&p->position, p->width, 70);
+    Render_drawRectangle(&p->position, p->width, HEIGHT);
 
     //color
-    if(p->active) {
+    if(view->active) {
         Render_setColor(&STRING_ACTIVE_COLOR);
     } else {
         Render_setColor(&STRING_COLOR);
     }
 
     //name
-    Render_drawString(p->position.x + 5, p->position.y + Render_getStringHeight() + 5, p->name);
+    Render_drawString(p->position.x + 5, p->position.y + Render_getStringHeight() + 5, view->name);
 
     //score
     static char buffer[255];
-    sprintf(buffer, "Score: %d", p->score);
+    sprintf(buffer, "Score: %d", view->score);
     Render_drawString(p->position.x + p->width - 90, p->position.y + Render_getStringHeight() + 5, buffer);
 
     //time
@@ -41,8 +55,8 @@ static void render(void * obj, const Event_Render * evt) {
     pt.x += 25;
     pt.y += 40;
     Render_drawRectangle(&pt, p->width - 50, 20);
-    if(p->active) {
-        float ratio = MAX(1.0 - p->time / PLAYER_TIME_PER_TURN, 0.0);
+    if(view->active) {
+        float ratio = MAX(1.0 - view->time / PLAYER_TIME_PER_TURN, 0.0);
         Color c;
         c.red = 1.0 - ratio;
         c.green = ratio;
@@ -56,13 +70,32 @@ static void render(void * obj, const Event_Render * evt) {
 static void update(void * obj, SceneData * scene, const Event_Update * evt) {
     Player * p = (Player*) obj;
     if(p->active) {
-        p->time += evt->ns_diff / 1e9;
+        int bar = timeBarWidth(p);
+        p->time += evt->s_diff + evt->ns_diff / 1e9;
+        //redraw only when bar moves by pixel
+        if(timeBarWidth(p) != bar) {
+            Damage_markRect(p->position.x + 25 - 2, p->position.y + 40 - 2, p->width - 50 + 4, 20 + 4);
+        }
         if(p->time > PLAYER_TIME_PER_TURN) {
-            if(p->timeOut) p->timeOut(p);
+            if(p->timeOut) {
+                //handler can change any object
+                Damage_markAll();
+                p->timeOut(p);
+            }
         }
     }
 }
 
+static void publish(void * obj) {
+    Player * p = (Player*) obj;
+    Player_View * view = TripleBuffer_writeBuffer(&p->view);
+    view->active = p->active;
+    view->time = p->time;
+    view->score = p->score;
+    strcpy(view->name, p->name);
+    TripleBuffer_publish(&p->view);
+}
+
 static const E_Obj_Evts e_obj_evts = {
     .destruct = destruct,
     .render = render,
@@ -71,7 +104,9 @@ static const E_Obj_Evts e_obj_evts = {
     .mouseMoveEvt = NULL,
     .mouseButtonEvt = NULL,
     .pressKeyEvt = NULL,
-    .releaseKeyEvt = NULL
+    .releaseKeyEvt = NULL,
+    .onLoad = NULL,
+    .publish = publish
 };
 
 Player * Player_create(const char * const name, unsigned int score, Player_timeOut timeOut) {
@@ -87,6 +122,10 @@ Player * Player_create(const char * const name, unsigned int score, Player_timeO
     player->ai = NULL;
     player->timeOut = timeOut;
     player->time = 0;
+    if(!TripleBuffer_init(&player->view, sizeof(Player_View))) {
+        free(player);
+        return NULL;
+    }
     player->name = malloc(sizeof(char) * PLAYER_NAME_MAX_LENGTH);
     if(name != NULL) {
         const char * c = name;
@@ -98,6 +137,8 @@ Player * Player_create(const char * const name, unsigned int score, Player_timeO
     } else {
         *player->name = 0;
     }
+    //view contains copy of name
+    publish(player);
 
     return player;
 }
@@ -107,6 +148,7 @@ void Player_destruct(Player * p) {
 
     if(p->name) free(p->name);
     if(p->ai) AI_destruct(p->ai);
+    TripleBuffer_destruct(&p->view);
     free(p);
 }
 
@@ -119,11 +161,13 @@ bool Player_setName(Player * p, const char * const name) {
         p->name[i] = *c;
     }
     p->name[i] = 0;
+    damage(p);
     return true;
 }
 
 void Player_setAI(Player * p, AI * ai) {
     if(p != NULL) {
+        if(p->ai && p->ai != ai) AI_destruct(p->ai);
         p->ai = ai;
     }
 }
@@ -132,6 +176,7 @@ void Player_activate(Player * p) {
     if(p != NULL) {
         p->active = true;
         p->time = 0.0;
+        damage(p);
     }
 }
 
@@ -139,5 +184,6 @@ void Player_deactivate(Player * p) {
     if(p != NULL) {
         p->active = false;
         p->time = 0.0;
+        damage(p);
     }
 }
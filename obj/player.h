@@ -4,12 +4,21 @@
 
 #include <stdbool.h>
 #include "ai.h"
+#include "../s3d/triplebuffer.h"
 
 #define PLAYER_NAME_MAX_LENGTH 255
 #define PLAYER_TIME_PER_TURN 5
 
 typedef void (*Player_timeOut)(void * player);
 
+//state of player changed by update thread, render thread reads its published copy
+typedef struct {
+    bool active;
+    float time;
+    unsigned int score;
+    char name[PLAYER_NAME_MAX_LENGTH];  /** copy of name, it is rewritten by Player_setName */
+} Player_View;
+
 typedef struct {
     //[engine object event]
     const E_Obj_Evts * events;
@@ -24,6 +33,8 @@ typedef struct {
     bool active;
     float time;
     Player_timeOut timeOut;
+    //published render state (Player_View)
+    TripleBuffer view;
 } Player;
 
 
@@ -51,9 +62,9 @@ void Player_destruct(Player * p);
 bool Player_setName(Player * p, const char * const name);
 
 /**
- * @brief Player_setAI
+ * @brief Player_setAI Set AI of player, player takes ownership of it, previous AI is destructed
  * @param p
- * @param ai
+ * @param ai NULL -> player is controlled by user
  */
 void Player_setAI(Player * p, AI * ai);
 
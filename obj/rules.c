@@ -0,0 +1,12 @@
+#include "rules.h"
+
+
+bool Rules_valid(Rules rules) {
+    if(rules.win_length < RULES_MIN_WIN_LENGTH || rules.win_length > RULES_MAX_WIN_LENGTH) return false;
+    if(rules.width == 0 || rules.height == 0) return false;
+    return rules.win_length <= rules.width || rules.win_length <= rules.height;
+}
+
+bool Rules_equal(Rules r1, Rules r2) {
+    return r1.width == r2.width && r1.height == r2.height && r1.win_length == r2.win_length;
+}
@@ -0,0 +1,36 @@
+#ifndef RULES_H
+#define RULES_H
+
+#include <stdbool.h>
+
+#define RULES_MIN_WIN_LENGTH 3
+#define RULES_MAX_WIN_LENGTH 6
+
+#define RULES_TICTACTOE (Rules){3, 3, 3}
+#define RULES_GOMOKU (Rules){15, 15, 5}
+#define RULES_GOMOKU_19 (Rules){19, 19, 5}
+
+//m,n,k game rules
+typedef struct {
+    unsigned int width;         /** number of columns */
+    unsigned int height;        /** number of rows */
+    unsigned int win_length;    /** symbols in line needed to win */
+} Rules;
+
+/**
+ * @brief Rules_valid Check size of board and win length
+ *        (RULES_MIN_WIN_LENGTH - RULES_MAX_WIN_LENGTH, line must fit on board)
+ * @param rules
+ * @return
+ */
+bool Rules_valid(Rules rules);
+
+/**
+ * @brief Rules_equal
+ * @param r1
+ * @param r2
+ * @return
+ */
+bool Rules_equal(Rules r1, Rules r2);
+
+#endif // RULES_H
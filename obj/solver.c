@@ -0,0 +1,523 @@
+#include "solver.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "zobrist.h"
+
+#define OPPOSITE(s) (s == Symbol_X ? Symbol_O : Symbol_X)
+
+#define CANDIDATE_RANGE 2
+#define PN_INF (UINT32_MAX / 4)
+
+#define AND_NODE_KEY 0xA5A5F00DC0FFEE11ULL
+#define ATTACKER_O_KEY 0x3C6EF372FE94F82BULL
+
+
+typedef enum {
+    THREAT_NONE, THREAT_THREE, THREAT_FOUR, THREAT_FIVE
+} Threat;
+
+typedef enum {
+    EXPAND_OPEN, EXPAND_PROVEN, EXPAND_DISPROVEN
+} Expand;
+
+typedef struct {
+    Node data[SOLVER_MAX_MOVES];
+    unsigned int count;
+} Moves;
+
+static const int DIRECTIONS[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+
+
+static bool loadBoard(Solver * solver, const Symbol * data, Rules rules, Symbol turn);
+
+static void mid(Solver * solver, bool orNode, uint32_t thpn, uint32_t thdn);
+
+static Expand expand(Solver * solver, bool orNode, Moves * moves);
+
+static Threat classify(Solver * solver, int x, int y, Symbol symbol);
+
+static void extractLine(Solver * solver, Solver_Solution * solution);
+
+static uint64_t nodeKey(const Solver * solver, uint64_t hash, bool orNode);
+
+static Solver_Entry * lookup(Solver * solver, uint64_t key);
+
+
+
+Solver * Solver_create(unsigned int table_size) {
+    if(table_size < 2) return NULL;
+
+    //round down to power of two
+    unsigned int size = 1;
+    while(size <= table_size / 2) size <<= 1;
+
+    Solver * solver = malloc(sizeof(Solver));
+    if(solver == NULL) return NULL;
+
+    solver->table = calloc(size, sizeof(Solver_Entry));
+    if(solver->table == NULL) {
+        free(solver);
+        return NULL;
+    }
+    solver->table_mask = size - 1;
+    solver->board = NULL;
+    solver->rules = (Rules){0, 0, 0};
+    solver->attacker = Symbol_None;
+    solver->hash = 0;
+    solver->nodes = 0;
+    solver->node_limit = 0;
+    solver->aborted = false;
+    solver->probes = 0;
+    solver->hits = 0;
+
+    return solver;
+}
+
+void Solver_destruct(Solver * solver) {
+    if(solver != NULL) {
+        if(solver->table) free(solver->table);
+        if(solver->board) free(solver->board);
+        free(solver);
+    }
+}
+
+bool Solver_isSharp(Solver * solver, const Symbol * data, Rules rules, Symbol turn) {
+    if(!loadBoard(solver, data, rules, turn)) return false;
+
+    int x, y;
+    for(x = 0; x < (int) rules.width; ++x) {
+        for(y = 0; y < (int) rules.height; ++y) {
+            if(solver->board[x + y * rules.width] != Symbol_None) continue;
+            if(classify(solver, x, y, turn) != THREAT_NONE) return true;
+            if(classify(solver, x, y, OPPOSITE(turn)) == THREAT_FIVE) return true;
+        }
+    }
+
+    return false;
+}
+
+Solver_Result Solver_solve(Solver * solver, const Symbol * data, Rules rules,
+                           Symbol turn, unsigned long node_limit, Solver_Solution * solution) {
+    if(solution != NULL) {
+        solution->result = Solver_Unknown;
+        solution->nodes = 0;
+        solution->probes = 0;
+        solution->hits = 0;
+        solution->line_length = 0;
+    }
+    if(!loadBoard(solver, data, rules, turn)) return Solver_Unknown;
+
+    solver->nodes = 0;
+    solver->node_limit = node_limit;
+    solver->aborted = false;
+    solver->probes = 0;
+    solver->hits = 0;
+
+    mid(solver, true, PN_INF, PN_INF);
+
+    Solver_Result result = Solver_Unknown;
+    Solver_Entry * entry = lookup(solver, nodeKey(solver, solver->hash, true));
+    if(entry != NULL) {
+        if(entry->pn == 0) result = Solver_Win;
+        else if(entry->dn == 0) result = Solver_NotWin;
+    }
+
+    if(solution != NULL) {
+        solution->result = result;
+        solution->nodes = solver->nodes;
+        solution->probes = solver->probes;
+        solution->hits = solver->hits;
+        if(result == Solver_Win) extractLine(solver, solution);
+    }
+
+    return result;
+}
+
+//###############################################################################################
+//  NODE TABLE  #################################################################################
+//###############################################################################################
+
+static uint64_t nodeKey(const Solver * solver, uint64_t hash, bool orNode) {
+    return hash ^ (solver->attacker == Symbol_O ? ATTACKER_O_KEY : 0) ^ (orNode ? 0 : AND_NODE_KEY);
+}
+
+static Solver_Entry * lookup(Solver * solver, uint64_t key) {
+    unsigned int i = key & solver->table_mask & ~1U;
+#ifdef AI_STATS
+    ++solver->probes;
+    if(solver->table[i].key == key || solver->table[i + 1].key == key) ++solver->hits;
+#endif
+    if(solver->table[i].key == key) return &solver->table[i];
+    if(solver->table[i + 1].key == key) return &solver->table[i + 1];
+    return NULL;
+}
+
+static void store(Solver * solver, uint64_t key, uint32_t pn, uint32_t dn, uint32_t work) {
+    //two entries per bucket: first keeps the most expensive node, second is always replaced
+    unsigned int i = key & solver->table_mask & ~1U;
+    Solver_Entry * entry;
+    if(solver->table[i].key == key) {
+        entry = &solver->table[i];
+    } else if(solver->table[i + 1].key == key) {
+        entry = &solver->table[i + 1];
+    } else if(work >= solver->table[i].work) {
+        solver->table[i + 1] = solver->table[i];
+        entry = &solver->table[i];
+    } else {
+        entry = &solver->table[i + 1];
+    }
+
+    entry->key = key;
+    entry->pn = pn;
+    entry->dn = dn;
+    entry->work = work;
+}
+
+//###############################################################################################
+//  DF-PN  ######################################################################################
+//###############################################################################################
+
+static uint32_t addSat(uint32_t a, uint32_t b) {
+    uint64_t sum = (uint64_t) a + b;
+    return sum >= PN_INF ? PN_INF : (uint32_t) sum;
+}
+
+static void mid(Solver * solver, bool orNode, uint32_t thpn, uint32_t thdn) {
+    uint64_t key = nodeKey(solver, solver->hash, orNode);
+    unsigned long start = solver->nodes;
+
+    if(solver->node_limit != 0 && solver->nodes >= solver->node_limit) {
+        solver->aborted = true;
+        return;
+    }
+    ++solver->nodes;
+
+    Moves moves;
+    switch(expand(solver, orNode, &moves)) {
+    case EXPAND_PROVEN:
+        store(solver, key, 0, PN_INF, 1);
+        return;
+    case EXPAND_DISPROVEN:
+        store(solver, key, PN_INF, 0, 1);
+        return;
+    default:
+        break;
+    }
+
+    Symbol turn = orNode ? solver->attacker : OPPOSITE(solver->attacker);
+    uint32_t pn = 1, dn = 1;
+    uint32_t cpn, cdn, best_pn, best_dn, second;
+    unsigned int best, i, index;
+    Solver_Entry * entry;
+
+    for(;;) {
+        //collect proof and disproof numbers of children
+        pn = orNode ? PN_INF : 0;
+        dn = orNode ? 0 : PN_INF;
+        best = 0;
+        best_pn = best_dn = second = PN_INF;
+        for(i = 0; i < moves.count; ++i) {
+            index = moves.data[i].x + moves.data[i].y * solver->rules.width;
+            entry = lookup(solver, nodeKey(solver, solver->hash ^ Zobrist_key(index, turn), !orNode));
+            cpn = entry ? entry->pn : 1;
+            cdn = entry ? entry->dn : 1;
+            if(orNode) {
+                dn = addSat(dn, cdn);
+                if(cpn < best_pn) {
+                    second = best_pn;
+                    best_pn = cpn;
+                    best_dn = cdn;
+                    best = i;
+                } else if(cpn < second) {
+                    second = cpn;
+                }
+            } else {
+                pn = addSat(pn, cpn);
+                if(cdn < best_dn) {
+                    second = best_dn;
+                    best_pn = cpn;
+                    best_dn = cdn;
+                    best = i;
+                } else if(cdn < second) {
+                    second = cdn;
+                }
+            }
+        }
+        if(orNode) {
+            pn = best_pn;
+        } else {
+            dn = best_dn;
+        }
+
+        if(pn >= thpn || dn >= thdn || solver->aborted) break;
+
+        //descend into most proving child
+        uint32_t child_thpn, child_thdn;
+        if(orNode) {
+            child_thpn = MIN(thpn, second + 1);
+            child_thdn = addSat(thdn - dn, best_dn);
+        } else {
+            child_thpn = addSat(thpn - pn, best_pn);
+            child_thdn = MIN(thdn, second + 1);
+        }
+
+        index = moves.data[best].x + moves.data[best].y * solver->rules.width;
+        solver->board[index] = turn;
+        solver->hash ^= Zobrist_key(index, turn);
+        mid(solver, !orNode, child_thpn, child_thdn);
+        solver->hash ^= Zobrist_key(index, turn);
+        solver->board[index] = Symbol_None;
+    }
+
+    unsigned long work = solver->nodes - start;
+    store(solver, key, pn, dn, work > UINT32_MAX ? UINT32_MAX : work);
+}
+
+//###############################################################################################
+//  THREATS  ####################################################################################
+//###############################################################################################
+
+static bool loadBoard(Solver * solver, const Symbol * data, Rules rules, Symbol turn) {
+    if(solver == NULL || data == NULL || !Rules_valid(rules) || turn == Symbol_None) return false;
+
+    unsigned int size = rules.width * rules.height;
+    if(solver->board == NULL || solver->rules.width * solver->rules.height != size) {
+        Symbol * board = realloc(solver->board, sizeof(Symbol) * size);
+        if(board == NULL) return false;
+        solver->board = board;
+    }
+    memcpy(solver->board, data, sizeof(Symbol) * size);
+    solver->rules = rules;
+    solver->attacker = turn;
+    //entries of different rules must not collide
+    solver->hash = Zobrist_hash(solver->board, size) ^
+            ((uint64_t) rules.width << 40 | (uint64_t) rules.height << 16 | rules.win_length);
+
+    return true;
+}
+
+#define INSIDE(solver, x, y) (x >= 0 && y >= 0 && x < (int) solver->rules.width && y < (int) solver->rules.height)
+#define WIN_LENGTH ((int) solver->rules.win_length)
+
+static int run(const Solver * solver, int x, int y, int dx, int dy, Symbol symbol) {
+    int n = 0;
+    for(x += dx, y += dy; INSIDE(solver, x, y); x += dx, y += dy) {
+        if(solver->board[x + y * solver->rules.width] != symbol) break;
+        ++n;
+    }
+    return n;
+}
+
+static bool makesFiveDir(const Solver * solver, int x, int y, int dx, int dy, Symbol symbol) {
+    return 1 + run(solver, x, y, dx, dy, symbol) + run(solver, x, y, -dx, -dy, symbol) >= WIN_LENGTH;
+}
+
+/**
+ * Number of empty cells on the line through [x, y] that complete five for symbol
+ */
+static int fiveSquares(const Solver * solver, int x, int y, int dx, int dy, Symbol symbol) {
+    int n = 0;
+    int nx, ny;
+    for(int offset = -(WIN_LENGTH - 1); offset <= WIN_LENGTH - 1; ++offset) {
+        nx = x + offset * dx;
+        ny = y + offset * dy;
+        if(!INSIDE(solver, nx, ny)) continue;
+        if(solver->board[nx + ny * solver->rules.width] != Symbol_None) continue;
+        if(makesFiveDir(solver, nx, ny, dx, dy, symbol)) ++n;
+    }
+    return n;
+}
+
+/**
+ * Threat created by placing symbol on empty cell [x, y]
+ */
+static Threat classify(Solver * solver, int x, int y, Symbol symbol) {
+    int d, offset, nx, ny;
+    unsigned int index = x + y * solver->rules.width;
+    Threat threat = THREAT_NONE;
+
+    for(d = 0; d < 4; ++d) {
+        if(makesFiveDir(solver, x, y, DIRECTIONS[d][0], DIRECTIONS[d][1], symbol)) return THREAT_FIVE;
+    }
+
+    solver->board[index] = symbol;
+
+    for(d = 0; d < 4 && threat == THREAT_NONE; ++d) {
+        if(fiveSquares(solver, x, y, DIRECTIONS[d][0], DIRECTIONS[d][1], symbol) > 0) threat = THREAT_FOUR;
+    }
+
+    //open three -> one more move makes four with two winning squares
+    for(d = 0; d < 4 && threat == THREAT_NONE; ++d) {
+        for(offset = -(WIN_LENGTH - 2); offset <= WIN_LENGTH - 2; ++offset) {
+            nx = x + offset * DIRECTIONS[d][0];
+            ny = y + offset * DIRECTIONS[d][1];
+            if(!INSIDE(solver, nx, ny)) continue;
+            if(solver->board[nx + ny * solver->rules.width] != Symbol_None) continue;
+            solver->board[nx + ny * solver->rules.width] = symbol;
+            if(fiveSquares(solver, nx, ny, DIRECTIONS[d][0], DIRECTIONS[d][1], symbol) >= 2) threat = THREAT_THREE;
+            solver->board[nx + ny * solver->rules.width] = Symbol_None;
+            if(threat != THREAT_NONE) break;
+        }
+    }
+
+    solver->board[index] = Symbol_None;
+    return threat;
+}
+
+static bool nearStone(const Solver * solver, int x, int y) {
+    for(int i = -CANDIDATE_RANGE; i <= CANDIDATE_RANGE; ++i) {
+        if(x + i < 0) continue;
+        if(x + i >= (int) solver->rules.width) break;
+        for(int j = -CANDIDATE_RANGE; j <= CANDIDATE_RANGE; ++j) {
+            if(y + j < 0) continue;
+            if(y + j >= (int) solver->rules.height) break;
+            if(solver->board[x + i + (y + j) * solver->rules.width] != Symbol_None) return true;
+        }
+    }
+    return false;
+}
+
+static bool addMove(Moves * moves, int x, int y) {
+    if(moves->count >= SOLVER_MAX_MOVES) return false;
+    moves->data[moves->count].x = x;
+    moves->data[moves->count].y = y;
+    ++moves->count;
+    return true;
+}
+
+/**
+ * OR node (attacker to move): win by five, block a four of the defender or play a threat.
+ * AND node (defender to move): block the five, or answer an open three by occupying
+ * a four square of the attacker or by own four. Attacker without threat lost the initiative.
+ */
+static Expand expand(Solver * solver, bool orNode, Moves * moves) {
+    Symbol attacker = solver->attacker;
+    Symbol defender = OPPOSITE(attacker);
+    Symbol turn = orNode ? attacker : defender;
+    Symbol other = OPPOSITE(turn);
+
+    Moves blocks;
+    blocks.count = 0;
+    moves->count = 0;
+
+    int x, y;
+    Symbol * cell;
+
+    //fives of both sides
+    for(y = 0; y < (int) solver->rules.height; ++y) {
+        for(x = 0; x < (int) solver->rules.width; ++x) {
+            cell = &solver->board[x + y * solver->rules.width];
+            if(*cell != Symbol_None || !nearStone(solver, x, y)) continue;
+            for(int d = 0; d < 4; ++d) {
+                if(makesFiveDir(solver, x, y, DIRECTIONS[d][0], DIRECTIONS[d][1], turn)) {
+                    if(orNode) {
+                        addMove(moves, x, y);
+                        return EXPAND_PROVEN;
+                    }
+                    return EXPAND_DISPROVEN;
+                }
+            }
+            for(int d = 0; d < 4; ++d) {
+                if(makesFiveDir(solver, x, y, DIRECTIONS[d][0], DIRECTIONS[d][1], other)) {
+                    addMove(&blocks, x, y);
+                    break;
+                }
+            }
+        }
+    }
+
+    if(blocks.count > 0) {
+        if(orNode && blocks.count > 1) return EXPAND_DISPROVEN;
+        *moves = blocks;
+        return EXPAND_OPEN;
+    }
+
+    bool threatened = false;
+    Threat threat;
+    for(y = 0; y < (int) solver->rules.height; ++y) {
+        for(x = 0; x < (int) solver->rules.width; ++x) {
+            cell = &solver->board[x + y * solver->rules.width];
+            if(*cell != Symbol_None || !nearStone(solver, x, y)) continue;
+
+            if(orNode) {
+                if(classify(solver, x, y, attacker) != THREAT_NONE) {
+                    if(!addMove(moves, x, y)) return EXPAND_OPEN;
+                }
+                continue;
+            }
+
+            //defender: four squares of attacker and own fours
+            threat = classify(solver, x, y, attacker);
+            bool own_four = classify(solver, x, y, defender) >= THREAT_FOUR;
+            if(threat < THREAT_FOUR && !own_four) continue;
+            if(threat == THREAT_FOUR) {
+                //straight four square -> attacker has open three
+                *cell = attacker;
+                for(int d = 0; d < 4 && !threatened; ++d) {
+                    if(fiveSquares(solver, x, y, DIRECTIONS[d][0], DIRECTIONS[d][1], attacker) >= 2) {
+                        threatened = true;
+                    }
+                }
+                *cell = Symbol_None;
+            }
+            //defence can not be cut, incomplete move list would prove false wins
+            if(!addMove(moves, x, y)) return EXPAND_DISPROVEN;
+        }
+    }
+
+    if(moves->count == 0) return EXPAND_DISPROVEN;
+    if(!orNode && !threatened) return EXPAND_DISPROVEN;
+
+    return EXPAND_OPEN;
+}
+
+static void extractLine(Solver * solver, Solver_Solution * solution) {
+    bool orNode = true;
+    Moves moves;
+    Symbol turn;
+    Solver_Entry * entry;
+    unsigned int i, index;
+    int best;
+    uint32_t best_work;
+
+    while(solution->line_length < SOLVER_MAX_LINE) {
+        Expand state = expand(solver, orNode, &moves);
+        if(state == EXPAND_PROVEN) {
+            solution->line[solution->line_length++] = moves.data[0];
+            break;
+        }
+        if(state == EXPAND_DISPROVEN) break;
+
+        //OR node: any proven child, AND node: the longest defence
+        turn = orNode ? solver->attacker : OPPOSITE(solver->attacker);
+        best = -1;
+        best_work = 0;
+        for(i = 0; i < moves.count; ++i) {
+            index = moves.data[i].x + moves.data[i].y * solver->rules.width;
+            entry = lookup(solver, nodeKey(solver, solver->hash ^ Zobrist_key(index, turn), !orNode));
+            if(entry == NULL || entry->pn != 0) continue;
+            if(best < 0 || entry->work > best_work) {
+                best = i;
+                best_work = entry->work;
+            }
+            if(orNode) break;
+        }
+        if(best < 0) break;
+
+        index = moves.data[best].x + moves.data[best].y * solver->rules.width;
+        solver->board[index] = turn;
+        solver->hash ^= Zobrist_key(index, turn);
+        solution->line[solution->line_length++] = moves.data[best];
+        orNode = !orNode;
+    }
+
+    //restore board
+    for(i = solution->line_length; i > 0; --i) {
+        index = solution->line[i - 1].x + solution->line[i - 1].y * solver->rules.width;
+        if(solver->board[index] != Symbol_None) {
+            solver->hash ^= Zobrist_key(index, solver->board[index]);
+            solver->board[index] = Symbol_None;
+        }
+    }
+}
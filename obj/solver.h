@@ -0,0 +1,98 @@
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ai.h"
+
+#define SOLVER_DEFAULT_TABLE_SIZE (1 << 18)
+#define SOLVER_MAX_MOVES 128
+#define SOLVER_MAX_LINE 128
+
+typedef enum {
+    Solver_Unknown,     /** node limit reached before the position was solved */
+    Solver_Win,         /** forced win for the side to move */
+    Solver_NotWin       /** no forced win by continuous threats */
+} Solver_Result;
+
+//entry of node table
+typedef struct {
+    uint64_t key;
+    uint32_t pn;
+    uint32_t dn;
+    uint32_t work;
+} Solver_Entry;
+
+/**
+ * Depth-first proof-number (df-pn) solver. The attacker may only play
+ * threats (five, four, open three; named for k = 5, four means one symbol
+ * missing to the win line), the defender answers with the moves that can
+ * stop them, so a proven win is a forced win by continuous threats.
+ * Node table is bounded, entries are replaced by amount of work.
+ */
+typedef struct _Solver {
+    Solver_Entry * table;
+    unsigned int table_mask;
+
+    Symbol * board;
+    Rules rules;
+    Symbol attacker;
+    uint64_t hash;
+
+    unsigned long nodes;
+    unsigned long node_limit;
+    bool aborted;
+
+    //node table statistics (counted only with AI_STATS)
+    unsigned long probes;
+    unsigned long hits;
+} Solver;
+
+//result of search
+typedef struct {
+    Solver_Result result;
+    unsigned long nodes;
+    unsigned long probes;       /** node table probes (AI_STATS) */
+    unsigned long hits;         /** node table hits (AI_STATS) */
+    Node line[SOLVER_MAX_LINE]; /** winning line, moves of both sides starting with the attacker */
+    unsigned int line_length;
+} Solver_Solution;
+
+/**
+ * @brief Solver_create
+ * @param table_size Number of entries of node table (rounded down to power of two)
+ * @return
+ */
+Solver * Solver_create(unsigned int table_size);
+
+/**
+ * @brief Solver_destruct
+ * @param solver
+ */
+void Solver_destruct(Solver * solver);
+
+/**
+ * @brief Solver_isSharp Check if the side to move can start a threat sequence
+ *        or has to answer a four of the opponent
+ * @param solver
+ * @param data Board data (width * height)
+ * @param rules Size of board and win length
+ * @param turn Side to move
+ * @return
+ */
+bool Solver_isSharp(Solver * solver, const Symbol * data, Rules rules, Symbol turn);
+
+/**
+ * @brief Solver_solve Prove or disprove forced win for the side to move
+ * @param solver
+ * @param data Board data (width * height)
+ * @param rules Size of board and win length
+ * @param turn Side to move
+ * @param node_limit Maximum number of expanded nodes (0 -> unlimited)
+ * @param solution Result of search
+ * @return
+ */
+Solver_Result Solver_solve(Solver * solver, const Symbol * data, Rules rules,
+                           Symbol turn, unsigned long node_limit, Solver_Solution * solution);
+
+#endif // SOLVER_H
@@ -0,0 +1,22 @@
+#include "zobrist.h"
+
+
+uint64_t Zobrist_key(unsigned int index, Symbol symbol) {
+    if(symbol == Symbol_None) return 0;
+
+    //splitmix64 finalizer
+    uint64_t z = ((uint64_t) index << 1 | (symbol == Symbol_O)) + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t Zobrist_hash(const Symbol * data, unsigned int size) {
+    if(data == NULL) return 0;
+
+    uint64_t hash = 0;
+    for(unsigned int i = 0; i < size; ++i) {
+        hash ^= Zobrist_key(i, data[i]);
+    }
+    return hash;
+}
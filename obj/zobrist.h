@@ -0,0 +1,25 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <stdint.h>
+#include "cell.h"
+
+/**
+ * @brief Zobrist_key Key of one symbol placed on cell with specified index.
+ *        Keys are derived from index and symbol, so no table is needed and
+ *        boards of any size share the same key space.
+ * @param index Index of cell (x + y * width)
+ * @param symbol Symbol on cell (Symbol_None -> 0)
+ * @return
+ */
+uint64_t Zobrist_key(unsigned int index, Symbol symbol);
+
+/**
+ * @brief Zobrist_hash Full hash of the board, XOR of all cell keys
+ * @param data Board data
+ * @param size Number of cells
+ * @return
+ */
+uint64_t Zobrist_hash(const Symbol * data, unsigned int size);
+
+#endif // ZOBRIST_H
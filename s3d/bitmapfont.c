@@ -0,0 +1,940 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    bitmapfont.c
+ * @brief   Implementation of bitmapfont.h
+ *
+ *          Glyph tables are generated from bitmap fonts of freeglut,
+ *          which are derived from X11 fonts (X Consortium license)
+ * <------------------------------------------------------------------>
+ */
+
+#include "bitmapfont.h"
+
+#include <stddef.h>
+#include "render.h"
+
+
+//-adobe-helvetica-medium-r-normal--18-180-75-75-p-98-iso8859-1
+static const unsigned short HELVETICA_18_OFFSETS[BITMAPFONT_GLYPHS] = {
+    0, 24, 48, 72, 119, 166, 213, 260, 284, 308, 332, 356, 403, 427, 474, 498,
+    522, 569, 616, 663, 710, 757, 804, 851, 898, 945, 992, 1016, 1040, 1087, 1134, 1181,
+    1228, 1298, 1345, 1392, 1439, 1486, 1533, 1580, 1627, 1674, 1698, 1745, 1792, 1839, 1886, 1933,
+    1980, 2027, 2074, 2121, 2168, 2215, 2262, 2309, 2379, 2426, 2473, 2520, 2544, 2568, 2592, 2639,
+    2686, 2710, 2757, 2804, 2851, 2898, 2945, 2969, 3016, 3063, 3087, 3111, 3158, 3182, 3229, 3276,
+    3323, 3370, 3417, 3441, 3488, 3512, 3559, 3606, 3653, 3700, 3747, 3794, 3818, 3842, 3866
+};
+static const unsigned char HELVETICA_18_DATA[3913] = {
+    5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6,0,0,0,0,0,48,48,0,0,32,32,48,48,48,48,48,48,48,48,0,0,0,0,
+    5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,144,216,216,216,0,0,0,0,
+    10,0,0,0,0,0,0,0,0,0,0,36,0,36,0,36,0,255,128,255,128,18,0,18,
+    0,18,0,127,192,127,192,9,0,9,0,9,0,0,0,0,0,0,0,0,0,0,0,10,
+    0,0,0,0,0,0,4,0,4,0,31,0,63,128,117,192,100,192,4,192,7,128,31,0,
+    60,0,116,0,100,0,101,128,63,128,31,0,4,0,0,0,0,0,0,0,0,0,16,0,
+    0,0,0,0,0,0,0,0,0,12,60,12,126,6,102,6,102,3,126,3,60,1,128,61,
+    128,126,192,102,192,102,96,126,96,60,48,0,0,0,0,0,0,0,0,0,0,13,0,0,
+    0,0,0,0,0,0,0,0,30,56,63,112,115,224,97,192,97,224,99,96,119,96,62,0,
+    30,0,51,0,51,0,63,0,30,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,64,32,32,96,96,0,0,0,0,6,0,8,24,
+    48,48,96,96,96,96,96,96,96,96,96,96,48,48,24,8,0,0,0,0,6,0,64,96,
+    48,48,24,24,24,24,24,24,24,24,24,24,48,48,96,64,0,0,0,0,7,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,68,56,56,124,16,16,0,0,0,0,10,0,0,0,
+    0,0,0,0,0,0,0,12,0,12,0,12,0,12,0,127,128,127,128,12,0,12,0,12,
+    0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,64,32,
+    32,96,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,128,127,128,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,
+    96,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,
+    192,192,64,64,96,96,32,32,48,48,16,16,24,24,0,0,0,0,10,0,0,0,0,0,
+    0,0,0,0,0,30,0,63,0,51,0,97,128,97,128,97,128,97,128,97,128,97,128,97,
+    128,51,0,63,0,30,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,
+    0,0,0,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,
+    62,0,62,0,6,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+    0,0,0,127,128,127,128,96,0,112,0,56,0,28,0,14,0,7,0,3,128,1,128,97,
+    128,127,0,30,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,
+    0,0,30,0,63,0,99,128,97,128,1,128,3,128,15,0,14,0,3,0,97,128,97,128,
+    63,0,30,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,
+    0,1,128,1,128,1,128,127,192,127,192,97,128,49,128,25,128,25,128,13,128,7,128,3,
+    128,1,128,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,
+    62,0,127,0,99,128,97,128,1,128,1,128,99,128,127,0,126,0,96,0,96,0,127,0,
+    127,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,30,
+    0,63,0,113,128,97,128,97,128,97,128,127,0,110,0,96,0,96,0,49,128,63,128,30,
+    0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,48,0,
+    48,0,24,0,24,0,24,0,12,0,12,0,6,0,6,0,3,0,1,128,127,128,127,128,
+    0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,30,0,63,
+    0,115,128,97,128,97,128,51,0,63,0,51,0,97,128,97,128,115,128,63,0,30,0,0,
+    0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,62,0,127,0,
+    99,0,1,128,1,128,29,128,63,128,97,128,97,128,97,128,99,128,63,0,30,0,0,0,
+    0,0,0,0,0,0,0,0,5,0,0,0,0,0,96,96,0,0,0,0,0,0,96,96,
+    0,0,0,0,0,0,0,0,5,0,0,64,32,32,96,96,0,0,0,0,0,0,96,96,
+    0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,1,128,7,128,30,
+    0,56,0,96,0,56,0,30,0,7,128,1,128,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,128,
+    63,128,0,0,0,0,63,128,63,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,96,0,120,0,30,0,7,
+    0,1,128,7,0,30,0,120,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,24,0,24,0,0,0,0,0,
+    24,0,24,0,24,0,28,0,14,0,7,0,99,0,99,0,127,0,62,0,0,0,0,0,
+    0,0,0,0,18,0,0,0,0,0,0,3,240,0,15,248,0,28,0,0,56,0,0,51,
+    184,0,103,252,0,102,102,0,102,51,0,102,51,0,102,49,128,99,25,128,51,185,128,49,
+    217,128,24,3,0,14,7,0,7,254,0,1,248,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,12,0,0,0,0,0,0,0,0,0,0,192,48,192,48,96,96,96,96,127,224,63,
+    192,48,192,48,192,25,128,25,128,15,0,15,0,6,0,6,0,0,0,0,0,0,0,0,
+    0,13,0,0,0,0,0,0,0,0,0,0,127,192,127,224,96,112,96,48,96,48,96,112,
+    127,224,127,192,96,192,96,96,96,96,96,224,127,192,127,128,0,0,0,0,0,0,0,0,
+    14,0,0,0,0,0,0,0,0,0,0,7,192,31,240,56,56,48,24,112,0,96,0,96,
+    0,96,0,96,0,112,0,48,24,56,56,31,240,7,192,0,0,0,0,0,0,0,0,13,
+    0,0,0,0,0,0,0,0,0,0,127,128,127,192,96,224,96,96,96,48,96,48,96,48,
+    96,48,96,48,96,48,96,96,96,224,127,192,127,128,0,0,0,0,0,0,0,0,11,0,
+    0,0,0,0,0,0,0,0,0,127,192,127,192,96,0,96,0,96,0,96,0,127,128,127,
+    128,96,0,96,0,96,0,96,0,127,192,127,192,0,0,0,0,0,0,0,0,11,0,0,
+    0,0,0,0,0,0,0,0,96,0,96,0,96,0,96,0,96,0,96,0,127,128,127,128,
+    96,0,96,0,96,0,96,0,127,192,127,192,0,0,0,0,0,0,0,0,14,0,0,0,
+    0,0,0,0,0,0,0,7,216,31,248,56,56,48,24,112,24,96,248,96,248,96,0,96,
+    0,112,24,48,24,56,56,31,240,7,192,0,0,0,0,0,0,0,0,13,0,0,0,0,
+    0,0,0,0,0,0,96,48,96,48,96,48,96,48,96,48,96,48,127,240,127,240,96,48,
+    96,48,96,48,96,48,96,48,96,48,0,0,0,0,0,0,0,0,6,0,0,0,0,0,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,0,0,0,10,0,0,0,0,0,
+    0,0,0,0,0,30,0,63,0,115,128,97,128,97,128,1,128,1,128,1,128,1,128,1,
+    128,1,128,1,128,1,128,1,128,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,
+    0,0,0,0,96,56,96,112,96,224,97,192,99,128,103,0,126,0,124,0,110,0,103,0,
+    99,128,97,192,96,224,96,112,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+    0,0,0,127,128,127,128,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,
+    0,96,0,96,0,96,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,
+    0,0,97,134,97,134,99,198,98,70,102,102,102,102,108,54,108,54,120,30,120,30,112,14,
+    112,14,96,6,96,6,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,
+    0,96,48,96,112,96,240,96,240,97,176,99,48,99,48,102,48,102,48,108,48,120,48,120,
+    48,112,48,96,48,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,0,0,
+    7,192,31,240,56,56,48,24,112,28,96,12,96,12,96,12,96,12,112,28,48,24,56,56,
+    31,240,7,192,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,96,
+    0,96,0,96,0,96,0,96,0,96,0,127,128,127,192,96,224,96,96,96,96,96,224,127,
+    192,127,128,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,0,24,7,216,
+    31,240,56,120,48,216,112,220,96,12,96,12,96,12,96,12,112,28,48,24,56,56,31,240,
+    7,192,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,96,96,96,
+    96,96,96,96,96,96,192,96,192,127,128,127,192,96,224,96,96,96,96,96,224,127,192,127,
+    128,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,31,128,63,224,
+    112,112,96,48,0,48,0,112,1,224,15,128,62,0,112,0,96,48,112,112,63,224,15,128,
+    0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,6,0,6,0,6,
+    0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,127,224,127,224,0,
+    0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,15,128,63,224,48,96,
+    96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,0,0,
+    0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,3,0,7,128,7,128,12,
+    192,12,192,12,192,24,96,24,96,24,96,48,48,48,48,48,48,96,24,96,24,0,0,0,
+    0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,12,0,
+    12,12,0,14,28,0,26,22,0,27,54,0,27,54,0,51,51,0,51,51,0,49,35,0,
+    49,227,0,97,225,128,96,193,128,96,193,128,96,193,128,0,0,0,0,0,0,0,0,0,
+    0,0,0,13,0,0,0,0,0,0,0,0,0,0,96,48,112,112,48,96,56,224,24,192,
+    13,128,7,0,7,0,13,128,24,192,56,224,48,96,112,112,96,48,0,0,0,0,0,0,
+    0,0,14,0,0,0,0,0,0,0,0,0,0,3,0,3,0,3,0,3,0,3,0,3,
+    0,7,128,12,192,24,96,24,96,48,48,48,48,96,24,96,24,0,0,0,0,0,0,0,
+    0,12,0,0,0,0,0,0,0,0,0,0,127,224,127,224,96,0,48,0,24,0,12,0,
+    14,0,6,0,3,0,1,128,0,192,0,96,127,224,127,224,0,0,0,0,0,0,0,0,
+    5,0,120,120,96,96,96,96,96,96,96,96,96,96,96,96,96,96,120,120,0,0,0,0,
+    5,0,0,0,0,0,24,24,16,16,48,48,32,32,96,96,64,64,192,192,0,0,0,0,
+    5,0,240,240,48,48,48,48,48,48,48,48,48,48,48,48,48,48,240,240,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,65,0,99,0,54,0,28,0,8,0,0,0,0,0,0,0,0,0,0,0,10,
+    0,0,255,192,255,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,96,96,64,64,32,0,0,0,0,9,0,
+    0,0,0,0,0,0,0,0,0,59,0,119,0,99,0,99,0,115,0,63,0,7,0,99,
+    0,119,0,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,
+    0,0,0,0,0,0,0,0,111,0,127,128,113,128,96,192,96,192,96,192,96,192,113,128,
+    127,128,111,0,96,0,96,0,96,0,96,0,0,0,0,0,0,0,0,0,10,0,0,0,
+    0,0,0,0,0,0,0,31,0,63,128,49,128,96,0,96,0,96,0,96,0,49,128,63,
+    128,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,
+    0,0,0,0,0,0,30,192,63,192,49,192,96,192,96,192,96,192,96,192,49,192,63,192,
+    30,192,0,192,0,192,0,192,0,192,0,0,0,0,0,0,0,0,10,0,0,0,0,0,
+    0,0,0,0,0,30,0,63,128,113,128,96,0,96,0,127,128,97,128,97,128,63,0,30,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,48,
+    48,48,48,48,48,48,48,252,252,48,48,60,28,0,0,0,0,11,0,0,14,0,63,128,
+    49,128,0,192,30,192,63,192,49,192,96,192,96,192,96,192,96,192,48,192,63,192,30,192,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,
+    0,0,0,97,128,97,128,97,128,97,128,97,128,97,128,97,128,113,128,111,128,103,0,96,
+    0,96,0,96,0,96,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,96,96,96,
+    96,96,96,96,96,96,96,0,0,96,96,0,0,0,0,4,0,192,224,96,96,96,96,96,
+    96,96,96,96,96,96,96,0,0,96,96,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    0,0,99,128,99,0,103,0,102,0,108,0,124,0,120,0,108,0,102,0,99,0,96,0,
+    96,0,96,0,96,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,96,96,96,96,
+    96,96,96,96,96,96,96,96,96,96,0,0,0,0,14,0,0,0,0,0,0,0,0,0,
+    0,99,24,99,24,99,24,99,24,99,24,99,24,99,24,115,152,111,120,102,48,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,
+    97,128,97,128,97,128,97,128,97,128,97,128,97,128,113,128,111,128,103,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,31,
+    0,63,128,49,128,96,192,96,192,96,192,96,192,49,128,63,128,31,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,11,0,0,96,0,96,0,96,0,96,0,111,0,
+    127,128,113,128,96,192,96,192,96,192,96,192,113,128,127,128,111,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,11,0,0,0,192,0,192,0,192,0,192,30,192,63,
+    192,49,192,96,192,96,192,96,192,96,192,49,192,63,192,30,192,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,96,96,96,96,96,96,96,112,108,
+    108,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,60,0,126,0,
+    99,0,3,0,31,0,126,0,96,0,99,0,63,0,30,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,6,0,0,0,0,0,24,56,48,48,48,48,48,48,252,252,
+    48,48,48,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,57,128,125,128,99,
+    128,97,128,97,128,97,128,97,128,97,128,97,128,97,128,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,12,0,12,0,30,0,
+    18,0,51,0,51,0,51,0,97,128,97,128,97,128,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,12,192,12,192,28,224,20,
+    160,52,176,51,48,51,48,99,24,99,24,99,24,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,97,128,115,128,51,0,30,0,
+    12,0,12,0,30,0,51,0,115,128,97,128,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,10,0,0,56,0,56,0,12,0,12,0,12,0,12,0,30,0,18,0,51,
+    0,51,0,51,0,97,128,97,128,97,128,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,0,0,127,0,127,0,96,0,48,0,24,0,
+    12,0,6,0,3,0,127,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,6,0,12,24,48,48,48,48,48,48,96,192,96,48,48,48,48,48,24,12,0,0,
+    0,0,4,0,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,0,0,
+    0,0,6,0,192,96,48,48,48,48,48,48,24,12,24,48,48,48,48,48,96,192,0,0,
+    0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,0,63,
+    0,25,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0
+};
+
+//-adobe-helvetica-medium-r-normal--12-120-75-75-p-67-iso8859-1
+static const unsigned short HELVETICA_12_OFFSETS[BITMAPFONT_GLYPHS] = {
+    0, 17, 34, 51, 68, 85, 118, 151, 168, 185, 202, 219, 236, 253, 270, 287,
+    304, 321, 338, 355, 372, 389, 406, 423, 440, 457, 474, 491, 508, 525, 542, 559,
+    576, 609, 642, 659, 692, 725, 742, 759, 792, 825, 842, 859, 876, 893, 926, 959,
+    992, 1009, 1042, 1059, 1076, 1093, 1110, 1143, 1176, 1209, 1242, 1275, 1292, 1309, 1326, 1343,
+    1360, 1377, 1394, 1411, 1428, 1445, 1462, 1479, 1496, 1513, 1530, 1547, 1564, 1581, 1614, 1631,
+    1648, 1665, 1682, 1699, 1716, 1733, 1750, 1767, 1800, 1817, 1834, 1851, 1868, 1885, 1902
+};
+static const unsigned char HELVETICA_12_DATA[1919] = {
+    4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,64,0,
+    64,64,64,64,64,64,64,0,0,0,5,0,0,0,0,0,0,0,0,0,0,80,80,80,
+    0,0,0,7,0,0,0,0,80,80,80,252,40,252,40,40,0,0,0,0,7,0,0,0,
+    16,56,84,84,20,56,80,84,56,16,0,0,0,11,0,0,0,0,0,0,0,0,17,128,
+    10,64,10,64,9,128,4,0,52,0,74,0,74,0,49,0,0,0,0,0,0,0,9,0,
+    0,0,0,0,0,0,0,57,0,70,0,66,0,69,0,40,0,24,0,36,0,36,0,24,
+    0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,64,32,96,0,0,0,
+    4,0,16,32,32,64,64,64,64,64,64,32,32,16,0,0,0,4,0,128,64,64,32,32,
+    32,32,32,32,64,64,128,0,0,0,5,0,0,0,0,0,0,0,0,0,0,80,32,80,
+    0,0,0,7,0,0,0,0,0,16,16,124,16,16,0,0,0,0,0,0,4,0,0,64,
+    32,32,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,124,0,0,
+    0,0,0,0,0,0,3,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,4,
+    0,0,0,0,128,128,64,64,64,32,32,16,16,0,0,0,7,0,0,0,0,56,68,68,
+    68,68,68,68,68,56,0,0,0,7,0,0,0,0,16,16,16,16,16,16,16,112,16,0,
+    0,0,7,0,0,0,0,124,64,64,32,16,8,4,68,56,0,0,0,7,0,0,0,0,
+    56,68,68,4,4,24,4,68,56,0,0,0,7,0,0,0,0,8,8,252,136,72,40,40,
+    24,8,0,0,0,7,0,0,0,0,56,68,68,4,4,120,64,64,124,0,0,0,7,0,
+    0,0,0,56,68,68,68,100,88,64,68,56,0,0,0,7,0,0,0,0,32,32,16,16,
+    16,8,8,4,124,0,0,0,7,0,0,0,0,56,68,68,68,68,56,68,68,56,0,0,
+    0,7,0,0,0,0,56,68,4,4,60,68,68,68,56,0,0,0,3,0,0,0,0,64,
+    0,0,0,0,64,0,0,0,0,0,0,3,0,0,128,64,64,0,0,0,0,64,0,0,
+    0,0,0,0,7,0,0,0,0,0,12,48,192,48,12,0,0,0,0,0,0,7,0,0,
+    0,0,0,0,124,0,124,0,0,0,0,0,0,0,7,0,0,0,0,0,96,24,6,24,
+    96,0,0,0,0,0,0,7,0,0,0,0,16,0,16,16,8,8,68,68,56,0,0,0,
+    12,0,0,0,0,0,0,31,0,32,0,77,128,83,64,81,32,81,32,73,32,38,160,48,
+    64,15,128,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,
+    62,0,34,0,34,0,20,0,20,0,8,0,0,0,0,0,0,0,8,0,0,0,0,124,
+    66,66,66,124,66,66,66,124,0,0,0,9,0,0,0,0,0,0,0,0,30,0,33,0,
+    64,0,64,0,64,0,64,0,64,0,33,0,30,0,0,0,0,0,0,0,9,0,0,0,
+    0,0,0,0,0,124,0,66,0,65,0,65,0,65,0,65,0,65,0,66,0,124,0,0,
+    0,0,0,0,0,8,0,0,0,0,126,64,64,64,126,64,64,64,126,0,0,0,8,0,
+    0,0,0,64,64,64,64,124,64,64,64,126,0,0,0,9,0,0,0,0,0,0,0,0,
+    29,0,35,0,65,0,65,0,71,0,64,0,64,0,33,0,30,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,65,0,127,0,65,0,65,0,65,
+    0,65,0,0,0,0,0,0,0,3,0,0,0,0,64,64,64,64,64,64,64,64,64,0,
+    0,0,7,0,0,0,0,56,68,68,4,4,4,4,4,4,0,0,0,8,0,0,0,0,
+    65,66,68,72,112,80,72,68,66,0,0,0,7,0,0,0,0,124,64,64,64,64,64,64,
+    64,64,0,0,0,11,0,0,0,0,0,0,0,0,68,64,68,64,74,64,74,64,81,64,
+    81,64,96,192,96,192,64,64,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,65,
+    0,67,0,69,0,69,0,73,0,81,0,81,0,97,0,65,0,0,0,0,0,0,0,10,
+    0,0,0,0,0,0,0,0,30,0,33,0,64,128,64,128,64,128,64,128,64,128,33,0,
+    30,0,0,0,0,0,0,0,8,0,0,0,0,64,64,64,64,124,66,66,66,124,0,0,
+    0,10,0,0,0,0,0,0,0,0,30,128,33,0,66,128,68,128,64,128,64,128,64,128,
+    33,0,30,0,0,0,0,0,0,0,8,0,0,0,0,66,66,66,68,124,66,66,66,124,
+    0,0,0,8,0,0,0,0,60,66,66,2,12,48,64,66,60,0,0,0,7,0,0,0,
+    0,16,16,16,16,16,16,16,16,254,0,0,0,8,0,0,0,0,60,66,66,66,66,66,
+    66,66,66,0,0,0,9,0,0,0,0,0,0,0,0,8,0,8,0,20,0,20,0,34,
+    0,34,0,34,0,65,0,65,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,
+    17,0,17,0,17,0,42,128,42,128,36,128,68,64,68,64,68,64,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,65,0,34,0,34,0,20,0,8,0,20,0,34,0,34,
+    0,65,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,8,0,8,0,8,0,
+    8,0,20,0,34,0,34,0,65,0,65,0,0,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,127,0,64,0,32,0,16,0,8,0,4,0,2,0,1,0,127,0,0,0,0,
+    0,0,0,3,0,96,64,64,64,64,64,64,64,64,64,64,96,0,0,0,4,0,0,0,
+    0,16,16,32,32,32,64,64,128,128,0,0,0,3,0,192,64,64,64,64,64,64,64,64,
+    64,64,192,0,0,0,6,0,0,0,0,0,0,0,0,0,136,80,32,0,0,0,0,7,
+    0,0,254,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+    0,0,0,192,128,64,0,0,0,7,0,0,0,0,58,68,68,60,4,68,56,0,0,0,
+    0,0,7,0,0,0,0,88,100,68,68,68,100,88,64,64,0,0,0,7,0,0,0,0,
+    56,68,64,64,64,68,56,0,0,0,0,0,7,0,0,0,0,52,76,68,68,68,76,52,
+    4,4,0,0,0,7,0,0,0,0,56,68,64,124,68,68,56,0,0,0,0,0,3,0,
+    0,0,0,64,64,64,64,64,64,224,64,48,0,0,0,7,0,56,68,4,52,76,68,68,
+    68,76,52,0,0,0,0,0,7,0,0,0,0,68,68,68,68,68,100,88,64,64,0,0,
+    0,3,0,0,0,0,64,64,64,64,64,64,64,0,64,0,0,0,3,0,128,64,64,64,
+    64,64,64,64,64,64,0,64,0,0,0,6,0,0,0,0,68,72,80,96,96,80,72,64,
+    64,0,0,0,3,0,0,0,0,64,64,64,64,64,64,64,64,64,0,0,0,9,0,0,
+    0,0,0,0,0,0,73,0,73,0,73,0,73,0,73,0,109,0,82,0,0,0,0,0,
+    0,0,0,0,0,0,7,0,0,0,0,68,68,68,68,68,100,88,0,0,0,0,0,7,
+    0,0,0,0,56,68,68,68,68,68,56,0,0,0,0,0,7,0,64,64,64,88,100,68,
+    68,68,100,88,0,0,0,0,0,7,0,4,4,4,52,76,68,68,68,76,52,0,0,0,
+    0,0,4,0,0,0,0,64,64,64,64,64,96,80,0,0,0,0,0,6,0,0,0,0,
+    48,72,8,48,64,72,48,0,0,0,0,0,3,0,0,0,0,96,64,64,64,64,64,224,
+    64,64,0,0,0,7,0,0,0,0,52,76,68,68,68,68,68,0,0,0,0,0,7,0,
+    0,0,0,16,16,40,40,68,68,68,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    34,0,34,0,85,0,73,0,73,0,136,128,136,128,0,0,0,0,0,0,0,0,0,0,
+    6,0,0,0,0,132,132,72,48,48,72,132,0,0,0,0,0,7,0,64,32,16,16,40,
+    40,72,68,68,68,0,0,0,0,0,6,0,0,0,0,120,64,32,32,16,8,120,0,0,
+    0,0,0,4,0,48,64,64,64,64,64,128,64,64,64,64,48,0,0,0,3,0,64,64,
+    64,64,64,64,64,64,64,64,64,64,0,0,0,4,0,192,32,32,32,32,32,16,32,32,
+    32,32,192,0,0,0,7,0,0,0,0,0,0,0,152,100,0,0,0,0,0,0,0
+};
+
+//-adobe-helvetica-medium-r-normal--10-100-75-75-p-56-iso8859-1
+static const unsigned short HELVETICA_10_OFFSETS[BITMAPFONT_GLYPHS] = {
+    0, 15, 30, 45, 60, 75, 104, 119, 134, 149, 164, 179, 194, 209, 224, 239,
+    254, 269, 284, 299, 314, 329, 344, 359, 374, 389, 404, 419, 434, 449, 464, 479,
+    494, 523, 538, 553, 568, 583, 598, 613, 628, 643, 658, 673, 688, 703, 732, 747,
+    762, 777, 792, 807, 822, 837, 852, 867, 896, 911, 926, 941, 956, 971, 986, 1001,
+    1016, 1031, 1046, 1061, 1076, 1091, 1106, 1121, 1136, 1151, 1166, 1181, 1196, 1211, 1226, 1241,
+    1256, 1271, 1286, 1301, 1316, 1331, 1346, 1361, 1376, 1391, 1406, 1421, 1436, 1451, 1466
+};
+static const unsigned char HELVETICA_10_DATA[1481] = {
+    3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,0,64,64,64,
+    64,64,64,0,0,0,4,0,0,0,0,0,0,0,0,0,80,80,0,0,0,6,0,0,
+    0,80,80,248,40,124,40,40,0,0,0,0,6,0,0,32,112,168,40,112,160,168,112,32,
+    0,0,0,9,0,0,0,0,0,0,38,0,41,0,22,0,16,0,8,0,104,0,148,0,
+    100,0,0,0,0,0,0,0,8,0,0,0,50,76,76,82,48,40,40,16,0,0,0,3,
+    0,0,0,0,0,0,0,0,64,32,32,0,0,0,4,0,32,64,64,128,128,128,128,64,
+    64,32,0,0,0,4,0,64,32,32,16,16,16,16,32,32,64,0,0,0,4,0,0,0,
+    0,0,0,0,0,160,64,160,0,0,0,6,0,0,0,0,32,32,248,32,32,0,0,0,
+    0,0,3,0,128,64,64,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,
+    124,0,0,0,0,0,0,0,3,0,0,0,64,0,0,0,0,0,0,0,0,0,0,3,
+    0,0,0,128,128,64,64,64,64,32,32,0,0,0,6,0,0,0,112,136,136,136,136,136,
+    136,112,0,0,0,6,0,0,0,32,32,32,32,32,32,96,32,0,0,0,6,0,0,0,
+    248,128,64,48,8,8,136,112,0,0,0,6,0,0,0,112,136,8,8,48,8,136,112,0,
+    0,0,6,0,0,0,16,16,248,144,80,80,48,16,0,0,0,6,0,0,0,112,136,8,
+    8,240,128,128,248,0,0,0,6,0,0,0,112,136,136,200,176,128,136,112,0,0,0,6,
+    0,0,0,64,64,32,32,16,16,8,248,0,0,0,6,0,0,0,112,136,136,136,112,136,
+    136,112,0,0,0,6,0,0,0,112,136,8,104,152,136,136,112,0,0,0,3,0,0,0,
+    64,0,0,0,0,64,0,0,0,0,0,3,0,128,64,64,0,0,0,0,64,0,0,0,
+    0,0,6,0,0,0,0,16,32,64,32,16,0,0,0,0,0,5,0,0,0,0,0,240,
+    0,240,0,0,0,0,0,0,6,0,0,0,0,64,32,16,32,64,0,0,0,0,0,6,
+    0,0,0,32,0,32,32,16,8,72,48,0,0,0,11,0,0,62,0,64,0,155,0,164,
+    128,164,128,162,64,146,64,77,64,32,128,31,0,0,0,0,0,0,0,7,0,0,0,130,
+    130,124,68,40,40,16,16,0,0,0,7,0,0,0,120,68,68,68,120,68,68,120,0,0,
+    0,8,0,0,0,60,66,64,64,64,64,66,60,0,0,0,8,0,0,0,120,68,66,66,
+    66,66,68,120,0,0,0,7,0,0,0,124,64,64,64,124,64,64,124,0,0,0,6,0,
+    0,0,64,64,64,64,120,64,64,124,0,0,0,8,0,0,0,58,70,66,70,64,64,66,
+    60,0,0,0,8,0,0,0,66,66,66,66,126,66,66,66,0,0,0,3,0,0,0,64,
+    64,64,64,64,64,64,64,0,0,0,5,0,0,0,96,144,16,16,16,16,16,16,0,0,
+    0,7,0,0,0,68,68,72,72,112,80,72,68,0,0,0,6,0,0,0,120,64,64,64,
+    64,64,64,64,0,0,0,9,0,0,0,0,0,0,73,0,73,0,73,0,85,0,85,0,
+    99,0,99,0,65,0,0,0,0,0,0,0,8,0,0,0,70,70,74,74,82,82,98,98,
+    0,0,0,8,0,0,0,60,66,66,66,66,66,66,60,0,0,0,7,0,0,0,64,64,
+    64,64,120,68,68,120,0,0,0,8,0,0,1,62,70,74,66,66,66,66,60,0,0,0,
+    7,0,0,0,68,68,68,68,120,68,68,120,0,0,0,7,0,0,0,56,68,68,4,56,
+    64,68,56,0,0,0,5,0,0,0,32,32,32,32,32,32,32,248,0,0,0,8,0,0,
+    0,60,66,66,66,66,66,66,66,0,0,0,7,0,0,0,16,40,40,68,68,68,130,130,
+    0,0,0,9,0,0,0,0,0,0,34,0,34,0,34,0,85,0,73,0,73,0,136,128,
+    136,128,0,0,0,0,0,0,7,0,0,0,68,68,40,40,16,40,68,68,0,0,0,7,
+    0,0,0,16,16,16,40,40,68,68,130,0,0,0,7,0,0,0,124,64,32,16,16,8,
+    4,124,0,0,0,3,0,96,64,64,64,64,64,64,64,64,96,0,0,0,3,0,0,0,
+    32,32,64,64,64,64,128,128,0,0,0,3,0,192,64,64,64,64,64,64,64,64,192,0,
+    0,0,6,0,0,0,0,0,0,136,80,80,32,32,0,0,0,6,0,252,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,63,64,32,0,0,0,5,
+    0,0,0,104,144,144,112,16,224,0,0,0,0,0,6,0,0,0,176,200,136,136,200,176,
+    128,128,0,0,0,5,0,0,0,96,144,128,128,144,96,0,0,0,0,0,6,0,0,0,
+    104,152,136,136,152,104,8,8,0,0,0,5,0,0,0,96,144,128,240,144,96,0,0,0,
+    0,0,4,0,0,0,64,64,64,64,64,224,64,48,0,0,0,6,0,112,8,104,152,136,
+    136,152,104,0,0,0,0,0,6,0,0,0,136,136,136,136,200,176,128,128,0,0,0,2,
+    0,0,0,128,128,128,128,128,128,0,128,0,0,0,2,0,0,128,128,128,128,128,128,128,
+    0,128,0,0,0,5,0,0,0,144,144,160,192,160,144,128,128,0,0,0,2,0,0,0,
+    128,128,128,128,128,128,128,128,0,0,0,8,0,0,0,146,146,146,146,146,236,0,0,0,
+    0,0,6,0,0,0,136,136,136,136,200,176,0,0,0,0,0,6,0,0,0,112,136,136,
+    136,136,112,0,0,0,0,0,6,0,128,128,176,200,136,136,200,176,0,0,0,0,0,6,
+    0,8,8,104,152,136,136,152,104,0,0,0,0,0,4,0,0,0,128,128,128,128,192,160,
+    0,0,0,0,0,5,0,0,0,96,144,16,96,144,96,0,0,0,0,0,4,0,0,0,
+    96,64,64,64,64,224,64,64,0,0,0,5,0,0,0,112,144,144,144,144,144,0,0,0,
+    0,0,6,0,0,0,32,32,80,80,136,136,0,0,0,0,0,8,0,0,0,40,40,84,
+    84,146,146,0,0,0,0,0,6,0,0,0,136,136,80,32,80,136,0,0,0,0,0,5,
+    0,128,64,64,96,160,160,144,144,0,0,0,0,0,5,0,0,0,240,128,64,32,16,240,
+    0,0,0,0,0,3,0,32,64,64,64,64,128,64,64,64,32,0,0,0,3,0,64,64,
+    64,64,64,64,64,64,64,64,0,0,0,3,0,128,64,64,64,64,32,64,64,64,128,0,
+    0,0,7,0,0,0,0,0,0,152,100,0,0,0,0,0,0
+};
+
+//-misc-fixed-medium-r-normal--13-120-75-75-C-80-iso8859-1
+static const unsigned short FIXED_8_BY_13_OFFSETS[BITMAPFONT_GLYPHS] = {
+    0, 15, 30, 45, 60, 75, 90, 105, 120, 135, 150, 165, 180, 195, 210, 225,
+    240, 255, 270, 285, 300, 315, 330, 345, 360, 375, 390, 405, 420, 435, 450, 465,
+    480, 495, 510, 525, 540, 555, 570, 585, 600, 615, 630, 645, 660, 675, 690, 705,
+    720, 735, 750, 765, 780, 795, 810, 825, 840, 855, 870, 885, 900, 915, 930, 945,
+    960, 975, 990, 1005, 1020, 1035, 1050, 1065, 1080, 1095, 1110, 1125, 1140, 1155, 1170, 1185,
+    1200, 1215, 1230, 1245, 1260, 1275, 1290, 1305, 1320, 1335, 1350, 1365, 1380, 1395, 1410
+};
+static const unsigned char FIXED_8_BY_13_DATA[1425] = {
+    8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,16,0,16,16,16,
+    16,16,16,16,0,0,8,0,0,0,0,0,0,0,0,0,36,36,36,0,0,8,0,0,
+    0,0,36,36,126,36,126,36,36,0,0,0,8,0,0,0,16,120,20,20,56,80,80,60,
+    16,0,0,8,0,0,0,68,42,36,16,8,8,36,82,34,0,0,8,0,0,0,58,68,
+    74,48,72,72,48,0,0,0,0,8,0,0,0,0,0,0,0,0,0,64,48,56,0,0,
+    8,0,0,0,4,8,8,16,16,16,8,8,4,0,0,8,0,0,0,32,16,16,8,8,
+    8,16,16,32,0,0,8,0,0,0,0,0,36,24,126,24,36,0,0,0,0,8,0,0,
+    0,0,0,16,16,124,16,16,0,0,0,0,8,0,0,64,48,56,0,0,0,0,0,0,
+    0,0,0,8,0,0,0,0,0,0,0,126,0,0,0,0,0,0,8,0,0,16,56,16,
+    0,0,0,0,0,0,0,0,0,8,0,0,0,128,128,64,32,16,8,4,2,2,0,0,
+    8,0,0,0,24,36,66,66,66,66,66,36,24,0,0,8,0,0,0,124,16,16,16,16,
+    16,80,48,16,0,0,8,0,0,0,126,64,32,24,4,2,66,66,60,0,0,8,0,0,
+    0,60,66,2,2,28,8,4,2,126,0,0,8,0,0,0,4,4,126,68,68,36,20,12,
+    4,0,0,8,0,0,0,60,66,2,2,98,92,64,64,126,0,0,8,0,0,0,60,66,
+    66,98,92,64,64,32,28,0,0,8,0,0,0,32,32,16,16,8,8,4,2,126,0,0,
+    8,0,0,0,60,66,66,66,60,66,66,66,60,0,0,8,0,0,0,56,4,2,2,58,
+    70,66,66,60,0,0,8,0,0,16,56,16,0,0,16,56,16,0,0,0,0,8,0,0,
+    64,48,56,0,0,16,56,16,0,0,0,0,8,0,0,0,2,4,8,16,32,16,8,4,
+    2,0,0,8,0,0,0,0,0,126,0,0,126,0,0,0,0,0,8,0,0,0,64,32,
+    16,8,4,8,16,32,64,0,0,8,0,0,0,8,0,8,8,4,2,66,66,60,0,0,
+    8,0,0,0,60,64,74,86,82,78,66,66,60,0,0,8,0,0,0,66,66,66,126,66,
+    66,66,36,24,0,0,8,0,0,0,252,66,66,66,124,66,66,66,252,0,0,8,0,0,
+    0,60,66,64,64,64,64,64,66,60,0,0,8,0,0,0,252,66,66,66,66,66,66,66,
+    252,0,0,8,0,0,0,126,64,64,64,120,64,64,64,126,0,0,8,0,0,0,64,64,
+    64,64,120,64,64,64,126,0,0,8,0,0,0,58,70,66,78,64,64,64,66,60,0,0,
+    8,0,0,0,66,66,66,66,126,66,66,66,66,0,0,8,0,0,0,124,16,16,16,16,
+    16,16,16,124,0,0,8,0,0,0,56,68,4,4,4,4,4,4,31,0,0,8,0,0,
+    0,66,68,72,80,96,80,72,68,66,0,0,8,0,0,0,126,64,64,64,64,64,64,64,
+    64,0,0,8,0,0,0,130,130,130,146,146,170,198,130,130,0,0,8,0,0,0,66,66,
+    66,70,74,82,98,66,66,0,0,8,0,0,0,60,66,66,66,66,66,66,66,60,0,0,
+    8,0,0,0,64,64,64,64,124,66,66,66,124,0,0,8,0,0,2,60,74,82,66,66,
+    66,66,66,60,0,0,8,0,0,0,66,68,72,80,124,66,66,66,124,0,0,8,0,0,
+    0,60,66,2,2,60,64,64,66,60,0,0,8,0,0,0,16,16,16,16,16,16,16,16,
+    254,0,0,8,0,0,0,60,66,66,66,66,66,66,66,66,0,0,8,0,0,0,16,40,
+    40,40,68,68,68,130,130,0,0,8,0,0,0,68,170,146,146,146,130,130,130,130,0,0,
+    8,0,0,0,130,130,68,40,16,40,68,130,130,0,0,8,0,0,0,16,16,16,16,16,
+    40,68,130,130,0,0,8,0,0,0,126,64,64,32,16,8,4,2,126,0,0,8,0,0,
+    0,60,32,32,32,32,32,32,32,60,0,0,8,0,0,0,2,2,4,8,16,32,64,128,
+    128,0,0,8,0,0,0,120,8,8,8,8,8,8,8,120,0,0,8,0,0,0,0,0,
+    0,0,0,0,68,40,16,0,0,8,0,0,254,0,0,0,0,0,0,0,0,0,0,0,
+    8,0,0,0,0,0,0,0,0,0,4,24,56,0,0,8,0,0,0,58,70,66,62,2,
+    60,0,0,0,0,0,8,0,0,0,92,98,66,66,98,92,64,64,64,0,0,8,0,0,
+    0,60,66,64,64,66,60,0,0,0,0,0,8,0,0,0,58,70,66,66,70,58,2,2,
+    2,0,0,8,0,0,0,60,66,64,126,66,60,0,0,0,0,0,8,0,0,0,32,32,
+    32,32,124,32,32,34,28,0,0,8,0,60,66,60,64,56,68,68,58,0,0,0,0,0,
+    8,0,0,0,66,66,66,66,98,92,64,64,64,0,0,8,0,0,0,124,16,16,16,16,
+    48,0,16,0,0,0,8,0,56,68,68,4,4,4,4,12,0,4,0,0,0,8,0,0,
+    0,66,68,72,112,72,68,64,64,64,0,0,8,0,0,0,124,16,16,16,16,16,16,16,
+    48,0,0,8,0,0,0,130,146,146,146,146,236,0,0,0,0,0,8,0,0,0,66,66,
+    66,66,98,92,0,0,0,0,0,8,0,0,0,60,66,66,66,66,60,0,0,0,0,0,
+    8,0,64,64,64,92,98,66,98,92,0,0,0,0,0,8,0,2,2,2,58,70,66,70,
+    58,0,0,0,0,0,8,0,0,0,32,32,32,32,34,92,0,0,0,0,0,8,0,0,
+    0,60,66,12,48,66,60,0,0,0,0,0,8,0,0,0,28,34,32,32,32,124,32,32,
+    0,0,0,8,0,0,0,58,68,68,68,68,68,0,0,0,0,0,8,0,0,0,16,40,
+    40,68,68,68,0,0,0,0,0,8,0,0,0,68,170,146,146,130,130,0,0,0,0,0,
+    8,0,0,0,66,36,24,24,36,66,0,0,0,0,0,8,0,60,66,2,58,70,66,66,
+    66,0,0,0,0,0,8,0,0,0,126,32,16,8,4,126,0,0,0,0,0,8,0,0,
+    0,14,16,16,8,48,8,16,16,14,0,0,8,0,0,0,16,16,16,16,16,16,16,16,
+    16,0,0,8,0,0,0,112,8,8,16,12,16,8,8,112,0,0,8,0,0,0,0,0,
+    0,0,0,0,72,84,36,0,0
+};
+
+//-misc-fixed-medium-r-normal--15-140-75-75-C-90-iso8859-1
+static const unsigned short FIXED_9_BY_15_OFFSETS[BITMAPFONT_GLYPHS] = {
+    0, 33, 66, 99, 132, 165, 198, 231, 264, 297, 330, 363, 396, 429, 462, 495,
+    528, 561, 594, 627, 660, 693, 726, 759, 792, 825, 858, 891, 924, 957, 990, 1023,
+    1056, 1089, 1122, 1155, 1188, 1221, 1254, 1287, 1320, 1353, 1386, 1419, 1452, 1485, 1518, 1551,
+    1584, 1617, 1650, 1683, 1716, 1749, 1782, 1815, 1848, 1881, 1914, 1947, 1980, 2013, 2046, 2079,
+    2112, 2145, 2178, 2211, 2244, 2277, 2310, 2343, 2376, 2409, 2442, 2475, 2508, 2541, 2574, 2607,
+    2640, 2673, 2706, 2739, 2772, 2805, 2838, 2871, 2904, 2937, 2970, 3003, 3036, 3069, 3102
+};
+static const unsigned char FIXED_9_BY_15_DATA[3135] = {
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,8,0,8,0,0,0,
+    0,0,8,0,8,0,8,0,8,0,8,0,8,0,8,0,0,0,9,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,18,0,18,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,0,0,36,0,36,0,126,0,36,0,36,0,
+    126,0,36,0,36,0,0,0,0,0,0,0,9,0,0,0,0,0,0,8,0,62,0,73,
+    0,9,0,9,0,10,0,28,0,40,0,72,0,73,0,62,0,8,0,0,0,9,0,0,
+    0,0,0,0,0,0,66,0,37,0,37,0,18,0,8,0,8,0,36,0,82,0,82,0,
+    33,0,0,0,0,0,9,0,0,0,0,0,0,0,0,49,0,74,0,68,0,74,0,49,
+    0,48,0,72,0,72,0,72,0,48,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,16,0,8,0,4,0,6,0,0,0,0,0,
+    9,0,0,0,0,0,0,4,0,8,0,8,0,16,0,16,0,16,0,16,0,16,0,16,
+    0,8,0,8,0,4,0,0,0,9,0,0,0,0,0,0,16,0,8,0,8,0,4,0,
+    4,0,4,0,4,0,4,0,4,0,8,0,8,0,16,0,0,0,9,0,0,0,0,0,
+    0,0,0,0,0,8,0,73,0,42,0,28,0,42,0,73,0,8,0,0,0,0,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,0,0,8,0,8,0,8,0,127,0,8,0,
+    8,0,8,0,0,0,0,0,0,0,0,0,9,0,0,8,0,4,0,4,0,12,0,12,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,12,0,12,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    64,0,32,0,32,0,16,0,8,0,8,0,4,0,2,0,2,0,1,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,28,0,34,0,65,0,65,0,65,0,65,0,65,0,65,
+    0,34,0,28,0,0,0,0,0,9,0,0,0,0,0,0,0,0,127,0,8,0,8,0,
+    8,0,8,0,8,0,72,0,40,0,24,0,8,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,127,0,64,0,32,0,16,0,8,0,4,0,2,0,65,0,65,0,62,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,62,0,65,0,1,0,1,0,1,0,14,0,
+    4,0,2,0,1,0,127,0,0,0,0,0,9,0,0,0,0,0,0,0,0,2,0,2,
+    0,2,0,127,0,66,0,34,0,18,0,10,0,6,0,2,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,62,0,65,0,1,0,1,0,1,0,97,0,94,0,64,0,64,0,
+    127,0,0,0,0,0,9,0,0,0,0,0,0,0,0,62,0,65,0,65,0,65,0,97,
+    0,94,0,64,0,64,0,32,0,30,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    32,0,32,0,16,0,16,0,8,0,4,0,2,0,1,0,1,0,127,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,28,0,34,0,65,0,65,0,34,0,28,0,34,0,65,
+    0,34,0,28,0,0,0,0,0,9,0,0,0,0,0,0,0,0,60,0,2,0,1,0,
+    1,0,61,0,67,0,65,0,65,0,65,0,62,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,12,0,12,0,0,0,0,0,0,0,12,0,12,0,0,0,0,0,0,0,0,
+    0,0,0,9,0,0,8,0,4,0,4,0,12,0,12,0,0,0,0,0,0,0,12,0,
+    12,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,2,0,4,
+    0,8,0,16,0,32,0,32,0,16,0,8,0,4,0,2,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,127,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,32,0,16,0,8,0,4,0,2,
+    0,2,0,4,0,8,0,16,0,32,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    8,0,0,0,8,0,8,0,4,0,2,0,1,0,65,0,65,0,62,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,62,0,64,0,64,0,77,0,83,0,81,0,79,0,65,
+    0,65,0,62,0,0,0,0,0,9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,
+    127,0,65,0,65,0,65,0,34,0,20,0,8,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,126,0,33,0,33,0,33,0,33,0,126,0,33,0,33,0,33,0,126,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,62,0,65,0,64,0,64,0,64,0,64,0,
+    64,0,64,0,65,0,62,0,0,0,0,0,9,0,0,0,0,0,0,0,0,126,0,33,
+    0,33,0,33,0,33,0,33,0,33,0,33,0,33,0,126,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,127,0,32,0,32,0,32,0,32,0,60,0,32,0,32,0,32,0,
+    127,0,0,0,0,0,9,0,0,0,0,0,0,0,0,32,0,32,0,32,0,32,0,32,
+    0,60,0,32,0,32,0,32,0,127,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    62,0,65,0,65,0,65,0,71,0,64,0,64,0,64,0,65,0,62,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,65,0,65,0,127,0,65,0,65,
+    0,65,0,65,0,0,0,0,0,9,0,0,0,0,0,0,0,0,62,0,8,0,8,0,
+    8,0,8,0,8,0,8,0,8,0,8,0,62,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,60,0,66,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,15,128,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,65,0,66,0,68,0,72,0,80,0,112,0,
+    72,0,68,0,66,0,65,0,0,0,0,0,9,0,0,0,0,0,0,0,0,127,0,64,
+    0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,65,0,65,0,65,0,73,0,73,0,85,0,85,0,99,0,65,0,
+    65,0,0,0,0,0,9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,67,0,69,
+    0,73,0,81,0,97,0,65,0,65,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    62,0,65,0,65,0,65,0,65,0,65,0,65,0,65,0,65,0,62,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,64,0,64,0,64,0,64,0,64,0,126,0,65,0,65,
+    0,65,0,126,0,0,0,0,0,9,0,0,0,0,3,0,4,0,62,0,73,0,81,0,
+    65,0,65,0,65,0,65,0,65,0,65,0,62,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,65,0,65,0,66,0,68,0,72,0,126,0,65,0,65,0,65,0,126,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,62,0,65,0,65,0,1,0,6,0,56,0,
+    64,0,65,0,65,0,62,0,0,0,0,0,9,0,0,0,0,0,0,0,0,8,0,8,
+    0,8,0,8,0,8,0,8,0,8,0,8,0,8,0,127,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,62,0,65,0,65,0,65,0,65,0,65,0,65,0,65,0,65,0,
+    65,0,0,0,0,0,9,0,0,0,0,0,0,0,0,8,0,20,0,20,0,20,0,34,
+    0,34,0,34,0,65,0,65,0,65,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    34,0,85,0,73,0,73,0,73,0,73,0,65,0,65,0,65,0,65,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,65,0,65,0,34,0,20,0,8,0,8,0,20,0,34,
+    0,65,0,65,0,0,0,0,0,9,0,0,0,0,0,0,0,0,8,0,8,0,8,0,
+    8,0,8,0,8,0,20,0,34,0,65,0,65,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,127,0,64,0,64,0,32,0,16,0,8,0,4,0,2,0,1,0,127,0,0,
+    0,0,0,9,0,0,0,0,0,0,30,0,16,0,16,0,16,0,16,0,16,0,16,0,
+    16,0,16,0,16,0,16,0,30,0,0,0,9,0,0,0,0,0,0,0,0,1,0,2,
+    0,2,0,4,0,8,0,8,0,16,0,32,0,32,0,64,0,0,0,0,0,9,0,0,
+    0,0,0,0,60,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,
+    4,0,60,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,65,0,34,0,20,0,8,0,0,0,0,0,9,0,0,0,0,0,0,255,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,
+    0,8,0,16,0,48,0,0,0,9,0,0,0,0,0,0,0,0,61,0,67,0,65,0,
+    63,0,1,0,1,0,62,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,94,0,97,0,65,0,65,0,65,0,97,0,94,0,64,0,64,0,64,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,62,0,65,0,64,0,64,0,64,0,65,0,
+    62,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,61,0,67,
+    0,65,0,65,0,65,0,67,0,61,0,1,0,1,0,1,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,62,0,64,0,64,0,127,0,65,0,65,0,62,0,0,0,0,0,
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,16,0,16,0,16,0,16,0,124,
+    0,16,0,16,0,17,0,17,0,14,0,0,0,0,0,9,0,0,62,0,65,0,65,0,
+    62,0,64,0,60,0,66,0,66,0,66,0,61,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,65,0,65,0,97,0,94,0,64,
+    0,64,0,64,0,0,0,0,0,9,0,0,0,0,0,0,0,0,62,0,8,0,8,0,
+    8,0,8,0,8,0,56,0,0,0,0,0,24,0,0,0,0,0,9,0,0,60,0,66,
+    0,66,0,66,0,2,0,2,0,2,0,2,0,2,0,14,0,0,0,0,0,6,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,65,0,70,0,88,0,96,0,88,0,70,0,
+    65,0,64,0,64,0,64,0,0,0,0,0,9,0,0,0,0,0,0,0,0,62,0,8,
+    0,8,0,8,0,8,0,8,0,8,0,8,0,8,0,56,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,65,0,73,0,73,0,73,0,73,0,73,0,118,0,0,0,0,0,
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,65,0,65,0,65,0,65,0,65,
+    0,97,0,94,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    62,0,65,0,65,0,65,0,65,0,65,0,62,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,64,0,64,0,64,0,94,0,97,0,65,0,65,0,65,0,97,0,94,0,0,
+    0,0,0,0,0,0,0,0,0,9,0,0,1,0,1,0,1,0,61,0,67,0,65,0,
+    65,0,65,0,67,0,61,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,32,0,32,0,32,0,32,0,33,0,49,0,78,0,0,0,0,0,0,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,62,0,65,0,1,0,62,0,64,0,65,0,
+    62,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,14,0,17,
+    0,16,0,16,0,16,0,16,0,126,0,16,0,16,0,0,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,61,0,66,0,66,0,66,0,66,0,66,0,66,0,0,0,0,0,
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,8,0,20,0,20,0,34,0,34,
+    0,65,0,65,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    34,0,85,0,73,0,73,0,73,0,65,0,65,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,65,0,34,0,20,0,8,0,20,0,34,0,65,0,0,
+    0,0,0,0,0,0,0,0,0,9,0,0,60,0,66,0,2,0,58,0,70,0,66,0,
+    66,0,66,0,66,0,66,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,
+    0,0,0,127,0,32,0,16,0,8,0,4,0,2,0,127,0,0,0,0,0,0,0,0,
+    0,0,0,9,0,0,0,0,0,0,7,0,8,0,8,0,8,0,4,0,24,0,24,0,
+    4,0,8,0,8,0,8,0,7,0,0,0,9,0,0,0,0,0,0,8,0,8,0,8,
+    0,8,0,8,0,8,0,8,0,8,0,8,0,8,0,8,0,8,0,0,0,9,0,0,
+    0,0,0,0,112,0,8,0,8,0,8,0,16,0,12,0,12,0,16,0,8,0,8,0,
+    8,0,112,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,70,0,73,0,49,0,0,0,0,0
+};
+
+//-adobe-times-medium-r-normal--10-100-75-75-p-54-iso8859-1
+static const unsigned short TIMES_ROMAN_10_OFFSETS[BITMAPFONT_GLYPHS] = {
+    0, 15, 30, 45, 60, 75, 90, 105, 120, 135, 150, 165, 180, 195, 210, 225,
+    240, 255, 270, 285, 300, 315, 330, 345, 360, 375, 390, 405, 420, 435, 450, 465,
+    480, 509, 524, 539, 554, 569, 584, 599, 614, 629, 644, 659, 674, 689, 718, 733,
+    748, 763, 778, 793, 808, 823, 838, 853, 882, 897, 912, 927, 942, 957, 972, 987,
+    1002, 1017, 1032, 1047, 1062, 1077, 1092, 1107, 1122, 1137, 1152, 1167, 1182, 1197, 1212, 1227,
+    1242, 1257, 1272, 1287, 1302, 1317, 1332, 1347, 1362, 1377, 1392, 1407, 1422, 1437, 1452
+};
+static const unsigned char TIMES_ROMAN_10_DATA[1467] = {
+    2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,64,0,64,64,
+    64,64,64,0,0,0,4,0,0,0,0,0,0,0,0,0,160,160,0,0,0,5,0,0,
+    0,0,80,80,248,80,248,80,80,0,0,0,5,0,0,0,32,224,144,16,96,128,144,112,
+    32,0,0,8,0,0,0,0,68,42,42,86,168,164,126,0,0,0,8,0,0,0,0,118,
+    141,152,116,110,80,48,0,0,0,3,0,0,0,0,0,0,0,0,0,64,192,0,0,0,
+    4,0,0,32,64,64,128,128,128,64,64,32,0,0,0,4,0,0,128,64,64,32,32,32,
+    64,64,128,0,0,0,5,0,0,0,0,0,0,0,0,160,64,160,0,0,0,6,0,0,
+    0,0,32,32,248,32,32,0,0,0,0,0,3,0,0,64,64,64,0,0,0,0,0,0,
+    0,0,0,7,0,0,0,0,0,0,120,0,0,0,0,0,0,0,3,0,0,0,0,64,
+    0,0,0,0,0,0,0,0,0,3,0,0,0,0,128,128,64,64,64,32,32,0,0,0,
+    5,0,0,0,0,96,144,144,144,144,144,96,0,0,0,5,0,0,0,0,112,32,32,32,
+    32,96,32,0,0,0,5,0,0,0,0,240,64,32,32,16,144,96,0,0,0,5,0,0,
+    0,0,224,16,16,96,16,144,96,0,0,0,5,0,0,0,0,16,16,248,144,80,48,16,
+    0,0,0,5,0,0,0,0,224,144,16,16,224,64,112,0,0,0,5,0,0,0,0,96,
+    144,144,144,224,64,48,0,0,0,5,0,0,0,0,64,64,64,32,32,144,240,0,0,0,
+    5,0,0,0,0,96,144,144,96,144,144,96,0,0,0,5,0,0,0,0,192,32,112,144,
+    144,144,96,0,0,0,3,0,0,0,0,64,0,0,0,64,0,0,0,0,0,3,0,0,
+    64,64,64,0,0,0,64,0,0,0,0,0,5,0,0,0,0,16,32,64,32,16,0,0,
+    0,0,0,6,0,0,0,0,0,248,0,248,0,0,0,0,0,0,5,0,0,0,0,128,
+    64,32,64,128,0,0,0,0,0,4,0,0,0,0,64,0,64,64,32,160,224,0,0,0,
+    9,0,0,0,0,62,0,64,0,146,0,173,0,165,0,165,0,157,0,66,0,60,0,0,
+    0,0,0,0,0,8,0,0,0,0,238,68,124,40,40,56,16,0,0,0,6,0,0,0,
+    0,240,72,72,112,72,72,240,0,0,0,7,0,0,0,0,120,196,128,128,128,196,124,0,
+    0,0,7,0,0,0,0,248,76,68,68,68,76,248,0,0,0,6,0,0,0,0,248,72,
+    64,112,64,72,248,0,0,0,6,0,0,0,0,224,64,64,112,64,72,248,0,0,0,7,
+    0,0,0,0,120,196,132,156,128,196,124,0,0,0,8,0,0,0,0,238,68,68,124,68,
+    68,238,0,0,0,4,0,0,0,0,224,64,64,64,64,64,224,0,0,0,4,0,0,0,
+    0,192,160,32,32,32,32,112,0,0,0,7,0,0,0,0,236,72,80,96,80,72,236,0,
+    0,0,6,0,0,0,0,248,72,64,64,64,64,224,0,0,0,10,0,0,0,0,0,0,
+    0,0,235,128,73,0,85,0,85,0,99,0,99,0,227,128,0,0,0,0,0,0,8,0,
+    0,0,0,228,76,76,84,84,100,238,0,0,0,7,0,0,0,0,120,204,132,132,132,204,
+    120,0,0,0,6,0,0,0,0,224,64,64,112,72,72,240,0,0,0,7,0,0,12,24,
+    112,204,132,132,132,204,120,0,0,0,7,0,0,0,0,236,72,80,112,72,72,240,0,0,
+    0,5,0,0,0,0,224,144,16,96,192,144,112,0,0,0,6,0,0,0,0,112,32,32,
+    32,32,168,248,0,0,0,8,0,0,0,0,56,108,68,68,68,68,238,0,0,0,8,0,
+    0,0,0,16,16,40,40,108,68,238,0,0,0,10,0,0,0,0,0,0,0,0,34,0,
+    34,0,85,0,85,0,201,128,136,128,221,192,0,0,0,0,0,0,8,0,0,0,0,238,
+    68,40,16,40,68,238,0,0,0,8,0,0,0,0,56,16,16,40,40,68,238,0,0,0,
+    6,0,0,0,0,248,136,64,32,16,136,248,0,0,0,3,0,0,192,128,128,128,128,128,
+    128,128,192,0,0,0,3,0,0,0,0,32,32,64,64,64,128,128,0,0,0,3,0,0,
+    192,64,64,64,64,64,64,64,192,0,0,0,5,0,0,0,0,0,0,0,0,80,80,32,
+    0,0,0,5,0,248,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,
+    0,0,0,0,0,192,128,0,0,4,0,0,0,0,224,160,96,32,192,0,0,0,0,0,
+    5,0,0,0,0,224,144,144,144,224,128,128,0,0,0,4,0,0,0,0,96,128,128,128,
+    96,0,0,0,0,0,5,0,0,0,0,104,144,144,144,112,16,48,0,0,0,4,0,0,
+    0,0,96,128,192,160,96,0,0,0,0,0,4,0,0,0,0,224,64,64,64,224,64,48,
+    0,0,0,5,0,0,224,144,96,64,160,160,112,0,0,0,0,0,5,0,0,0,0,216,
+    144,144,144,224,128,128,0,0,0,3,0,0,0,0,64,64,64,64,192,0,64,0,0,0,
+    3,0,0,128,64,64,64,64,64,192,0,64,0,0,0,5,0,0,0,0,152,144,224,160,
+    144,128,128,0,0,0,4,0,0,0,0,224,64,64,64,64,64,192,0,0,0,8,0,0,
+    0,0,219,146,146,146,236,0,0,0,0,0,5,0,0,0,0,216,144,144,144,224,0,0,
+    0,0,0,5,0,0,0,0,96,144,144,144,96,0,0,0,0,0,5,0,0,192,128,224,
+    144,144,144,224,0,0,0,0,0,5,0,0,56,16,112,144,144,144,112,0,0,0,0,0,
+    4,0,0,0,0,224,64,64,96,160,0,0,0,0,0,4,0,0,0,0,224,32,96,128,
+    224,0,0,0,0,0,4,0,0,0,0,48,64,64,64,224,64,0,0,0,0,5,0,0,
+    0,0,104,144,144,144,144,0,0,0,0,0,5,0,0,0,0,32,96,80,144,216,0,0,
+    0,0,0,8,0,0,0,0,40,108,84,146,219,0,0,0,0,0,6,0,0,0,0,216,
+    80,32,80,216,0,0,0,0,0,5,0,0,128,128,64,96,160,144,184,0,0,0,0,0,
+    5,0,0,0,0,240,144,64,32,240,0,0,0,0,0,4,0,0,32,64,64,64,128,64,
+    64,64,32,0,0,0,2,0,0,128,128,128,128,128,128,128,128,128,0,0,0,4,0,0,
+    128,64,64,64,32,64,64,64,128,0,0,0,7,0,0,0,0,0,0,152,100,0,0,0,
+    0,0,0
+};
+
+//-adobe-times-medium-r-normal--24-240-75-75-p-124-iso8859-1
+static const unsigned short TIMES_ROMAN_24_OFFSETS[BITMAPFONT_GLYPHS] = {
+    0, 30, 60, 119, 178, 237, 325, 413, 443, 473, 503, 562, 621, 651, 710, 740,
+    770, 829, 888, 947, 1006, 1065, 1124, 1183, 1242, 1301, 1360, 1390, 1420, 1479, 1538, 1597,
+    1656, 1744, 1832, 1891, 1950, 2038, 2097, 2156, 2244, 2332, 2362, 2421, 2509, 2568, 2656, 2744,
+    2832, 2891, 2979, 3038, 3097, 3156, 3244, 3332, 3420, 3508, 3567, 3626, 3656, 3686, 3716, 3775,
+    3834, 3864, 3923, 3982, 4041, 4100, 4159, 4189, 4248, 4307, 4337, 4367, 4426, 4456, 4544, 4603,
+    4662, 4721, 4780, 4810, 4869, 4899, 4958, 5017, 5105, 5164, 5223, 5282, 5341, 5371, 5430
+};
+static const unsigned char TIMES_ROMAN_24_DATA[5489] = {
+    6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,8,0,0,0,0,0,0,0,24,24,0,0,0,24,24,24,24,24,
+    24,24,24,24,24,24,24,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,68,0,102,0,102,0,102,0,102,0,0,0,0,0,0,0,0,0,0,0,13,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,17,0,17,0,17,0,17,0,
+    127,224,127,224,8,128,8,128,8,128,63,240,63,240,4,64,4,64,4,64,4,64,4,64,
+    0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,4,0,4,
+    0,63,0,229,192,196,192,132,96,132,96,4,96,4,224,7,192,7,128,30,0,60,0,116,
+    0,100,0,100,32,100,96,52,224,31,128,4,0,4,0,0,0,0,0,0,0,19,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,30,0,12,57,
+    0,6,48,128,2,48,64,3,48,64,1,152,64,0,140,192,0,199,128,60,96,0,114,32,
+    0,97,48,0,96,152,0,96,136,0,48,140,0,25,254,0,15,6,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,30,30,0,63,191,0,112,240,128,96,96,0,96,
+    224,0,96,208,0,49,144,0,27,136,0,15,12,0,7,31,0,7,128,0,14,192,0,12,
+    96,0,12,32,0,12,32,0,6,96,0,3,192,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    24,12,4,28,24,0,0,0,0,0,0,8,0,0,2,4,8,24,16,48,48,96,96,96,
+    96,96,96,96,96,48,48,16,24,8,4,2,0,0,0,0,0,8,0,0,64,32,16,24,
+    8,12,12,6,6,6,6,6,6,6,6,12,12,8,24,16,32,64,0,0,0,0,0,12,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,2,0,7,0,50,96,58,224,7,0,58,224,50,96,7,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,3,0,3,0,3,0,3,0,3,0,127,248,127,248,3,0,3,0,3,0,3,
+    0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,
+    0,0,48,24,8,56,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,127,248,127,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,48,48,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
+    0,192,192,192,64,96,96,32,48,48,16,24,24,8,12,12,4,6,6,6,6,0,0,0,
+    0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,25,128,48,192,48,
+    192,112,224,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,48,192,48,192,25,
+    128,15,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,63,192,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,6,0,
+    6,0,6,0,6,0,6,0,30,0,6,0,2,0,0,0,0,0,0,0,0,0,0,0,
+    12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,192,127,224,48,32,24,0,12,
+    0,6,0,2,0,3,0,1,128,1,128,0,192,0,192,64,192,64,192,33,192,63,128,14,
+    0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,60,0,115,0,97,128,0,128,0,192,0,192,0,192,1,192,3,128,15,0,6,0,
+    3,0,65,128,65,128,35,128,63,0,14,0,0,0,0,0,0,0,0,0,0,0,12,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1,128,1,128,1,128,1,128,127,224,127,
+    224,97,128,33,128,49,128,17,128,25,128,9,128,13,128,5,128,3,128,3,128,1,128,0,
+    0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    63,0,113,192,96,192,0,96,0,96,0,96,0,96,0,224,1,192,7,192,63,0,60,0,
+    48,0,16,0,16,0,15,192,15,224,0,0,0,0,0,0,0,0,0,0,12,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,15,0,61,192,48,192,112,96,96,96,96,96,96,
+    96,96,96,96,192,121,192,119,0,48,0,56,0,24,0,12,0,7,0,1,224,0,0,0,
+    0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,
+    12,0,6,0,6,0,6,0,2,0,3,0,3,0,1,0,1,128,1,128,0,128,0,192,
+    64,192,96,96,127,224,63,224,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,15,0,57,192,112,192,96,96,96,96,96,96,32,224,48,
+    192,27,128,15,0,15,0,25,128,48,192,48,192,48,192,25,128,15,0,0,0,0,0,0,
+    0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,14,0,
+    3,0,1,128,1,192,0,192,14,192,57,224,48,224,96,96,96,96,96,96,96,96,96,224,
+    48,192,59,192,15,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+    48,48,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,0,7,0,
+    0,0,0,48,24,8,56,48,0,0,0,0,0,0,0,48,48,0,0,0,0,0,0,0,
+    0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,
+    224,3,128,14,0,56,0,96,0,56,0,14,0,3,128,0,224,0,48,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,248,127,248,0,0,0,0,127,248,
+    127,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,56,0,14,
+    0,3,128,0,224,0,48,0,224,3,128,14,0,56,0,96,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,12,0,12,0,0,0,0,0,4,0,4,0,4,0,6,0,6,0,3,0,
+    3,128,1,192,48,192,48,192,32,192,49,128,31,0,0,0,0,0,0,0,0,0,0,0,
+    22,0,0,0,0,0,0,0,0,0,0,0,0,0,252,0,3,131,0,6,0,0,12,0,
+    0,24,119,128,24,222,192,49,142,96,49,134,32,49,134,48,49,134,16,49,131,16,48,195,
+    16,48,227,16,56,127,16,24,59,48,28,0,32,14,0,96,7,0,192,3,195,128,0,254,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,31,128,48,6,0,16,6,0,16,
+    12,0,24,12,0,8,12,0,15,248,0,12,24,0,4,24,0,4,48,0,6,48,0,2,
+    48,0,2,96,0,1,96,0,1,192,0,1,192,0,0,128,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,
+    240,24,60,24,12,24,6,24,6,24,6,24,12,24,28,31,240,24,32,24,24,24,12,24,
+    12,24,12,24,24,24,56,127,224,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,3,240,15,28,28,4,48,2,48,0,96,0,96,0,
+    96,0,96,0,96,0,96,0,96,0,48,2,48,2,28,6,14,30,3,242,0,0,0,0,
+    0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,127,224,0,24,56,0,24,28,0,24,6,0,24,6,0,24,3,0,24,3,
+    0,24,3,0,24,3,0,24,3,0,24,3,0,24,3,0,24,6,0,24,6,0,24,28,
+    0,24,56,0,127,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,127,252,24,12,24,4,24,4,24,0,24,
+    0,24,32,24,32,31,224,24,32,24,32,24,0,24,0,24,8,24,8,24,24,127,248,0,
+    0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    126,0,24,0,24,0,24,0,24,0,24,0,24,16,24,16,31,240,24,16,24,16,24,0,
+    24,0,24,8,24,8,24,24,127,248,0,0,0,0,0,0,0,0,0,0,18,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,240,0,15,28,0,
+    28,14,0,48,6,0,48,6,0,96,6,0,96,6,0,96,31,128,96,0,0,96,0,0,
+    96,0,0,96,0,0,48,2,0,48,2,0,28,6,0,14,30,0,3,242,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,126,15,192,24,3,0,24,3,0,24,3,0,24,3,
+    0,24,3,0,24,3,0,24,3,0,31,255,0,24,3,0,24,3,0,24,3,0,24,3,
+    0,24,3,0,24,3,0,24,3,0,126,15,192,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,8,0,0,0,0,0,0,0,126,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,126,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,60,0,102,0,99,0,3,0,3,0,3,0,3,0,3,0,3,0,3,0,3,0,3,
+    0,3,0,3,0,3,0,3,0,15,192,0,0,0,0,0,0,0,0,0,0,17,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,15,128,24,7,
+    0,24,14,0,24,28,0,24,56,0,24,112,0,24,224,0,25,192,0,31,128,0,31,0,
+    0,25,128,0,24,192,0,24,96,0,24,48,0,24,24,0,24,12,0,126,63,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,127,252,24,12,24,4,24,4,24,0,24,0,24,0,24,0,24,0,24,0,
+    24,0,24,0,24,0,24,0,24,0,24,0,126,0,0,0,0,0,0,0,0,0,0,0,
+    22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,16,
+    252,16,48,48,16,48,48,16,104,48,16,104,48,16,196,48,16,196,48,17,132,48,17,130,
+    48,19,2,48,19,1,48,22,1,48,22,1,48,28,0,176,28,0,176,24,0,112,120,0,
+    124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,6,0,16,14,0,16,14,0,16,
+    26,0,16,50,0,16,50,0,16,98,0,16,194,0,16,194,0,17,130,0,19,2,0,19,
+    2,0,22,2,0,28,2,0,28,2,0,24,2,0,120,15,128,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,3,240,0,14,28,0,28,14,0,48,3,0,48,3,0,96,1,128,
+    96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,48,3,0,48,3,0,
+    28,14,0,14,28,0,3,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,24,0,24,0,24,0,24,
+    0,24,0,24,0,24,0,31,224,24,56,24,24,24,12,24,12,24,12,24,24,24,56,127,
+    224,0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,7,128,0,28,0,
+    0,56,0,0,112,0,0,224,0,3,240,0,14,28,0,28,14,0,48,3,0,48,3,0,
+    96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,96,1,128,48,3,0,
+    48,3,0,28,14,0,14,28,0,3,240,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,15,24,14,24,28,
+    24,56,24,48,24,96,24,224,25,192,31,224,24,56,24,24,24,28,24,12,24,28,24,24,
+    24,56,127,224,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,79,0,120,192,96,96,64,48,64,48,0,48,0,112,1,224,7,192,15,
+    0,60,0,112,0,96,32,96,32,96,96,49,224,15,32,0,0,0,0,0,0,0,0,0,
+    0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,224,1,128,1,128,1,128,
+    1,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,1,128,65,130,65,130,97,134,
+    127,254,0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,3,240,0,14,24,0,12,4,0,24,4,0,24,2,
+    0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,0,24,2,
+    0,24,2,0,24,2,0,24,2,0,126,15,128,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1,128,0,1,128,0,1,128,0,3,192,0,3,64,0,3,96,0,6,32,0,6,
+    32,0,6,48,0,12,16,0,12,24,0,24,8,0,24,8,0,24,12,0,48,4,0,48,
+    6,0,252,31,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,131,0,1,131,0,
+    1,131,128,3,135,128,3,70,128,3,70,192,6,70,64,6,76,64,6,76,96,12,44,96,
+    12,44,32,24,44,32,24,24,48,24,24,16,48,24,16,48,24,24,252,126,126,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,252,15,192,48,3,128,24,7,0,8,14,0,4,12,
+    0,6,24,0,2,56,0,1,112,0,0,224,0,0,192,0,1,192,0,3,160,0,3,16,
+    0,6,8,0,14,12,0,28,6,0,126,15,128,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,224,1,128,1,
+    128,1,128,1,128,1,128,1,128,3,192,3,64,6,96,6,32,12,48,28,16,24,24,56,
+    8,48,12,252,63,0,0,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,127,252,112,12,56,4,24,4,28,0,12,0,14,0,7,0,3,0,
+    3,128,1,128,1,192,0,224,64,96,64,112,96,56,127,248,0,0,0,0,0,0,0,0,
+    0,0,8,0,0,0,62,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,62,0,0,0,0,0,7,0,0,0,0,0,0,0,6,6,4,12,12,8,24,24,
+    16,48,48,32,96,96,64,192,192,0,0,0,0,0,8,0,0,0,124,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,124,0,0,0,0,0,11,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,64,64,96,192,32,128,49,128,17,0,27,0,10,0,14,0,4,0,0,0,0,
+    0,0,0,0,0,0,0,13,0,0,0,0,255,248,255,248,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,112,64,96,48,0,0,0,0,0,
+    11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,192,125,128,99,128,97,128,97,
+    128,49,128,29,128,7,128,1,128,49,128,51,128,31,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,47,0,57,192,48,192,48,96,48,96,48,96,48,96,48,96,48,96,48,192,57,192,
+    55,0,48,0,48,0,48,0,48,0,112,0,0,0,0,0,0,0,0,0,0,0,11,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,63,128,56,64,112,0,96,0,96,
+    0,96,0,96,0,96,0,32,192,49,192,15,128,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    15,96,57,192,48,192,96,192,96,192,96,192,96,192,96,192,96,192,48,192,57,192,14,192,
+    0,192,0,192,0,192,0,192,1,192,0,0,0,0,0,0,0,0,0,0,11,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,15,0,63,128,56,64,112,0,96,0,96,0,96,
+    0,127,192,96,192,32,192,49,128,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,
+    48,48,254,48,48,48,22,14,0,0,0,0,0,12,0,0,0,0,31,128,120,224,96,48,
+    96,16,48,48,31,224,63,128,48,0,24,0,31,0,25,128,48,192,48,192,48,192,48,192,
+    25,128,15,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,240,48,96,48,96,48,96,48,
+    96,48,96,48,96,48,96,48,96,56,224,55,192,51,128,48,0,48,0,48,0,48,0,112,
+    0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,120,48,48,48,48,
+    48,48,48,48,48,48,112,0,0,0,48,48,0,0,0,0,0,6,0,0,192,224,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,112,0,0,0,48,48,0,0,0,0,0,12,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,240,48,224,49,192,51,128,55,0,
+    54,0,60,0,52,0,50,0,51,0,49,128,51,224,48,0,48,0,48,0,48,0,112,0,
+    0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,120,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,112,0,0,0,0,0,20,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,241,224,48,96,192,48,96,192,48,
+    96,192,48,96,192,48,96,192,48,96,192,48,96,192,48,96,192,56,241,192,55,207,128,115,
+    135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,
+    240,48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,56,224,55,192,115,128,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,15,0,57,192,48,192,96,96,96,96,96,96,96,96,
+    96,96,96,96,48,192,57,192,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,12,0,0,0,0,120,0,48,0,48,0,48,0,48,0,55,0,57,
+    192,48,192,48,96,48,96,48,96,48,96,48,96,48,96,48,192,57,192,119,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,1,224,
+    0,192,0,192,0,192,0,192,14,192,57,192,48,192,96,192,96,192,96,192,96,192,96,192,
+    96,192,48,192,57,192,14,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,8,0,0,0,0,0,0,0,120,48,48,48,48,48,48,48,48,59,55,115,
+    0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,124,0,99,0,65,128,1,128,3,128,15,0,62,0,56,0,112,0,97,0,51,0,31,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,
+    0,0,0,0,0,28,50,48,48,48,48,48,48,48,48,48,254,112,48,16,0,0,0,0,
+    0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,112,31,96,56,224,
+    48,96,48,96,48,96,48,96,48,96,48,96,48,96,48,96,112,224,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,4,0,14,0,14,0,26,0,25,0,25,0,49,0,48,128,48,128,96,
+    128,96,192,241,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,
+    16,0,14,56,0,14,56,0,26,40,0,26,100,0,25,100,0,49,100,0,48,194,0,48,
+    194,0,96,194,0,96,195,0,241,231,128,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,120,240,48,96,16,192,25,192,13,128,7,0,6,0,13,0,
+    28,128,24,192,48,96,120,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,11,0,0,0,0,224,0,240,0,24,0,8,0,12,0,4,0,14,0,14,
+    0,26,0,25,0,25,0,49,0,48,128,48,128,96,128,96,192,241,224,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,127,128,97,128,48,128,56,0,24,0,28,0,12,0,14,0,7,0,
+    67,0,97,128,127,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,10,0,0,0,0,3,128,6,0,12,0,12,0,12,0,12,0,12,0,12,0,8,
+    0,24,0,16,0,96,0,16,0,24,0,8,0,12,0,12,0,12,0,12,0,12,0,6,
+    0,3,128,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,0,0,0,0,10,0,0,0,0,
+    112,0,24,0,12,0,12,0,12,0,12,0,12,0,12,0,4,0,6,0,2,0,1,128,
+    2,0,6,0,4,0,12,0,12,0,12,0,12,0,12,0,24,0,112,0,0,0,0,0,
+    0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,65,192,99,224,62,48,28,16,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+
+
+#define FONT(name, h, d) {h, d, name##_OFFSETS, name##_DATA}
+
+static const BitmapFont HELVETICA_18 = FONT(HELVETICA_18, 23, 5);
+static const BitmapFont HELVETICA_12 = FONT(HELVETICA_12, 16, 4);
+static const BitmapFont HELVETICA_10 = FONT(HELVETICA_10, 14, 3);
+static const BitmapFont FIXED_8_BY_13 = FONT(FIXED_8_BY_13, 14, 3);
+static const BitmapFont FIXED_9_BY_15 = FONT(FIXED_9_BY_15, 16, 4);
+static const BitmapFont TIMES_ROMAN_10 = FONT(TIMES_ROMAN_10, 14, 4);
+static const BitmapFont TIMES_ROMAN_24 = FONT(TIMES_ROMAN_24, 29, 7);
+
+#undef FONT
+
+
+const BitmapFont * BitmapFont_get(const void * font) {
+    if(font == E2D_BITMAP_HELVETICA_18) {
+        return &HELVETICA_18;
+    } else if(font == E2D_BITMAP_HELVETICA_12) {
+        return &HELVETICA_12;
+    } else if(font == E2D_BITMAP_HELVETICA_10) {
+        return &HELVETICA_10;
+    } else if(font == E2D_BITMAP_8_BY_13) {
+        return &FIXED_8_BY_13;
+    } else if(font == E2D_BITMAP_9_BY_15) {
+        return &FIXED_9_BY_15;
+    } else if(font == E2D_BITMAP_TIMES_ROMAN_10) {
+        return &TIMES_ROMAN_10;
+    } else if(font == E2D_BITMAP_TIMES_ROMAN_24) {
+        return &TIMES_ROMAN_24;
+    } else if(font == E2D_STROKE_ROMAN || font == E2D_STROKE_MONO_ROMAN) {
+        return &HELVETICA_18;
+    }
+
+    return NULL;
+}
+
+const unsigned char * BitmapFont_glyph(const BitmapFont * font, unsigned char c) {
+    if(c < BITMAPFONT_FIRST || c >= BITMAPFONT_FIRST + BITMAPFONT_GLYPHS) return NULL;
+
+    return font->data + font->offsets[c - BITMAPFONT_FIRST];
+}
+
+int BitmapFont_charWidth(const BitmapFont * font, unsigned char c) {
+    const unsigned char * glyph = BitmapFont_glyph(font, c);
+
+    return glyph != NULL ? glyph[0] : 0;
+}
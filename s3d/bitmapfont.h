@@ -0,0 +1,55 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    bitmapfont.h
+ * @brief   Glyphs and metrics of GLUT bitmap fonts (printable ASCII)
+ *          embedded into engine, string widths are known without GLUT
+ *          and fonts can be rasterized by software render backend
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef BITMAPFONT_H
+#define BITMAPFONT_H
+
+
+#define BITMAPFONT_FIRST 32     /** first embedded character */
+#define BITMAPFONT_GLYPHS 95    /** characters 32 - 126 */
+
+//bitmap font, glyph = width byte + height rows from bottom, row has
+//(width + 7) / 8 bytes, most significant bit is left pixel (glBitmap layout)
+typedef struct {
+    int height;     /** rows of each glyph */
+    int descent;    /** rows under base line */
+    const unsigned short * offsets; /** offset of each glyph in data */
+    const unsigned char * data;
+} BitmapFont;
+
+
+/**
+ * @brief BitmapFont_get Embedded font of GLUT font (E2D_*), stroke fonts
+ *        are replaced by Helvetica 18
+ * @param font
+ * @return NULL if font is not GLUT font
+ */
+const BitmapFont * BitmapFont_get(const void * font);
+
+/**
+ * @brief BitmapFont_glyph
+ * @param font
+ * @param c
+ * @return Glyph of character, NULL if character is not embedded
+ */
+const unsigned char * BitmapFont_glyph(const BitmapFont * font, unsigned char c);
+
+/**
+ * @brief BitmapFont_charWidth Advance of character (same as glutBitmapWidth)
+ * @param font
+ * @param c
+ * @return 0 if character is not embedded
+ */
+int BitmapFont_charWidth(const BitmapFont * font, unsigned char c);
+
+#endif // BITMAPFONT_H
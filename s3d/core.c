@@ -12,33 +12,42 @@
 #include "core.h"
 
 #include <pthread.h>
-#include <unistd.h>
+#include <math.h>
+#include <string.h>
+#if !__APPLE__
+#include <GL/freeglut_ext.h>
+#endif
 #include "engine_object.h"
+#include "scenestore.h"
+#include "epoch.h"
+#include "inputqueue.h"
+#include "profiler.h"
+#include "rendergl.h"
+#include "rendergl33.h"
 
 
 static CORE * _core = NULL;
 
 static pthread_t _thread_update;
+static bool _thread_update_started = false;
 
-static bool _running = false;
+static atomic_bool _running = false;
 static bool _glut_main_loop = false;
 
-//core events iterrupts
-static bool _interrupt_resize = false;
-static bool _interrupt_render = false;
-static bool _interrupt_update = false;
-static bool _interrupt_press_key = false;
-static bool _interrupt_release_key = false;
-static bool _interrupt_mouse_move = false;
-static bool _interrupt_mouse_button = false;
+//input events of GLUT callbacks, dispatched by update thread
+static InputQueue _input;
+
+//fixed timestep of update thread
+static Scheduler _scheduler;
+static int64_t _update_time = 0;
+
+//frames are redrawn only if objects marked damage
+static Damage_Stats _render_stats;
+//damage of previous frame, back buffer does not contain it yet
+static Damage_Region _damage_last = {true, 0, {{0, 0, 0, 0}}};
 
 //core events
-static Event_Key    _key_event_press;
-static Event_Key    _key_event_release;
-static Event_Mouse  _mouse_event_move;
-static Event_Mouse  _mouse_event_button;
 static Event_Render _render_event;
-static Event_Resize _resize_event;
 static Event_Update _update_event;
 
 
@@ -79,7 +88,7 @@ static void specialFunc(int key, int x, int y);
 static void specialUpFunc(int key, int x, int y);
 
 /**
- * @brief Key press event
+ * @brief Key press event, queued for update thread
  * @param key   Pressed key (char)
  * @param ctrl  CTRL is down?
  * @param alt   ALT is down?
@@ -89,7 +98,7 @@ static void evt_pressKey(unsigned char key,  bool ctrl,
                          bool alt, bool shift, Arrow_key arrow);
 
 /**
- * @brief Key release event
+ * @brief Key release event, queued for update thread
  * @param key   Released key (char)
  * @param ctrl  CTRL is down?
  * @param alt   ALT is down?
@@ -99,14 +108,14 @@ static void evt_releaseKey(unsigned char key,  bool ctrl,
                            bool alt, bool shift, Arrow_key arrow);
 
 /**
- * @brief Mouse move event
+ * @brief Mouse move event, queued for update thread
  * @param x         X position of mouse cursore
  * @param y         Y position of mouse cursore
  */
 static void evt_mouseMove(int x, int y);
 
 /**
- * @brief Mouse button event
+ * @brief Mouse button event, queued for update thread
  * @param button    Button ID
  * @param state     Button state
  * @param x         none
@@ -115,14 +124,21 @@ static void evt_mouseMove(int x, int y);
 static void evt_mouseButton(int button, int state, int x, int y);
 
 /**
- * @brief GLUT reshape function
+ * @brief Dispatch input or resize event to objects of current scene (update thread)
+ * @param event     Event from input queue
+ * @param context   none
+ */
+static void dispatchInput(const Input_Event * event, void * context);
+
+/**
+ * @brief GLUT reshape function, sets viewport and queues resize for update thread
  * @param w Window width
  * @param h Window height
  */
 static void reshape(int w, int h);
 
 /**
- * @brief Update eache E_Obj of current scene
+ * @brief Update eache E_Obj of current scene and publish their render state
  */
 static void updateScene();
 
@@ -141,6 +157,11 @@ static void * updateLoop(void * args);
  */
 static void renderScene();
 
+/**
+ * @brief Render each E_Obj of current scene (limited by scissor)
+ */
+static void renderObjects();
+
 /**
  * @brief Exit event of engine
  */
@@ -157,8 +178,30 @@ bool CORE_init(int argc, char **argv, CORE * core) {
     _core->textures = (Vector*) malloc(sizeof(Vector));
     if(!Vector_init(_core->textures, 20, 10)) return false;
 
+    if(!InputQueue_init(&_input, CORE_INPUT_QUEUE_SIZE)) return false;
+
+    //GLUT callbacks run on calling thread
+    Profiler_init();
+    Profiler_registerThread("render");
+
+    //render backend, environment variable overrides config
+    const Render_Backend * backend = core->renderBackend;
+    const char * renderer = getenv(CORE_ENV_RENDERER);
+    if(renderer != NULL) {
+        if(strcmp(renderer, RENDERGL33_BACKEND.name) == 0) backend = &RENDERGL33_BACKEND;
+        if(strcmp(renderer, RENDERGL_BACKEND.name) == 0) backend = &RENDERGL_BACKEND;
+    }
+    Render_setBackend(backend);
+
     //init glut window
     glutInit(&argc, argv);
+#ifdef GLUT_CORE_PROFILE
+    int gl_version = Render_getBackend()->gl_version;
+    if(gl_version > 0) {
+        glutInitContextVersion(gl_version / 10, gl_version % 10);
+        glutInitContextProfile(GLUT_CORE_PROFILE);
+    }
+#endif
     glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH | GLUT_MULTISAMPLE);
     glutInitWindowSize(core->window_width, core->window_height);
     glutInitWindowPosition((glutGet(GLUT_SCREEN_WIDTH) - core->window_width) / 2,
@@ -182,17 +225,8 @@ bool CORE_init(int argc, char **argv, CORE * core) {
     glutMouseFunc(evt_mouseButton);
     glutPassiveMotionFunc(evt_mouseMove);
 
-    //opengl config
-    glEnable(GL_SCISSOR_TEST);
-    glDepthFunc(GL_NEVER);
-    glEnable(GL_MULTISAMPLE);
-    glHint(GL_MULTISAMPLE_FILTER_HINT_NV, GL_NICEST);
-    glEnable(GL_LINE_SMOOTH);
-    glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
-    glEnable(GL_POINT_SMOOTH);
-    glHint(GL_POINT_SMOOTH_HINT, GL_NICEST);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    //render backend config
+    Render_init();
 
     //cursor
     if(!core->visibleCursor) {
@@ -205,44 +239,28 @@ bool CORE_init(int argc, char **argv, CORE * core) {
 bool CORE_setSceneData(SceneData * scene) {
     if(_core == NULL || scene == NULL) return false;
 
-    bool status = false;
-    if(_core->scene == NULL) {
-        _core->scene = scene;
-        status = true;
-    } else {
-        status = switchSceneData(scene);
-    }
+    if(!switchSceneData(scene)) return false;
 
-    E_Obj * obj;
-    LinkedList_Element * el = _core->scene->gameData->first;
-    while(el != NULL) {
-        if(el->ptr != NULL) {
-            obj = (E_Obj*) el->ptr;
-            if(obj->events) {
-                if(obj->events->onLoad) obj->events->onLoad(obj, _core->scene);
-            }
-        }
-        el = LinkedList_next(el);
+    Epoch_enter();
+    const SceneStore_Array * array = &SceneStore_read(scene->gameData)->dispatch[SceneStore_OnLoad];
+    unsigned int count = SceneStore_count(array);
+    for(unsigned int i = 0; i < count; ++i) {
+        array->data[i].handler.onLoad(array->data[i].obj, scene);
     }
+    Epoch_exit();
 
-    return status;
+    return true;
 }
 
 bool CORE_run() {
     if(_core == NULL) return false;
 
-    _interrupt_resize = true;
-    _interrupt_render = true;
-    _interrupt_update = true;
-    _interrupt_press_key = true;
-    _interrupt_release_key = true;
-    _interrupt_mouse_move = true;
-    _interrupt_mouse_button = true;
-    _running = true;
+    atomic_store(&_running, true);
 
     if(pthread_create(&_thread_update, NULL, updateLoop, NULL)) {
         return false;
     }
+    _thread_update_started = true;
 
     renderLoop();
 
@@ -257,22 +275,15 @@ bool CORE_run() {
 
 void CORE_stop() {
     if(_core == NULL) return;
-    _interrupt_resize = false;
-    _interrupt_render = false;
-    _interrupt_update = false;
-    _interrupt_press_key = false;
-    _interrupt_release_key = false;
-    _interrupt_mouse_move = false;
-    _interrupt_mouse_button = false;
-    _running = false;
+    atomic_store(&_running, false);
 }
 
 
 bool CORE_destruct() {
     if(_core == NULL) return false;
 
-    if(SceneData_destruct(_core->scene)) {
-        _core->scene = NULL;
+    if(SceneData_destruct(atomic_load(&_core->scene))) {
+        atomic_store(&_core->scene, NULL);
     }
 
     if(_core->textures != NULL) {
@@ -280,6 +291,9 @@ bool CORE_destruct() {
         free(_core->textures);
     }
 
+    InputQueue_destruct(&_input);
+    Text_destruct();
+
     return true;
 }
 
@@ -292,7 +306,7 @@ bool CORE_loadTexture(const char * path, Texture ** texture, bool rgba_mode) {
     Vector_Element * el = (Vector_Element*) malloc(sizeof (Vector_Element));
     if(el == NULL) return false;
     el->ptr = tex;
-    el->destruct = UTIL_simpleDestructor;
+    el->destruct = UTIL_destructTexture;
     Vector_append(_core->textures, el);
     if(texture != NULL) {
         *texture = tex;
@@ -301,6 +315,14 @@ bool CORE_loadTexture(const char * path, Texture ** texture, bool rgba_mode) {
     return true;
 }
 
+const Scheduler_Stats * CORE_getUpdateStats() {
+    return &_scheduler.stats;
+}
+
+const Damage_Stats * CORE_getRenderStats() {
+    return &_render_stats;
+}
+
 E2API Vector * CORE_getTextures() {
     if(_core == NULL) return NULL;
     if(_core->textures == NULL) return NULL;
@@ -312,8 +334,9 @@ SceneData * SceneData_create() {
     SceneData * scene = (SceneData*) malloc(sizeof(SceneData));
     if(scene == NULL) return NULL;
 
-    scene->gameData = (LinkedList*) malloc(sizeof(LinkedList));
-    if(!LinkedList_init(scene->gameData)) {
+    scene->gameData = (SceneStore*) malloc(sizeof(SceneStore));
+    if(scene->gameData == NULL || !SceneStore_init(scene->gameData)) {
+        free(scene->gameData);
         free(scene);
         return NULL;
     }
@@ -333,7 +356,8 @@ bool SceneData_destruct(SceneData * scene) {
 
     if(scene) {
         if(scene->gameData) {
-            LinkedList_destruct(scene->gameData);
+            SceneStore_destruct(scene->gameData);
+            free(scene->gameData);
         }
         if(scene->files) {
             Vector_destruct(scene->files);
@@ -344,41 +368,35 @@ bool SceneData_destruct(SceneData * scene) {
     return true;
 }
 
+static void destructScene(void * scene) {
+    SceneData_destruct((SceneData*) scene);
+}
+
+bool SceneData_retire(SceneData * scene) {
+    if(scene == NULL) return false;
+    if(_core != NULL && atomic_load(&_core->scene) == scene) return false;
+
+    return Epoch_retire(scene, destructScene);
+}
+
 static void reshape(int w, int h) {
     if(_core != NULL) {
-        _resize_event.resize_ratio_horizontal = (double) w / (double) _core->window_width;
-        _resize_event.resize_ratio_vertical = (double) h / (double) _core->window_height;
-        _resize_event.current_window_width = w;
-        _resize_event.current_window_height = h;
+        //objects are resized by update thread, render thread only changes viewport
+        Input_Event event;
+        event.type = Input_Resize;
+        event.data.resize.resize_ratio_horizontal = (double) w / (double) _core->window_width;
+        event.data.resize.resize_ratio_vertical = (double) h / (double) _core->window_height;
+        event.data.resize.current_window_width = w;
+        event.data.resize.current_window_height = h;
+        event.data.resize.sender = &_core;
+        InputQueue_push(&_input, &event);
 
         _core->window_width = w;
         _core->window_height = h;
-        glViewport(0, 0, w, h);       /* Establish viewing area to cover entire window. */
-        glMatrixMode(GL_PROJECTION);  /* Start modifying the projection matrix. */
-        glLoadIdentity();             /* Reset project matrix. */
-        glOrtho(0, w, 0, h, -1, 1);   /* Map abstract coords directly to window coords. */
-        glScalef(1, -1, 1);           /* Invert Y axis so increasing Y goes down. */
-        glTranslatef(0, -h, 0);       /* Shift origin up to upper-left corner. */
-
-        if(_core->scene != NULL) {
-            if(_core->scene->gameData != NULL) {
-                E_Obj * obj;
-                LinkedList_Element * el = _core->scene->gameData->first;
-                while(el != NULL) {
-                    if(_interrupt_resize) {
-                        _interrupt_resize = false;
-                        break;
-                    }
-                    if(el->ptr != NULL) {
-                        obj = (E_Obj*) el->ptr;
-                        if(obj->events) {
-                            if(obj->events->resize) obj->events->resize(obj, &_resize_event);
-                        }
-                    }
-                    el = LinkedList_next(el);
-                }
-            }
-        }
+        Render_viewport(w, h);
+
+        Damage_markAll();
+        Damage_commit();
     }
 }
 
@@ -389,90 +407,135 @@ static void renderScene() {
     _render_event.window_height = _core->window_height;
     _render_event.sender = _core;
 
-    Render_clear(&_render_event, &_core->clearColor);
-
-    if(_core->scene == NULL) {
-        glutSwapBuffers();
-        return;
-    }
-    if(_core->scene->gameData == NULL) {
-        glutSwapBuffers();
-        return;
-    }
-
-    E_Obj * obj;
-    LinkedList_Element * el = _core->scene->gameData->first;
-    while(el != NULL) {
-        if(_interrupt_render) {
-            _interrupt_render = false;
-            break;
-        }
-        if(el->ptr != NULL) {
-            obj = (E_Obj*) el->ptr;
-            if(obj->events) {
-                if(obj->events->render) obj->events->render(obj, &_render_event);
-            }
+    PROFILER_BEGIN(frame);
+
+    Damage_Region damage;
+    Damage_take(&damage);
+    //redisplay requested by window system (expose) -> damage is empty
+    if(!_core->partialRedraw || (!damage.full && damage.count == 0)) damage.full = true;
+    //overlay changes each frame
+    if(Profiler_isEnabled()) damage.full = true;
+
+    //back buffer is two frames old, redraw also damage of previous frame
+    Damage_Region region = damage;
+    Damage_merge(&region, &_damage_last);
+    _damage_last = damage;
+
+    //objects referenced by commands of backend stay alive until flush
+    Epoch_enter();
+    ++_render_stats.frames;
+    if(region.full) {
+        Render_setBaseScissor(0, 0, 0, 0);
+        Render_resetScissor(&_render_event);
+        renderObjects();
+        Profiler_renderOverlay(&_render_event);
+    } else {
+        ++_render_stats.partial;
+        for(unsigned int i = 0; i < region.count; ++i) {
+            const Damage_Rect * r = &region.rects[i];
+            int x0 = floorf(r->x0), y0 = floorf(r->y0);
+            Render_setBaseScissor(x0, y0, ceilf(r->x1) - x0, ceilf(r->y1) - y0);
+            Render_resetScissor(&_render_event);
+            renderObjects();
         }
-        el = LinkedList_next(el);
+        Render_setBaseScissor(0, 0, 0, 0);
+        Render_resetScissor(&_render_event);
     }
 
+    Render_flush();
+    Epoch_exit();
     glutSwapBuffers();
+    PROFILER_END(frame, Profiler_Frame, NULL);
+}
+
+static void renderObjects() {
+    Render_clear(&_render_event, &_core->clearColor);
+
+    Epoch_enter();
+    SceneData * scene = atomic_load(&_core->scene);
+    if(scene != NULL) {
+        const SceneStore_Array * array = &SceneStore_read(scene->gameData)->dispatch[SceneStore_Render];
+        unsigned int count = SceneStore_count(array);
+        for(unsigned int i = 0; i < count; ++i) {
+            if(atomic_load_explicit(&_core->scene, memory_order_relaxed) != scene) break;
+            PROFILER_BEGIN(start);
+            array->data[i].handler.render(array->data[i].obj, &_render_event);
+            PROFILER_END(start, Profiler_Render, array->data[i].obj);
+        }
+    }
+    Epoch_exit();
 }
 
 static void updateScene() {
     if(_core == NULL) return;
-    if(!_running) return;
-
-    if(_core->scene != NULL) {
-        if(_core->scene->gameData != NULL) {
+    if(!atomic_load(&_running)) return;
+
+    Epoch_enter();
+    SceneData * scene = atomic_load(&_core->scene);
+    if(scene != NULL) {
+        const SceneStore_Table * table = SceneStore_read(scene->gameData);
+
+        //each update advances time by one fixed step
+        _update_time += _scheduler.step;
+        _update_event.ns_time = _update_time % 1000000000L;
+        _update_event.s_time = _update_time / 1000000000L;
+        _update_event.ns_diff = _scheduler.step % 1000000000L;
+        _update_event.s_diff = _scheduler.step / 1000000000L;
+        _update_event.sender = &_core;
+
+        //update all
+        const SceneStore_Array * array = &table->dispatch[SceneStore_Update];
+        unsigned int count = SceneStore_count(array);
+        for(unsigned int i = 0; i < count; ++i) {
+            if(atomic_load_explicit(&_core->scene, memory_order_relaxed) != scene) break;
+            PROFILER_BEGIN(start);
+            array->data[i].handler.update(array->data[i].obj, scene, &_update_event);
+            PROFILER_END(start, Profiler_Update, array->data[i].obj);
+        }
 
-            struct timespec time = UTIL_getSystemTime();
-            //diff
-            __syscall_slong_t diff = time.tv_nsec - _update_event.ns_time;
-            if (diff < 0) {
-                _update_event.ns_diff = time.tv_nsec - _update_event.ns_time + 1000000000UL;
-                _update_event.s_diff = time.tv_sec - _update_event.s_time + 1;
-            } else {
-                _update_event.ns_diff = diff;
-                _update_event.s_diff = time.tv_sec - _update_event.s_time;
-            }
-            //current time
-            _update_event.ns_time = time.tv_nsec;
-            _update_event.s_time = time.tv_sec;
-            _update_event.sender = &_core;
-
-            //update all
-            E_Obj * obj;
-            LinkedList_Element * el = _core->scene->gameData->first;
-            while(el != NULL) {
-                if(_interrupt_update) {
-                    _interrupt_update = false;
-                    break;
-                }
-                if(el->ptr != NULL) {
-                    obj = (E_Obj*) el->ptr;
-                    if(obj->events) {
-                        if(obj->events->update) obj->events->update(obj, _core->scene,
-                                                                    &_update_event);
-                    }
-                }
-                el = LinkedList_next(el);
-            }
+        //publish render state of updated objects for render thread
+        array = &table->dispatch[SceneStore_Publish];
+        count = SceneStore_count(array);
+        for(unsigned int i = 0; i < count; ++i) {
+            PROFILER_BEGIN(start);
+            array->data[i].handler.publish(array->data[i].obj);
+            PROFILER_END(start, Profiler_Publish, array->data[i].obj);
         }
     }
+    Epoch_exit();
+
+    //damage is visible to render loop only together with published state
+    Damage_commit();
 }
 
 static void renderLoop() {
     if(!_core) return;
-    if(!_running) return;
-    glutPostRedisplay();
+    if(!atomic_load(&_running)) return;
+    if(Damage_pending() || Profiler_isEnabled()) {
+        glutPostRedisplay();
+    } else {
+        ++_render_stats.skipped;
+    }
     glutTimerFunc(1000.0/_core->fps, renderLoop, 0);
 }
 
 static void * updateLoop(void * args) {
-    while(_running) {
-        updateScene();
-        usleep((unsigned int)(1e6/_core->ups));
+    if(!Scheduler_init(&_scheduler, _core->ups, CORE_MAX_UPDATE_STEPS)) return NULL;
+    _update_time = Scheduler_now();
+    Profiler_registerThread("update");
+
+    unsigned int steps;
+    while(atomic_load(&_running)) {
+        steps = Scheduler_wait(&_scheduler);
+        PROFILER_BEGIN(tick);
+        //input of whole tick, consecutive mouse moves are merged
+        InputQueue_drain(&_input, dispatchInput, NULL);
+        for(unsigned int i = 0; i < steps; ++i) {
+            updateScene();
+        }
+        //free retired scenes, objects and tables
+        Epoch_collect();
+        PROFILER_END(tick, Profiler_Tick, NULL);
     }
     return NULL;
 }
@@ -490,6 +553,14 @@ static void keyboardUpFunc(unsigned char key, int x, int y) {
 }
 
 static void specialFunc(int key, int x, int y) {
+    if(key == CORE_PROFILER_KEY) {
+        Profiler_setEnabled(!Profiler_isEnabled());
+        //overlay is drawn over whole window
+        Damage_markAll();
+        Damage_commit();
+        return;
+    }
+
     Arrow_key arrow_key = NONE;
     switch(key)
     {
@@ -510,6 +581,8 @@ static void specialFunc(int key, int x, int y) {
 }
 
 static void specialUpFunc(int key, int x, int y) {
+    if(key == CORE_PROFILER_KEY) return;
+
     Arrow_key arrow_key = NONE;
     switch(key)
     {
@@ -531,140 +604,108 @@ static void specialUpFunc(int key, int x, int y) {
 
 static void evt_pressKey(unsigned char key, bool ctrl,
                          bool alt, bool shift, Arrow_key arrow) {
-    _key_event_press.key = key;
-    _key_event_press.ctrl = ctrl;
-    _key_event_press.alt = alt;
-    _key_event_press.shift = shift;
-    _key_event_press.arrow = arrow;
-    _key_event_press.sender = &_core;
-
     if(_core == NULL) return;
-    if(!_running) return;
-    if(_core->scene == NULL) return;
-    if(_core->scene->gameData == NULL) return;
-
-    E_Obj * obj;
-    LinkedList_Element * el = _core->scene->gameData->first;
-    while(el != NULL) {
-        if(_interrupt_press_key) {
-            _interrupt_press_key = false;
-            break;
-        }
-        if(el->ptr != NULL) {
-            obj = (E_Obj*) el->ptr;
-            if(obj->events) {
-                if(obj->events->pressKeyEvt) obj->events->pressKeyEvt(obj, _core->scene,
-                                                                      &_key_event_press);
-            }
-        }
-        el = LinkedList_next(el);
-    }
+    if(!atomic_load(&_running)) return;
+
+    Input_Event event;
+    event.type = Input_PressKey;
+    event.data.key.key = key;
+    event.data.key.ctrl = ctrl;
+    event.data.key.alt = alt;
+    event.data.key.shift = shift;
+    event.data.key.arrow = arrow;
+    event.data.key.sender = &_core;
+    InputQueue_push(&_input, &event);
 }
 
 static void evt_releaseKey(unsigned char key, bool ctrl,
                            bool alt, bool shift, Arrow_key arrow) {
-    _key_event_release.key = key;
-    _key_event_release.ctrl = ctrl;
-    _key_event_release.alt = alt;
-    _key_event_release.shift = shift;
-    _key_event_release.arrow = arrow;
-    _key_event_release.sender = &_core;
-
     if(_core == NULL) return;
-    if(!_running) return;
-    if(_core->scene == NULL) return;
-    if(_core->scene->gameData == NULL) return;
-
-    E_Obj * obj;
-    LinkedList_Element * el = _core->scene->gameData->first;
-    while(el != NULL) {
-        if(_interrupt_release_key) {
-            _interrupt_release_key = false;
-            break;
-        }
-        if(el->ptr != NULL) {
-            obj = (E_Obj*) el->ptr;
-            if(obj->events) {
-                if(obj->events->releaseKeyEvt) obj->events->releaseKeyEvt(obj, _core->scene,
-                                                                          &_key_event_release);
-            }
-        }
-        el = LinkedList_next(el);
-    }
+    if(!atomic_load(&_running)) return;
+
+    Input_Event event;
+    event.type = Input_ReleaseKey;
+    event.data.key.key = key;
+    event.data.key.ctrl = ctrl;
+    event.data.key.alt = alt;
+    event.data.key.shift = shift;
+    event.data.key.arrow = arrow;
+    event.data.key.sender = &_core;
+    InputQueue_push(&_input, &event);
 }
 
 static void evt_mouseMove(int x, int y) {
-    _mouse_event_move.x = x;
-    _mouse_event_move.y = y;
-    _mouse_event_button.sender = &_core;
-
     if(_core == NULL) return;
-    if(!_running) return;
-    if(_core->scene == NULL) return;
-    if(_core->scene->gameData == NULL) return;
-
-    E_Obj * obj;
-    LinkedList_Element * el = _core->scene->gameData->first;
-    while(el != NULL) {
-        if(_interrupt_mouse_move) {
-            _interrupt_mouse_move = false;
-            break;
-        }
-        if(el->ptr != NULL) {
-            obj = (E_Obj*) el->ptr;
-            if(obj->events) {
-                if(obj->events->mouseMoveEvt) obj->events->mouseMoveEvt(obj, _core->scene,
-                                                                        &_mouse_event_move);
-            }
-        }
-        el = LinkedList_next(el);
-    }
+    if(!atomic_load(&_running)) return;
+
+    Input_Event event;
+    event.type = Input_MouseMove;
+    event.data.mouse.button = 0;
+    event.data.mouse.state = 0;
+    event.data.mouse.x = x;
+    event.data.mouse.y = y;
+    event.data.mouse.sender = &_core;
+    InputQueue_push(&_input, &event);
 }
 
 static void evt_mouseButton(int button, int state, int x, int y) {
-    _mouse_event_button.button = button;
-    _mouse_event_button.state = state;
-    _mouse_event_button.x = x;
-    _mouse_event_button.y = y;
-    _mouse_event_button.y = y;
-    _mouse_event_button.sender = &_core;
-
     if(_core == NULL) return;
-    if(!_running) return;
-    if(_core->scene == NULL) return;
-    if(_core->scene->gameData == NULL) return;
-
-    E_Obj * obj;
-    LinkedList_Element * el = _core->scene->gameData->first;
-    while(el != NULL) {
-        if(_interrupt_mouse_button) {
-            _interrupt_mouse_button = false;
-            break;
-        }
-        if(el->ptr != NULL) {
-            obj = (E_Obj*) el->ptr;
-            if(obj->events) {
-                if(obj->events->mouseButtonEvt) obj->events->mouseButtonEvt(obj, _core->scene,
-                                                                            &_mouse_event_button);
+    if(!atomic_load(&_running)) return;
+
+    Input_Event event;
+    event.type = Input_MouseButton;
+    event.data.mouse.button = button;
+    event.data.mouse.state = state;
+    event.data.mouse.x = x;
+    event.data.mouse.y = y;
+    event.data.mouse.sender = &_core;
+    InputQueue_push(&_input, &event);
+}
+
+static void dispatchInput(const Input_Event * event, void * context) {
+    (void) context;
+    static const SceneStore_Event DISPATCH[] = {
+        [Input_PressKey] = SceneStore_PressKey,
+        [Input_ReleaseKey] = SceneStore_ReleaseKey,
+        [Input_MouseMove] = SceneStore_MouseMove,
+        [Input_MouseButton] = SceneStore_MouseButton,
+        [Input_Resize] = SceneStore_Resize
+    };
+
+    Epoch_enter();
+    //scene can be switched by previous event
+    SceneData * scene = atomic_load(&_core->scene);
+    if(scene != NULL) {
+        const SceneStore_Array * array = &SceneStore_read(scene->gameData)->dispatch[DISPATCH[event->type]];
+        unsigned int count = SceneStore_count(array);
+        for(unsigned int i = 0; i < count; ++i) {
+            if(atomic_load_explicit(&_core->scene, memory_order_relaxed) != scene) break;
+            PROFILER_BEGIN(start);
+            if(event->type == Input_Resize) {
+                array->data[i].handler.resize(array->data[i].obj, &event->data.resize);
+            } else if(event->type == Input_PressKey || event->type == Input_ReleaseKey) {
+                array->data[i].handler.key(array->data[i].obj, scene, &event->data.key);
+            } else {
+                array->data[i].handler.mouse(array->data[i].obj, scene, &event->data.mouse);
             }
+            PROFILER_END(start, event->type == Input_Resize ? Profiler_Resize : Profiler_Input,
+                         array->data[i].obj);
         }
-        el = LinkedList_next(el);
     }
+    Epoch_exit();
+
+    //resized objects are redrawn after their new bounds are published
+    if(event->type == Input_Resize) Damage_markAll();
 }
 
 static bool switchSceneData(SceneData * data) {
     if(data == NULL) return false;
     if(_core == NULL) return false;
 
-    _interrupt_resize = false;
-    _interrupt_render = false;
-    _interrupt_update = false;
-    _interrupt_press_key = false;
-    _interrupt_release_key = false;
-    _interrupt_mouse_move = false;
-    _interrupt_mouse_button = false;
-
-    _core->scene = data;
+    //running dispatch loops of old scene stop at next object, old scene stays valid
+    //for them until they leave critical section
+    atomic_store(&_core->scene, data);
+    Damage_markAll();
 
     return true;
 }
@@ -672,16 +713,14 @@ static bool switchSceneData(SceneData * data) {
 static void exitEvent() {
     if(_core != NULL) {
 
-        _running = false;
-        _interrupt_resize = false;
-        _interrupt_render = false;
-        _interrupt_update = false;
-        _interrupt_press_key = false;
-        _interrupt_release_key = false;
-        _interrupt_mouse_move = false;
-        _interrupt_mouse_button = false;
-        sleep(1);
+        atomic_store(&_running, false);
+        if(_thread_update_started && !pthread_equal(pthread_self(), _thread_update)) {
+            pthread_join(_thread_update, NULL);
+            _thread_update_started = false;
+        }
 
         CORE_destruct();
+        Epoch_destruct();
+        Profiler_destruct();
     }
 }
@@ -19,7 +19,10 @@
 #include "linkedlist.h"
 #include "vector.h"
 #include "render.h"
+#include "scheduler.h"
+#include "damage.h"
 #include <stdbool.h>
+#include <stdatomic.h>
 
 
 #define CORE_DEFAULT_CONFIG {\
@@ -32,12 +35,28 @@
     true,\
     false,\
     (Color){0.0, 0.0, 0.0, 1.0},\
+    false,\
+    NULL,\
     NULL,\
     NULL\
     }
 
+//maximum number of update steps executed at once to catch up missed deadlines
+#define CORE_MAX_UPDATE_STEPS 5
+
+//capacity of input event queue (events of one update tick)
+#define CORE_INPUT_QUEUE_SIZE 256
+
+//special key toggling profiler overlay (profiler.h), key is not passed to scene
+#define CORE_PROFILER_KEY GLUT_KEY_F12
+
+//environment variable with name of render backend ("gl", "gl33"), overrides CORE.renderBackend
+#define CORE_ENV_RENDERER "S3D_RENDERER"
+
+struct _SceneStore;
+
 typedef struct {
-    LinkedList * gameData;  /** game data, list consisting only from <E_Obj> engine_object.h */
+    struct _SceneStore * gameData;  /** game data, consisting only from <E_Obj> engine_object.h (scenestore.h) */
     Vector * files; /** vector of all opened files */
 } SceneData;
 
@@ -47,12 +66,14 @@ typedef struct {
     char windonw_title[255];   /** Window title */
     bool window_fullScreen; /** True -> fullscreen mode */
     unsigned int fps;   /** Frames per second */
-    unsigned int ups;   /** Updates per second */
+    unsigned int ups;   /** Updates per second (fixed timestep of update event) */
     bool visibleCursor; /** Is cursor visible? */
     bool mouseCamControl; /** Control camera by mouse motion */
     Color clearColor; /** Background color of window */
-    SceneData * scene;  /** Core context */
+    bool partialRedraw; /** Redraw only damaged rectangles (buffer swap has to keep content of back buffer) */
+    _Atomic(SceneData *) scene;  /** Current scene, switched atomically (read in critical section of epoch.h) */
     Vector * textures;    /** vector of all textures, consisting only from <Texture> util.h */
+    const Render_Backend * renderBackend; /** NULL -> legacy GL (rendergl.h), RENDERGL33_BACKEND -> GL 3.3 core (rendergl33.h) */
 } CORE;
 
 
@@ -89,6 +110,20 @@ E2API void CORE_stop();
  */
 E2API bool CORE_destruct();
 
+/**
+ * @brief CORE_getUpdateStats Timing statistics of update loop (jitter, overruns),
+ *        written by update thread
+ * @return
+ */
+E2API const Scheduler_Stats * CORE_getUpdateStats();
+
+/**
+ * @brief CORE_getRenderStats Counts of redrawn and skipped frames (damage.h),
+ *        written by render thread
+ * @return
+ */
+E2API const Damage_Stats * CORE_getRenderStats();
+
 /**
  * @brief CORE_loadTexture
  * @param path
@@ -110,11 +145,19 @@ E2API Vector * CORE_getTextures();
 E2API SceneData * SceneData_create();
 
 /**
- * @brief SceneData_destruct
+ * @brief SceneData_destruct Destruct scene immediately, no thread may dispatch its events
  * @param contx
  * @return
  */
 E2API bool SceneData_destruct(SceneData * scene);
 
+/**
+ * @brief SceneData_retire Destruct scene once no dispatcher can hold reference on it,
+ *        scene must not be current scene of core
+ * @param scene
+ * @return
+ */
+E2API bool SceneData_retire(SceneData * scene);
+
 
 #endif // CORE_H
@@ -0,0 +1,131 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    damage.c
+ * @brief   Implementation of damage.h
+ * <------------------------------------------------------------------>
+ */
+
+#include "damage.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "util.h"
+
+
+static pthread_mutex_t _lock = PTHREAD_MUTEX_INITIALIZER;
+
+//damage marked since last commit
+static Damage_Region _marked = {false, 0, {{0, 0, 0, 0}}};
+//damage waiting for render loop, first frame draws whole window
+static Damage_Region _committed = {true, 0, {{0, 0, 0, 0}}};
+static atomic_bool _pending = true;
+
+static _Thread_local float _offset_x = 0.0;
+static _Thread_local float _offset_y = 0.0;
+
+
+static float area(const Damage_Rect * r) {
+    return (r->x1 - r->x0) * (r->y1 - r->y0);
+}
+
+static Damage_Rect join(const Damage_Rect * a, const Damage_Rect * b) {
+    return (Damage_Rect){MIN(a->x0, b->x0), MIN(a->y0, b->y0), MAX(a->x1, b->x1), MAX(a->y1, b->y1)};
+}
+
+static bool overlaps(const Damage_Rect * a, const Damage_Rect * b) {
+    return a->x0 <= b->x1 && b->x0 <= a->x1 && a->y0 <= b->y1 && b->y0 <= a->y1;
+}
+
+void Damage_markRect(float x, float y, float width, float height) {
+    if(width <= 0 || height <= 0) return;
+
+    Damage_Rect rect = {x + _offset_x, y + _offset_y, x + _offset_x + width, y + _offset_y + height};
+    pthread_mutex_lock(&_lock);
+    Damage_add(&_marked, &rect);
+    pthread_mutex_unlock(&_lock);
+}
+
+void Damage_markAll() {
+    pthread_mutex_lock(&_lock);
+    _marked.full = true;
+    pthread_mutex_unlock(&_lock);
+}
+
+void Damage_applyOffset(float x, float y) {
+    _offset_x += x;
+    _offset_y += y;
+}
+
+void Damage_commit() {
+    pthread_mutex_lock(&_lock);
+    if(_marked.full || _marked.count > 0) {
+        Damage_merge(&_committed, &_marked);
+        _marked.full = false;
+        _marked.count = 0;
+        atomic_store(&_pending, true);
+    }
+    pthread_mutex_unlock(&_lock);
+}
+
+bool Damage_pending() {
+    return atomic_load(&_pending);
+}
+
+void Damage_take(Damage_Region * region) {
+    pthread_mutex_lock(&_lock);
+    *region = _committed;
+    _committed.full = false;
+    _committed.count = 0;
+    atomic_store(&_pending, false);
+    pthread_mutex_unlock(&_lock);
+}
+
+void Damage_add(Damage_Region * region, const Damage_Rect * rect) {
+    if(region->full) return;
+
+    //merge with overlapping rectangle, union can overlap others -> repeat
+    Damage_Rect r = *rect;
+    unsigned int i = 0;
+    while(i < region->count) {
+        if(overlaps(&region->rects[i], &r)) {
+            r = join(&region->rects[i], &r);
+            region->rects[i] = region->rects[--region->count];
+            i = 0;
+        } else {
+            ++i;
+        }
+    }
+
+    if(region->count < DAMAGE_MAX_RECTS) {
+        region->rects[region->count++] = r;
+        return;
+    }
+
+    //region is full, merge with rectangle whose area grows least
+    unsigned int best = 0;
+    float best_growth = -1.0;
+    for(i = 0; i < region->count; ++i) {
+        Damage_Rect u = join(&region->rects[i], &r);
+        float growth = area(&u) - area(&region->rects[i]);
+        if(best_growth < 0.0 || growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    region->rects[best] = join(&region->rects[best], &r);
+}
+
+void Damage_merge(Damage_Region * dst, const Damage_Region * src) {
+    if(src->full) {
+        dst->full = true;
+        dst->count = 0;
+        return;
+    }
+    for(unsigned int i = 0; i < src->count; ++i) {
+        Damage_add(dst, &src->rects[i]);
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    damage.h
+ * @brief   Damage tracking, objects mark rectangles whose look changed
+ *          and render loop redraws only if something was damaged
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef DAMAGE_H
+#define DAMAGE_H
+
+#include <stdbool.h>
+
+
+//maximum number of rectangles of region, more rectangles are merged
+#define DAMAGE_MAX_RECTS 8
+
+//rectangle in window coordinates (y axis down)
+typedef struct {
+    float x0, y0;
+    float x1, y1;
+} Damage_Rect;
+
+//damaged region of window
+typedef struct {
+    bool full;          /** whole window is damaged */
+    unsigned int count;
+    Damage_Rect rects[DAMAGE_MAX_RECTS];
+} Damage_Region;
+
+//statistics of render loop
+typedef struct {
+    unsigned long frames;   /** redrawn frames */
+    unsigned long skipped;  /** frames skipped, nothing was damaged */
+    unsigned long partial;  /** frames redrawn only in damaged rectangles */
+} Damage_Stats;
+
+
+/**
+ * @brief Damage_markRect Mark rectangle as damaged, coordinates are shifted by
+ *        offset of calling thread. Damage becomes visible to render loop
+ *        by Damage_commit
+ * @param x
+ * @param y
+ * @param width
+ * @param height
+ */
+void Damage_markRect(float x, float y, float width, float height);
+
+/**
+ * @brief Damage_markAll Mark whole window as damaged
+ */
+void Damage_markAll();
+
+/**
+ * @brief Damage_applyOffset Shift rectangles marked by calling thread
+ *        (childs of panel use coordinates relative to panel)
+ * @param x
+ * @param y
+ */
+void Damage_applyOffset(float x, float y);
+
+/**
+ * @brief Damage_commit Pass marked damage to render loop, called after render
+ *        state of objects was published
+ */
+void Damage_commit();
+
+/**
+ * @brief Damage_pending Is there committed damage not taken by render loop?
+ * @return
+ */
+bool Damage_pending();
+
+/**
+ * @brief Damage_take Take committed damage (render loop)
+ * @param region Damaged region, empty if nothing was committed
+ */
+void Damage_take(Damage_Region * region);
+
+/**
+ * @brief Damage_add Add rectangle to region, overlapping rectangles are merged
+ * @param region
+ * @param rect
+ */
+void Damage_add(Damage_Region * region, const Damage_Rect * rect);
+
+/**
+ * @brief Damage_merge Add all rectangles of src region to dst region
+ * @param dst
+ * @param src
+ */
+void Damage_merge(Damage_Region * dst, const Damage_Region * src);
+
+#endif // DAMAGE_H
@@ -11,10 +11,14 @@
 
 #include "engine_object.h"
 
+#include "scenestore.h"
+#include "damage.h"
+
 bool E_Obj_init(E_Obj * obj) {
     if(obj == NULL) return false;
     obj->data = NULL;
     obj->events = NULL;
+    IntrusiveList_initNode(&obj->node);
     return true;
 }
 
@@ -33,6 +37,21 @@ bool E_Obj_insertToList(LinkedList * list, E_Obj * obj) {
     return LinkedList_insert(list, element);
 }
 
+bool E_Obj_insertToScene(SceneData * scene, E_Obj * obj) {
+    if(scene == NULL || obj == NULL) return false;
+    if(!SceneStore_insert(scene->gameData, obj)) return false;
+    //object has no bounds
+    Damage_markAll();
+    return true;
+}
+
+bool E_Obj_removeFromScene(SceneData * scene, E_Obj * obj, bool destruct) {
+    if(scene == NULL || obj == NULL) return false;
+    if(!SceneStore_remove(scene->gameData, obj, destruct)) return false;
+    Damage_markAll();
+    return true;
+}
+
 bool E_Obj_insertToVector(Vector * vector, E_Obj * obj) {
     if(obj == NULL || vector == NULL) return false;
 
@@ -15,6 +15,7 @@
 #include "core.h"
 #include "vector.h"
 #include "linkedlist.h"
+#include "intrusivelist.h"
 #include "event.h"
 
 
@@ -27,7 +28,8 @@ static const E_Obj_Evts e_obj_evts = {
     .mouseButtonEvt = NULL,
     .pressKeyEvt = NULL,
     .releaseKeyEvt = NULL,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = NULL
 };
 */
 
@@ -42,12 +44,17 @@ typedef struct {
     void (*pressKeyEvt)(void * obj, SceneData * scene, const Event_Key * evt); /** Key pressed event */
     void (*releaseKeyEvt)(void * obj, SceneData * scene, const Event_Key * evt);    /** Key released event */
     void (*onLoad)(void * obj, SceneData * scene); /** on scene load */
+    void (*publish)(void * obj); /** Publish render state after update (update thread, triplebuffer.h) */
 } E_Obj_Evts;
 
 
-/** abstract object type */
+/**
+ * abstract object type, objects linked in intrusive lists (childs of panel)
+ * have node right after pointer at events (all UI objects)
+ */
 typedef struct {
     const E_Obj_Evts * events;
+    IntrusiveList_Node node;  /** link in parent list */
     void * data;  /** data of object */
 } E_Obj;
 
@@ -73,6 +80,24 @@ void E_Obj_destruct(E_Obj * g_obj);
  */
 bool E_Obj_insertToList(LinkedList * list, E_Obj * obj);
 
+/**
+ * @brief E_Obj_insertToScene Insert object to game data of scene
+ * @param scene
+ * @param obj
+ * @return
+ */
+bool E_Obj_insertToScene(SceneData * scene, E_Obj * obj);
+
+/**
+ * @brief E_Obj_removeFromScene Remove object from game data of scene, can be called
+ *        from any thread, also during dispatch of events
+ * @param scene
+ * @param obj
+ * @param destruct True -> destruct object once no dispatcher can hold reference on it
+ * @return
+ */
+bool E_Obj_removeFromScene(SceneData * scene, E_Obj * obj, bool destruct);
+
 /**
  * @brief E_Obj_insertToVector
  * @param vector
@@ -0,0 +1,130 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    epoch.c
+ * @brief   Implementation of epoch.h
+ * <------------------------------------------------------------------>
+ */
+
+#include "epoch.h"
+
+#include <stdlib.h>
+#include <stdatomic.h>
+
+
+//state of thread slot: epoch << 1 | active
+#define SLOT_ACTIVE 0x1
+
+//retired memory
+typedef struct _Epoch_Garbage {
+    void * ptr;
+    void (*destruct)(void * ptr);
+    struct _Epoch_Garbage * next;
+} Epoch_Garbage;
+
+
+static atomic_uint _epoch = 0;
+static atomic_uint _slots[EPOCH_MAX_THREADS];
+static atomic_bool _slot_used[EPOCH_MAX_THREADS];
+//lists of garbage retired in epoch % 3
+static _Atomic(Epoch_Garbage *) _garbage[3];
+
+static _Thread_local int _slot = -1;
+static _Thread_local unsigned int _depth = 0;
+
+
+static void freeList(Epoch_Garbage * garbage);
+
+
+bool Epoch_enter() {
+    if(_slot < 0) {
+        //register thread
+        for(int i = 0; i < EPOCH_MAX_THREADS; ++i) {
+            if(!atomic_exchange(&_slot_used[i], true)) {
+                _slot = i;
+                break;
+            }
+        }
+        if(_slot < 0) return false;
+    }
+
+    if(_depth++ == 0) {
+        //announce epoch, seq_cst -> store is visible before any shared data is read,
+        //repeat if epoch was advanced before the announcement became visible
+        unsigned int epoch;
+        do {
+            epoch = atomic_load(&_epoch);
+            atomic_store(&_slots[_slot], epoch << 1 | SLOT_ACTIVE);
+            atomic_thread_fence(memory_order_seq_cst);
+        } while(atomic_load(&_epoch) != epoch);
+    }
+
+    return true;
+}
+
+void Epoch_exit() {
+    if(_slot < 0 || _depth == 0) return;
+
+    if(--_depth == 0) {
+        atomic_store_explicit(&_slots[_slot], 0, memory_order_release);
+    }
+}
+
+bool Epoch_retire(void * ptr, void (*destruct)(void * ptr)) {
+    if(ptr == NULL) return false;
+
+    Epoch_Garbage * garbage = malloc(sizeof(Epoch_Garbage));
+    if(garbage == NULL) return false;
+    garbage->ptr = ptr;
+    garbage->destruct = destruct;
+
+    //epoch can not move by 2 while thread is in critical section
+    if(!Epoch_enter()) {
+        free(garbage);
+        return false;
+    }
+    //tag by global epoch, announced epoch of nested section can be older than readers
+    //which entered before the unlink and garbage would be freed while they hold it
+    unsigned int epoch = atomic_load(&_epoch);
+    _Atomic(Epoch_Garbage *) * list = &_garbage[epoch % 3];
+    garbage->next = atomic_load_explicit(list, memory_order_relaxed);
+    while(!atomic_compare_exchange_weak_explicit(list, &garbage->next, garbage,
+                                                 memory_order_release, memory_order_relaxed));
+    Epoch_exit();
+
+    return true;
+}
+
+void Epoch_collect() {
+    unsigned int epoch = atomic_load(&_epoch);
+
+    //all active threads have to observe current epoch
+    for(int i = 0; i < EPOCH_MAX_THREADS; ++i) {
+        unsigned int state = atomic_load(&_slots[i]);
+        if((state & SLOT_ACTIVE) && (state >> 1) != epoch) return;
+    }
+
+    if(!atomic_compare_exchange_strong(&_epoch, &epoch, epoch + 1)) return;
+
+    //garbage of epoch - 1 is unreachable (threads are in epoch or epoch + 1)
+    freeList(atomic_exchange(&_garbage[(epoch + 2) % 3], NULL));
+}
+
+void Epoch_destruct() {
+    for(int i = 0; i < 3; ++i) {
+        freeList(atomic_exchange(&_garbage[i], NULL));
+    }
+}
+
+static void freeList(Epoch_Garbage * garbage) {
+    Epoch_Garbage * next;
+    while(garbage != NULL) {
+        next = garbage->next;
+        if(garbage->destruct) garbage->destruct(garbage->ptr);
+        free(garbage);
+        garbage = next;
+    }
+}
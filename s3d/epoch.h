@@ -0,0 +1,63 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    epoch.h
+ * @brief   Epoch-based memory reclamation, memory shared by threads
+ *          is retired instead of freed and released once no thread
+ *          can still hold reference on it
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <stdbool.h>
+
+
+//maximum number of threads that can enter critical sections
+#define EPOCH_MAX_THREADS 16
+
+
+/**
+ * Readers access shared data only between Epoch_enter and Epoch_exit.
+ * Memory retired in epoch E is freed when global epoch reaches E + 2,
+ * at that time each thread has left all critical sections started
+ * before the memory was unlinked. Threads are registered on their first
+ * Epoch_enter, critical sections can be nested.
+ */
+
+/**
+ * @brief Epoch_enter Enter critical section of current thread
+ * @return False -> no free slot for thread (more than EPOCH_MAX_THREADS)
+ */
+bool Epoch_enter();
+
+/**
+ * @brief Epoch_exit Leave critical section of current thread
+ */
+void Epoch_exit();
+
+/**
+ * @brief Epoch_retire Free memory once no thread can hold reference on it,
+ *        memory has to be unlinked from shared data before
+ * @param ptr Retired memory
+ * @param destruct Destructor of memory (ptr = retired memory)
+ * @return
+ */
+bool Epoch_retire(void * ptr, void (*destruct)(void * ptr));
+
+/**
+ * @brief Epoch_collect Try to advance global epoch and free memory which is
+ *        not reachable anymore, called periodically (update loop)
+ */
+void Epoch_collect();
+
+/**
+ * @brief Epoch_destruct Free all retired memory, no thread may be in critical section
+ */
+void Epoch_destruct();
+
+#endif // EPOCH_H
@@ -86,10 +86,10 @@ typedef struct {
 
 //update event
 typedef struct {
-    __syscall_slong_t ns_time;  /** current ns system time*/
-    __time_t s_time;    /** current sec system time*/
-    __syscall_slong_t ns_diff;   /** ns difference */
-    __time_t s_diff;    /** s difference*/
+    __syscall_slong_t ns_time;  /** current ns time (monotonic, advanced by fixed step) */
+    __time_t s_time;    /** current sec time (monotonic, advanced by fixed step) */
+    __syscall_slong_t ns_diff;   /** ns difference (fixed step) */
+    __time_t s_diff;    /** s difference (fixed step) */
     void * sender; /** object that triggered the event */
 } Event_Update;
 
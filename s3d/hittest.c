@@ -0,0 +1,207 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    hittest.c
+ * @brief   Implementation of hittest.h
+ * <------------------------------------------------------------------>
+ */
+
+#include "hittest.h"
+
+#include <stdlib.h>
+
+
+#define BVH_INIT_SIZE 8
+#define BVH_LEAF_SIZE 4
+#define BVH_MAX_DEPTH 64
+
+#define RECT_CONTAINS(r, px, py) ((px) >= (r).x0 && (px) <= (r).x1 && (py) >= (r).y0 && (py) <= (r).y1)
+
+
+static void build(HitBVH * bvh);
+
+static void buildNode(HitBVH * bvh, unsigned int index, unsigned int first,
+                      unsigned int count, unsigned int depth);
+
+
+void HitGrid_init(HitGrid * grid, float x, float y, float cell_width, float cell_height,
+                  unsigned int columns, unsigned int rows) {
+    if(grid == NULL) return;
+
+    grid->x = x;
+    grid->y = y;
+    grid->cell_width = cell_width;
+    grid->cell_height = cell_height;
+    grid->columns = columns;
+    grid->rows = rows;
+}
+
+int HitGrid_cellAt(const HitGrid * grid, float x, float y) {
+    if(grid == NULL) return -1;
+    if(grid->cell_width <= 0 || grid->cell_height <= 0) return -1;
+
+    float fx = (x - grid->x) / grid->cell_width;
+    float fy = (y - grid->y) / grid->cell_height;
+    if(fx < 0 || fy < 0) return -1;
+
+    unsigned int column = (unsigned int) fx;
+    unsigned int row = (unsigned int) fy;
+    if(column >= grid->columns || row >= grid->rows) return -1;
+
+    return column + row * grid->columns;
+}
+
+bool HitBVH_init(HitBVH * bvh) {
+    if(bvh == NULL) return false;
+
+    bvh->items = NULL;
+    bvh->order = NULL;
+    bvh->nodes = NULL;
+    bvh->count = 0;
+    bvh->size = 0;
+    bvh->node_count = 0;
+    bvh->dirty = false;
+
+    return true;
+}
+
+void HitBVH_clear(HitBVH * bvh) {
+    if(bvh == NULL) return;
+
+    bvh->count = 0;
+    bvh->node_count = 0;
+    bvh->dirty = false;
+}
+
+bool HitBVH_insert(HitBVH * bvh, HitRect bounds, void * obj) {
+    if(bvh == NULL) return false;
+
+    if(bvh->count == bvh->size) {
+        unsigned int size = bvh->size ? bvh->size * 2 : BVH_INIT_SIZE;
+        HitBVH_Item * items = realloc(bvh->items, sizeof(HitBVH_Item) * size);
+        if(items == NULL) return false;
+        bvh->items = items;
+        unsigned int * order = realloc(bvh->order, sizeof(unsigned int) * size);
+        if(order == NULL) return false;
+        bvh->order = order;
+        //binary tree with leaves of at least one item
+        HitBVH_Node * nodes = realloc(bvh->nodes, sizeof(HitBVH_Node) * size * 2);
+        if(nodes == NULL) return false;
+        bvh->nodes = nodes;
+        bvh->size = size;
+    }
+
+    bvh->items[bvh->count].bounds = bounds;
+    bvh->items[bvh->count].obj = obj;
+    bvh->count++;
+    bvh->dirty = true;
+
+    return true;
+}
+
+void * HitBVH_query(HitBVH * bvh, float x, float y, bool (*accept)(void * obj)) {
+    if(bvh == NULL || bvh->count == 0) return NULL;
+    if(bvh->dirty) build(bvh);
+
+    //index of topmost item
+    int best = -1;
+
+    unsigned int stack[BVH_MAX_DEPTH * 2];
+    unsigned int top = 0;
+    stack[top++] = 0;
+    while(top > 0) {
+        const HitBVH_Node * node = &bvh->nodes[stack[--top]];
+        if(!RECT_CONTAINS(node->bounds, x, y)) continue;
+
+        if(node->count > 0) {
+            for(unsigned int i = node->first; i < node->first + node->count; ++i) {
+                unsigned int index = bvh->order[i];
+                if((int) index <= best) continue;
+                const HitBVH_Item * item = &bvh->items[index];
+                if(!RECT_CONTAINS(item->bounds, x, y)) continue;
+                if(accept && !accept(item->obj)) continue;
+                best = index;
+            }
+        } else {
+            stack[top++] = node->first;
+            stack[top++] = node->first + 1;
+        }
+    }
+
+    return best >= 0 ? bvh->items[best].obj : NULL;
+}
+
+void HitBVH_destruct(HitBVH * bvh) {
+    if(bvh == NULL) return;
+
+    if(bvh->items) free(bvh->items);
+    if(bvh->order) free(bvh->order);
+    if(bvh->nodes) free(bvh->nodes);
+    HitBVH_init(bvh);
+}
+
+static void build(HitBVH * bvh) {
+    for(unsigned int i = 0; i < bvh->count; ++i) {
+        bvh->order[i] = i;
+    }
+    bvh->node_count = 1;
+    buildNode(bvh, 0, 0, bvh->count, 0);
+    bvh->dirty = false;
+}
+
+//items sorted by buildNode (trees are built by update thread only)
+static const HitBVH_Item * sort_items;
+
+static int compareX(const void * a, const void * b) {
+    const HitRect * ra = &sort_items[*(const unsigned int*) a].bounds;
+    const HitRect * rb = &sort_items[*(const unsigned int*) b].bounds;
+    float ca = ra->x0 + ra->x1, cb = rb->x0 + rb->x1;
+    return (ca > cb) - (ca < cb);
+}
+
+static int compareY(const void * a, const void * b) {
+    const HitRect * ra = &sort_items[*(const unsigned int*) a].bounds;
+    const HitRect * rb = &sort_items[*(const unsigned int*) b].bounds;
+    float ca = ra->y0 + ra->y1, cb = rb->y0 + rb->y1;
+    return (ca > cb) - (ca < cb);
+}
+
+static void buildNode(HitBVH * bvh, unsigned int index, unsigned int first,
+                      unsigned int count, unsigned int depth) {
+    HitBVH_Node * node = &bvh->nodes[index];
+
+    //bounds of all items
+    HitRect bounds = bvh->items[bvh->order[first]].bounds;
+    for(unsigned int i = first + 1; i < first + count; ++i) {
+        const HitRect * r = &bvh->items[bvh->order[i]].bounds;
+        if(r->x0 < bounds.x0) bounds.x0 = r->x0;
+        if(r->y0 < bounds.y0) bounds.y0 = r->y0;
+        if(r->x1 > bounds.x1) bounds.x1 = r->x1;
+        if(r->y1 > bounds.y1) bounds.y1 = r->y1;
+    }
+    node->bounds = bounds;
+
+    if(count <= BVH_LEAF_SIZE || depth >= BVH_MAX_DEPTH - 1) {
+        node->first = first;
+        node->count = count;
+        return;
+    }
+
+    //split by median of centers along longer axis
+    sort_items = bvh->items;
+    qsort(&bvh->order[first], count, sizeof(unsigned int),
+          bounds.x1 - bounds.x0 >= bounds.y1 - bounds.y0 ? compareX : compareY);
+    unsigned int half = count / 2;
+
+    //children are stored next to each other
+    unsigned int left = bvh->node_count;
+    bvh->node_count += 2;
+    node->first = left;
+    node->count = 0;
+
+    buildNode(bvh, left, first, half, depth + 1);
+    buildNode(bvh, left + 1, first + half, count - half, depth + 1);
+}
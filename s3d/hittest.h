@@ -0,0 +1,123 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    hittest.h
+ * @brief   Spatial indexes for finding object under mouse cursor,
+ *          uniform grid for regular layouts and bounding volume
+ *          hierarchy for arbitrary rectangles
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef HITTEST_H
+#define HITTEST_H
+
+#include <stdbool.h>
+
+
+//axis aligned rectangle, bounds are inclusive (same as IN_RANGE)
+typedef struct {
+    float x0, y0;
+    float x1, y1;
+} HitRect;
+
+//uniform grid of equal cells
+typedef struct {
+    float x, y;     /** position of first cell */
+    float cell_width;
+    float cell_height;
+    unsigned int columns;
+    unsigned int rows;
+} HitGrid;
+
+//item of bounding volume hierarchy
+typedef struct {
+    HitRect bounds;
+    void * obj;
+} HitBVH_Item;
+
+//node of bounding volume hierarchy, leaf -> count > 0
+typedef struct {
+    HitRect bounds;
+    unsigned int first;     /** first item (leaf) or left child (inner node, right child is first + 1) */
+    unsigned int count;     /** number of items of leaf */
+} HitBVH_Node;
+
+/**
+ * Items are kept in insert order, in case of overlap the item inserted
+ * later wins (it is rendered on top).
+ */
+typedef struct {
+    HitBVH_Item * items;
+    unsigned int * order;   /** item indexes sorted by nodes */
+    HitBVH_Node * nodes;
+    unsigned int count;
+    unsigned int size;
+    unsigned int node_count;
+    bool dirty;     /** items changed, tree is rebuilt by next query */
+} HitBVH;
+
+
+/**
+ * @brief HitGrid_init
+ * @param grid
+ * @param x Position of first cell
+ * @param y Position of first cell
+ * @param cell_width
+ * @param cell_height
+ * @param columns
+ * @param rows
+ */
+void HitGrid_init(HitGrid * grid, float x, float y, float cell_width, float cell_height,
+                  unsigned int columns, unsigned int rows);
+
+/**
+ * @brief HitGrid_cellAt Index of cell under point (column + row * columns)
+ * @param grid
+ * @param x
+ * @param y
+ * @return Index of cell, -1 -> point is outside of grid
+ */
+int HitGrid_cellAt(const HitGrid * grid, float x, float y);
+
+/**
+ * @brief HitBVH_init
+ * @param bvh
+ * @return
+ */
+bool HitBVH_init(HitBVH * bvh);
+
+/**
+ * @brief HitBVH_clear Remove all items
+ * @param bvh
+ */
+void HitBVH_clear(HitBVH * bvh);
+
+/**
+ * @brief HitBVH_insert Append item, tree is rebuilt by next query
+ * @param bvh
+ * @param bounds
+ * @param obj
+ * @return
+ */
+bool HitBVH_insert(HitBVH * bvh, HitRect bounds, void * obj);
+
+/**
+ * @brief HitBVH_query Topmost object containing point
+ * @param bvh
+ * @param x
+ * @param y
+ * @param accept Filter of objects (NULL -> all objects)
+ * @return Object or NULL
+ */
+void * HitBVH_query(HitBVH * bvh, float x, float y, bool (*accept)(void * obj));
+
+/**
+ * @brief HitBVH_destruct Free arrays, struct is not freed
+ * @param bvh
+ */
+void HitBVH_destruct(HitBVH * bvh);
+
+#endif // HITTEST_H
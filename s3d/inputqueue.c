@@ -0,0 +1,122 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    inputqueue.c
+ * @brief   Implementation of inputqueue.h
+ * <------------------------------------------------------------------>
+ */
+
+#include "inputqueue.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+
+
+bool InputQueue_init(InputQueue * queue, size_t capacity) {
+    if(queue == NULL || capacity < 2) return false;
+
+    size_t size = 2;
+    while(size < capacity) size <<= 1;
+
+    queue->cells = malloc(sizeof(InputQueue_Cell) * size);
+    if(queue->cells == NULL) return false;
+    for(size_t i = 0; i < size; ++i) {
+        atomic_init(&queue->cells[i].sequence, i);
+    }
+
+    queue->mask = size - 1;
+    atomic_init(&queue->head, 0);
+    queue->tail = 0;
+    atomic_init(&queue->dropped, 0);
+    queue->coalesced = 0;
+
+    return true;
+}
+
+bool InputQueue_push(InputQueue * queue, const Input_Event * event) {
+    if(queue == NULL || event == NULL) return false;
+
+    InputQueue_Cell * cell;
+    size_t pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    for(;;) {
+        cell = &queue->cells[pos & queue->mask];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t) sequence - (intptr_t) pos;
+        if(diff == 0) {
+            //cell is free, claim position
+            if(atomic_compare_exchange_weak_explicit(&queue->head, &pos, pos + 1,
+                                                     memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if(diff < 0) {
+            //consumer did not free cell yet -> full
+            atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+        }
+    }
+
+    cell->event = *event;
+    atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+
+    return true;
+}
+
+bool InputQueue_pop(InputQueue * queue, Input_Event * event) {
+    if(queue == NULL || event == NULL) return false;
+
+    InputQueue_Cell * cell = &queue->cells[queue->tail & queue->mask];
+    size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+    if(sequence != queue->tail + 1) return false;
+
+    *event = cell->event;
+    //free cell for producer of next round
+    atomic_store_explicit(&cell->sequence, queue->tail + queue->mask + 1, memory_order_release);
+    queue->tail++;
+
+    return true;
+}
+
+unsigned int InputQueue_drain(InputQueue * queue,
+                              void (*callback)(const Input_Event * event, void * context),
+                              void * context) {
+    if(queue == NULL || callback == NULL) return 0;
+
+    unsigned int count = 0;
+    bool move_pending = false;
+    Input_Event move;
+    Input_Event event;
+    while(InputQueue_pop(queue, &event)) {
+        if(event.type == Input_MouseMove) {
+            //only last position of consecutive moves is dispatched
+            if(move_pending) queue->coalesced++;
+            move = event;
+            move_pending = true;
+            continue;
+        }
+        if(move_pending) {
+            callback(&move, context);
+            move_pending = false;
+            ++count;
+        }
+        callback(&event, context);
+        ++count;
+    }
+    if(move_pending) {
+        callback(&move, context);
+        ++count;
+    }
+
+    return count;
+}
+
+void InputQueue_destruct(InputQueue * queue) {
+    if(queue == NULL) return;
+
+    if(queue->cells) free(queue->cells);
+    queue->cells = NULL;
+}
@@ -0,0 +1,100 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    inputqueue.h
+ * @brief   Bounded lock-free queue of input and window resize events,
+ *          events are pushed by GLUT callbacks (any number of threads)
+ *          and drained by update thread
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef INPUTQUEUE_H
+#define INPUTQUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include "event.h"
+
+
+//type of input event
+typedef enum {
+    Input_PressKey,
+    Input_ReleaseKey,
+    Input_MouseMove,
+    Input_MouseButton,
+    Input_Resize
+} Input_Type;
+
+//input event
+typedef struct {
+    Input_Type type;
+    union {
+        Event_Key key;
+        Event_Mouse mouse;
+        Event_Resize resize;
+    } data;
+} Input_Event;
+
+//cell of queue, sequence tells if cell is free for producer or ready for consumer
+typedef struct {
+    atomic_size_t sequence;
+    Input_Event event;
+} InputQueue_Cell;
+
+typedef struct {
+    InputQueue_Cell * cells;
+    size_t mask;            /** capacity - 1 */
+    atomic_size_t head;     /** next push position (producers) */
+    size_t tail;            /** next pop position (consumer only) */
+    atomic_ulong dropped;   /** events dropped because queue was full */
+    unsigned long coalesced;    /** mouse moves merged by InputQueue_drain */
+} InputQueue;
+
+
+/**
+ * @brief InputQueue_init
+ * @param queue
+ * @param capacity Maximum number of queued events (rounded up to power of two)
+ * @return
+ */
+bool InputQueue_init(InputQueue * queue, size_t capacity);
+
+/**
+ * @brief InputQueue_push Push event to queue (any thread)
+ * @param queue
+ * @param event
+ * @return False -> queue is full, event was dropped
+ */
+bool InputQueue_push(InputQueue * queue, const Input_Event * event);
+
+/**
+ * @brief InputQueue_pop Pop oldest event (consumer thread only)
+ * @param queue
+ * @param event Popped event
+ * @return False -> queue is empty
+ */
+bool InputQueue_pop(InputQueue * queue, Input_Event * event);
+
+/**
+ * @brief InputQueue_drain Pop all events and pass them to callback (consumer thread only),
+ *        consecutive mouse moves are merged into the last one
+ * @param queue
+ * @param callback
+ * @param context Passed to callback
+ * @return Number of dispatched events
+ */
+unsigned int InputQueue_drain(InputQueue * queue,
+                              void (*callback)(const Input_Event * event, void * context),
+                              void * context);
+
+/**
+ * @brief InputQueue_destruct Free cells, struct is not freed
+ * @param queue
+ */
+void InputQueue_destruct(InputQueue * queue);
+
+#endif // INPUTQUEUE_H
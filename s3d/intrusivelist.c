@@ -0,0 +1,81 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    intrusivelist.c
+ * @brief   Implementation of intrusivelist.h
+ * <------------------------------------------------------------------>
+ */
+
+#include "intrusivelist.h"
+
+
+bool IntrusiveList_init(IntrusiveList * list) {
+    if(list == NULL) return false;
+
+    list->first = NULL;
+    list->last = NULL;
+    list->count = 0;
+
+    return true;
+}
+
+void IntrusiveList_initNode(IntrusiveList_Node * node) {
+    if(node == NULL) return;
+
+    node->prev = NULL;
+    node->next = NULL;
+    node->list = NULL;
+}
+
+bool IntrusiveList_append(IntrusiveList * list, IntrusiveList_Node * node) {
+    if(list == NULL || node == NULL) return false;
+
+#ifndef NDEBUG
+    //node is already linked (in this or other list)
+    if(node->list != NULL) return false;
+#endif
+
+    node->prev = list->last;
+    node->next = NULL;
+    node->list = list;
+    if(list->last == NULL) {
+        list->first = node;
+    } else {
+        list->last->next = node;
+    }
+    list->last = node;
+
+    list->count++;
+
+    return true;
+}
+
+bool IntrusiveList_unlink(IntrusiveList * list, IntrusiveList_Node * node) {
+    if(list == NULL || node == NULL) return false;
+    if(node->list != list) return false;
+
+    //reconnect neighbours
+    if(node->prev == NULL) {
+        list->first = node->next;
+    } else {
+        node->prev->next = node->next;
+    }
+    if(node->next == NULL) {
+        list->last = node->prev;
+    } else {
+        node->next->prev = node->prev;
+    }
+
+    list->count--;
+    IntrusiveList_initNode(node);
+
+    return true;
+}
+
+bool IntrusiveList_contains(const IntrusiveList * list, const IntrusiveList_Node * node) {
+    if(list == NULL || node == NULL) return false;
+    return node->list == list;
+}
@@ -0,0 +1,81 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    intrusivelist.h
+ * @brief   Doubly linked list with nodes embedded in linked objects,
+ *          append and unlink are O(1) and need no allocation
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+struct _IntrusiveList;
+
+//node of intrusive list (member of linked object)
+typedef struct _IntrusiveList_Node {
+    struct _IntrusiveList_Node * prev; /** previous node in list */
+    struct _IntrusiveList_Node * next; /** next node in list */
+    struct _IntrusiveList * list; /** list that contains node (NULL -> node is not linked) */
+} IntrusiveList_Node;
+
+
+//intrusive list
+typedef struct _IntrusiveList {
+    IntrusiveList_Node * first; /** first node of list */
+    IntrusiveList_Node * last; /** last node of list */
+    unsigned int count; /** number of nodes in list */
+} IntrusiveList;
+
+
+/** pointer at object that contains node (member = name of node in type) */
+#define INTRUSIVELIST_ENTRY(node, type, member) \
+    ((type*) ((char*) (node) - offsetof(type, member)))
+
+
+/**
+ * @brief Init IntrusiveList structure
+ * @param list  Pointer at IntrusiveList structure
+ * @return True -> success
+ */
+bool IntrusiveList_init(IntrusiveList * list);
+
+/**
+ * @brief Init node of object, must be called before the node is appended first time
+ * @param node  Pointer at node
+ */
+void IntrusiveList_initNode(IntrusiveList_Node * node);
+
+/**
+ * @brief Append node at end of list, in debug build (NDEBUG not defined)
+ *        node that is already linked in any list is rejected
+ * @param list  Pointer at IntrusiveList structure
+ * @param node  Pointer at unlinked node
+ * @return True -> success
+ */
+bool IntrusiveList_append(IntrusiveList * list, IntrusiveList_Node * node);
+
+/**
+ * @brief Unlink node from list, linked object is not destructed
+ * @param list  Pointer at IntrusiveList structure
+ * @param node  Pointer at node linked in list
+ * @return True -> success
+ */
+bool IntrusiveList_unlink(IntrusiveList * list, IntrusiveList_Node * node);
+
+/**
+ * @brief Check if list contains node
+ * @param list  Pointer at IntrusiveList structure
+ * @param node  Pointer at node
+ * @return
+ */
+bool IntrusiveList_contains(const IntrusiveList * list, const IntrusiveList_Node * node);
+
+#endif // INTRUSIVELIST_H
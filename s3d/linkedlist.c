@@ -27,18 +27,17 @@ bool LinkedList_init(LinkedList * list) {
 bool LinkedList_insert(LinkedList * list, LinkedList_Element * element) {
     if(list == NULL || element == NULL) return false;
 
+#ifndef NDEBUG
+    //duplicity check walks whole list, only in debug build
     if(LinkedList_contains(list, element)) return false;
+#endif
 
-    LinkedList_Element * parent = list->first;
-    if(parent == NULL) {
+    if(list->last == NULL) {
         //insert first element of list
         list->first = element;
     } else {
-        //insert next element
-        while(parent->next != NULL) {
-            parent = parent->next;
-        }
-        parent->next = element;
+        //append after last element
+        list->last->next = element;
     }
     element->next = NULL;
 
@@ -80,8 +79,8 @@ bool LinkedList_removeElement(LinkedList * list, LinkedList_Element * element, b
 
     LinkedList_Element * last = NULL;
     LinkedList_Element * current = list->first;
-    while(element != NULL) {
-        //find element in list by index
+    while(current != NULL) {
+        //find element in list
         if(element == current) {
             //destruct data
             if(destruct && element->destruct) element->destruct(element->ptr);
@@ -99,8 +98,8 @@ bool LinkedList_removeElement(LinkedList * list, LinkedList_Element * element, b
             free(element);
             return true;
         }
-        last = element;
-        element = element->next;
+        last = current;
+        current = current->next;
     }
 
     return false;
@@ -40,7 +40,8 @@ typedef struct {
 bool LinkedList_init(LinkedList * list);
 
 /**
- * @brief Insert new element to list
+ * @brief Append new element at end of list, element that is already in list
+ *        is rejected only in debug build (NDEBUG not defined)
  * @param list      Pointer at LinkedList structure
  * @param element   Pointer at new element (create copy of element)
  * @return True -> success
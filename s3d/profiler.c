@@ -0,0 +1,366 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    profiler.c
+ * @brief   Implementation of profiler.h
+ * <------------------------------------------------------------------>
+ */
+
+#include "profiler.h"
+
+#ifdef S3D_PROFILER
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "scheduler.h"
+#include "render.h"
+#include "rendergl.h"
+#include "rendergl33.h"
+
+
+#define RING_MASK (PROFILER_RING_SIZE - 1)
+//samples close to writer can be overwritten while they are read
+#define RING_READ_LIMIT (PROFILER_RING_SIZE - 1024)
+#define TOP_TABLE_SIZE 256
+#define OVERLAY_WIDTH 340
+#define GRAPH_HEIGHT 80
+#define GRAPH_SCALE_NS 33333333.0   /** frame time at top of graph */
+
+//ring buffer of one thread, written only by its thread
+typedef struct {
+    char name[32];
+    Profiler_Sample * samples;
+    atomic_ulong head;  /** number of written samples */
+} Ring;
+
+typedef struct {
+    const void * obj;
+    char name[32];
+} Name;
+
+//accumulated time of object and event
+typedef struct {
+    const void * obj;
+    Profiler_Event event;
+    int64_t time;
+    unsigned int calls;
+} Total;
+
+static const char * EVENT_NAMES[Profiler_EventCount] = {
+    "render", "update", "publish", "input", "resize", "frame", "tick"
+};
+
+static atomic_bool _enabled = false;
+
+static Ring _rings[PROFILER_MAX_THREADS];
+static atomic_uint _ring_count = 0;
+static _Thread_local Ring * _ring = NULL;
+
+static pthread_mutex_t _names_lock = PTHREAD_MUTEX_INITIALIZER;
+static Name _names[PROFILER_MAX_NAMES];
+static unsigned int _name_count = 0;
+
+
+void Profiler_init() {
+    const char * env = getenv(PROFILER_ENV_ENABLE);
+    if(env != NULL && *env && strcmp(env, "0")) Profiler_setEnabled(true);
+}
+
+void Profiler_setEnabled(bool enabled) {
+    atomic_store(&_enabled, enabled);
+}
+
+bool Profiler_isEnabled() {
+    return atomic_load_explicit(&_enabled, memory_order_relaxed);
+}
+
+bool Profiler_registerThread(const char * name) {
+    if(_ring != NULL) return true;
+
+    unsigned int index = atomic_fetch_add(&_ring_count, 1);
+    if(index >= PROFILER_MAX_THREADS) {
+        atomic_fetch_sub(&_ring_count, 1);
+        return false;
+    }
+
+    Ring * ring = &_rings[index];
+    ring->samples = malloc(sizeof(Profiler_Sample) * PROFILER_RING_SIZE);
+    if(ring->samples == NULL) return false;
+    snprintf(ring->name, sizeof(ring->name), "%s", name != NULL ? name : "thread");
+    atomic_init(&ring->head, 0);
+    _ring = ring;
+    return true;
+}
+
+void Profiler_setName(const void * obj, const char * name) {
+    if(obj == NULL || name == NULL) return;
+
+    pthread_mutex_lock(&_names_lock);
+    unsigned int i;
+    for(i = 0; i < _name_count && _names[i].obj != obj; ++i);
+    if(i < PROFILER_MAX_NAMES) {
+        _names[i].obj = obj;
+        snprintf(_names[i].name, sizeof(_names[i].name), "%s", name);
+        if(i == _name_count) ++_name_count;
+    }
+    pthread_mutex_unlock(&_names_lock);
+}
+
+static void objectName(const void * obj, char * buffer, size_t size) {
+    pthread_mutex_lock(&_names_lock);
+    for(unsigned int i = 0; i < _name_count; ++i) {
+        if(_names[i].obj == obj) {
+            snprintf(buffer, size, "%s", _names[i].name);
+            pthread_mutex_unlock(&_names_lock);
+            return;
+        }
+    }
+    pthread_mutex_unlock(&_names_lock);
+    snprintf(buffer, size, "%p", obj);
+}
+
+int64_t Profiler_begin() {
+    if(_ring == NULL || !atomic_load_explicit(&_enabled, memory_order_relaxed)) return 0;
+    return Scheduler_now();
+}
+
+void Profiler_record(int64_t start, Profiler_Event event, const void * obj) {
+    if(_ring == NULL) return;
+
+    unsigned long head = atomic_load_explicit(&_ring->head, memory_order_relaxed);
+    Profiler_Sample * sample = &_ring->samples[head & RING_MASK];
+    sample->start = start;
+    sample->duration = Scheduler_now() - start;
+    sample->obj = obj;
+    sample->event = event;
+    atomic_store_explicit(&_ring->head, head + 1, memory_order_release);
+}
+
+/* Overlay -------------------------------------------------------- */
+
+static unsigned int collectTop(int64_t since, Total * top) {
+    static Total table[TOP_TABLE_SIZE];
+    memset(table, 0, sizeof(table));
+
+    //accumulate samples of last second of all threads
+    unsigned int ring_count = MIN(atomic_load(&_ring_count), (unsigned int)PROFILER_MAX_THREADS);
+    for(unsigned int r = 0; r < ring_count; ++r) {
+        Ring * ring = &_rings[r];
+        if(ring->samples == NULL) continue;
+        unsigned long head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        unsigned long count = MIN(head, (unsigned long)RING_READ_LIMIT);
+        for(unsigned long i = 1; i <= count; ++i) {
+            const Profiler_Sample * s = &ring->samples[(head - i) & RING_MASK];
+            if(s->start < since) break;
+            if(s->obj == NULL) continue;
+
+            uintptr_t hash = ((uintptr_t)s->obj >> 4) * 31 + s->event;
+            for(unsigned int probe = 0; probe < TOP_TABLE_SIZE; ++probe) {
+                Total * t = &table[(hash + probe) % TOP_TABLE_SIZE];
+                if(t->obj == NULL) {
+                    t->obj = s->obj;
+                    t->event = s->event;
+                }
+                if(t->obj == s->obj && t->event == s->event) {
+                    t->time += s->duration;
+                    ++t->calls;
+                    break;
+                }
+            }
+        }
+    }
+
+    //select highest times
+    unsigned int top_count = 0;
+    for(unsigned int i = 0; i < TOP_TABLE_SIZE; ++i) {
+        if(table[i].obj == NULL) continue;
+        if(top_count < PROFILER_TOP_COUNT) {
+            top[top_count++] = table[i];
+        } else if(table[i].time > top[top_count - 1].time) {
+            top[top_count - 1] = table[i];
+        } else {
+            continue;
+        }
+        unsigned int j = top_count - 1;
+        while(j > 0 && top[j - 1].time < top[j].time) {
+            Total tmp = top[j - 1];
+            top[j - 1] = top[j];
+            top[j] = tmp;
+            --j;
+        }
+    }
+    return top_count;
+}
+
+void Profiler_renderOverlay(const Event_Render * evt) {
+    (void) evt;
+    if(_ring == NULL || !Profiler_isEnabled()) return;
+
+    //frame times of calling (render) thread
+    double frames[PROFILER_GRAPH_SIZE];
+    unsigned int frame_count = 0;
+    double frame_max = 0.0, frame_sum = 0.0;
+    unsigned long head = atomic_load_explicit(&_ring->head, memory_order_relaxed);
+    unsigned long count = MIN(head, (unsigned long)RING_READ_LIMIT);
+    for(unsigned long i = 1; i <= count && frame_count < PROFILER_GRAPH_SIZE; ++i) {
+        const Profiler_Sample * s = &_ring->samples[(head - i) & RING_MASK];
+        if(s->event != Profiler_Frame) continue;
+        frames[frame_count++] = s->duration;
+        frame_max = MAX(frame_max, (double)s->duration);
+        frame_sum += s->duration;
+    }
+
+    Total top[PROFILER_TOP_COUNT];
+    memset(top, 0, sizeof(top));
+    unsigned int top_count = collectTop(Scheduler_now() - 1000000000L, top);
+
+    //draw calls of GL backend (previous frame, current is not flushed yet)
+    const RenderGL_Stats * gl = NULL;
+    if(Render_getBackend() == &RENDERGL_BACKEND) {
+        gl = RenderGL_getStats();
+    } else if(Render_getBackend() == &RENDERGL33_BACKEND) {
+        gl = RenderGL33_getStats();
+    }
+
+    int line = Render_getStringHeight() + 4;
+    Point2D p = {10, 10, COLOR_BLACK};
+    Render_setColorRGB(0.0, 0.0, 0.0, 0.75);
+    Render_fillRectangle(&p, OVERLAY_WIDTH, GRAPH_HEIGHT + 20 + line * (2 + top_count + (gl ? 1 : 0)));
+
+    //graph, newest frame on right
+    Point2D p1, p2;
+    Render_setColorRGB(0.3, 0.3, 0.3, 1.0);
+    p1.x = 20;
+    p2.x = 20 + OVERLAY_WIDTH - 20;
+    p1.y = p2.y = 20 + GRAPH_HEIGHT - GRAPH_HEIGHT * (16666666.0 / GRAPH_SCALE_NS);
+    Render_drawLine(&p1, &p2);
+    float bar = (float)(OVERLAY_WIDTH - 20) / PROFILER_GRAPH_SIZE;
+    for(unsigned int i = 0; i < frame_count; ++i) {
+        double ratio = MIN(frames[i] / GRAPH_SCALE_NS, 1.0);
+        if(frames[i] > 16666666.0) {
+            Render_setColorRGB(1.0, 0.3, 0.3, 1.0);
+        } else {
+            Render_setColorRGB(0.3, 1.0, 0.3, 1.0);
+        }
+        p1.x = p2.x = 20 + OVERLAY_WIDTH - 20 - (i + 0.5) * bar;
+        p1.y = 20 + GRAPH_HEIGHT;
+        p2.y = p1.y - GRAPH_HEIGHT * ratio;
+        Render_drawLine(&p1, &p2);
+    }
+
+    //text
+    char buffer[128];
+    char name[32];
+    float y = 20 + GRAPH_HEIGHT + line;
+    Render_setColorRGB(1.0, 1.0, 1.0, 1.0);
+    snprintf(buffer, sizeof(buffer), "frame %.2f ms  max %.2f ms",
+             frame_count ? frame_sum / frame_count / 1e6 : 0.0, frame_max / 1e6);
+    Render_drawString(20, y, buffer);
+    if(gl != NULL) {
+        unsigned long redundant = 0;
+        for(int i = 0; i < RenderGL_StateCount; ++i) {
+            redundant += gl->redundant[i];
+        }
+        y += line;
+        snprintf(buffer, sizeof(buffer), "draws %lu/%lu  skipped state %lu",
+                 gl->batches, gl->primitives, redundant);
+        Render_drawString(20, y, buffer);
+    }
+    y += line;
+    Render_drawString(20, y, "last second (inclusive):");
+    for(unsigned int i = 0; i < top_count; ++i) {
+        y += line;
+        objectName(top[i].obj, name, sizeof(name));
+        snprintf(buffer, sizeof(buffer), "%-18s %-7s %7.2f ms %5u", name, EVENT_NAMES[top[i].event],
+                 top[i].time / 1e6, top[i].calls);
+        Render_drawString(20, y, buffer);
+    }
+}
+
+/* Trace -------------------------------------------------------- */
+
+static void writeString(FILE * file, const char * str) {
+    fputc('"', file);
+    for(; *str; ++str) {
+        if(*str == '"' || *str == '\\') {
+            fprintf(file, "\\%c", *str);
+        } else if((unsigned char)*str < 0x20) {
+            fprintf(file, "\\u%04x", *str);
+        } else {
+            fputc(*str, file);
+        }
+    }
+    fputc('"', file);
+}
+
+bool Profiler_dumpTrace(const char * path) {
+    if(path == NULL) return false;
+    FILE * file = fopen(path, "w");
+    if(file == NULL) return false;
+
+    char name[32];
+    bool first = true;
+    fprintf(file, "{\"traceEvents\":[\n");
+    unsigned int ring_count = MIN(atomic_load(&_ring_count), (unsigned int)PROFILER_MAX_THREADS);
+    for(unsigned int r = 0; r < ring_count; ++r) {
+        Ring * ring = &_rings[r];
+        if(ring->samples == NULL) continue;
+
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                first ? "" : ",\n", r);
+        writeString(file, ring->name);
+        fprintf(file, "}}");
+        first = false;
+
+        unsigned long head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        unsigned long count = MIN(head, (unsigned long)RING_READ_LIMIT);
+        for(unsigned long i = head - count; i < head; ++i) {
+            const Profiler_Sample * s = &ring->samples[i & RING_MASK];
+            if(s->obj != NULL) {
+                objectName(s->obj, name, sizeof(name));
+            } else {
+                snprintf(name, sizeof(name), "%s", EVENT_NAMES[s->event]);
+            }
+            fprintf(file, ",\n{\"name\":");
+            writeString(file, name);
+            fprintf(file, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                    EVENT_NAMES[s->event], s->start / 1e3, s->duration / 1e3, r);
+        }
+    }
+    fprintf(file, "\n]}\n");
+
+    return fclose(file) == 0;
+}
+
+void Profiler_destruct() {
+    const char * path = getenv(PROFILER_ENV_TRACE);
+    if(path != NULL && *path) Profiler_dumpTrace(path);
+
+    atomic_store(&_enabled, false);
+    unsigned int ring_count = MIN(atomic_load(&_ring_count), (unsigned int)PROFILER_MAX_THREADS);
+    for(unsigned int r = 0; r < ring_count; ++r) {
+        free(_rings[r].samples);
+        _rings[r].samples = NULL;
+    }
+}
+
+#else
+
+void Profiler_init() {}
+void Profiler_setEnabled(bool enabled) {}
+bool Profiler_isEnabled() { return false; }
+bool Profiler_registerThread(const char * name) { return false; }
+void Profiler_setName(const void * obj, const char * name) {}
+int64_t Profiler_begin() { return 0; }
+void Profiler_record(int64_t start, Profiler_Event event, const void * obj) {}
+void Profiler_renderOverlay(const Event_Render * evt) {}
+bool Profiler_dumpTrace(const char * path) { return false; }
+void Profiler_destruct() {}
+
+#endif
@@ -0,0 +1,132 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    profiler.h
+ * @brief   Frame profiler, records CPU time of each dispatched event
+ *          of each object into ring buffer of calling thread. Results
+ *          are shown by overlay or written as Chrome trace JSON
+ *          (chrome://tracing, Perfetto)
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "event.h"
+
+//profiler is compiled out of release builds (NDEBUG) or with S3D_NO_PROFILER defined
+#if !defined(NDEBUG) && !defined(S3D_NO_PROFILER)
+#define S3D_PROFILER
+#endif
+
+#define PROFILER_MAX_THREADS 8
+#define PROFILER_RING_SIZE (1 << 16)    /** samples of each thread (power of two) */
+#define PROFILER_GRAPH_SIZE 120         /** frames in frame time graph */
+#define PROFILER_TOP_COUNT 8            /** objects in overlay */
+#define PROFILER_MAX_NAMES 64
+
+//environment variables read by Profiler_init
+#define PROFILER_ENV_ENABLE "S3D_PROFILE"       /** set -> profiler is enabled */
+#define PROFILER_ENV_TRACE "S3D_PROFILE_TRACE"  /** path of trace written at exit */
+
+typedef enum {
+    Profiler_Render,
+    Profiler_Update,
+    Profiler_Publish,
+    Profiler_Input,
+    Profiler_Resize,
+    Profiler_Frame,     /** whole frame of render thread */
+    Profiler_Tick,      /** whole tick of update thread */
+    Profiler_EventCount
+} Profiler_Event;
+
+//one measured call
+typedef struct {
+    int64_t start;      /** ns, CLOCK_MONOTONIC */
+    int64_t duration;   /** ns */
+    const void * obj;   /** object (NULL for frame and tick) */
+    Profiler_Event event;
+} Profiler_Sample;
+
+
+#ifdef S3D_PROFILER
+#define PROFILER_BEGIN(start) int64_t start = Profiler_begin()
+#define PROFILER_END(start, event, obj) do { if(start) Profiler_record(start, event, obj); } while(0)
+#else
+#define PROFILER_BEGIN(start)
+#define PROFILER_END(start, event, obj)
+#endif
+
+
+/**
+ * @brief Profiler_init Enable profiler if PROFILER_ENV_ENABLE is set
+ */
+void Profiler_init();
+
+/**
+ * @brief Profiler_setEnabled Runtime switch of profiler (no-op if compiled out),
+ *        toggled by CORE_PROFILER_KEY
+ * @param enabled
+ */
+void Profiler_setEnabled(bool enabled);
+
+/**
+ * @brief Profiler_isEnabled
+ * @return
+ */
+bool Profiler_isEnabled();
+
+/**
+ * @brief Profiler_registerThread Create ring buffer of calling thread, samples of
+ *        unregistered threads are dropped
+ * @param name Name of thread in trace
+ * @return
+ */
+bool Profiler_registerThread(const char * name);
+
+/**
+ * @brief Profiler_setName Name of object shown in overlay and trace
+ * @param obj
+ * @param name
+ */
+void Profiler_setName(const void * obj, const char * name);
+
+/**
+ * @brief Profiler_begin Start of measured call
+ * @return Current time [ns], 0 if profiler is disabled
+ */
+int64_t Profiler_begin();
+
+/**
+ * @brief Profiler_record Store sample into ring buffer of calling thread
+ * @param start Result of Profiler_begin
+ * @param event
+ * @param obj
+ */
+void Profiler_record(int64_t start, Profiler_Event event, const void * obj);
+
+/**
+ * @brief Profiler_renderOverlay Draw frame time graph and objects with highest
+ *        inclusive time of last second (render thread)
+ * @param evt
+ */
+void Profiler_renderOverlay(const Event_Render * evt);
+
+/**
+ * @brief Profiler_dumpTrace Write samples of all threads as Chrome trace JSON
+ * @param path
+ * @return
+ */
+bool Profiler_dumpTrace(const char * path);
+
+/**
+ * @brief Profiler_destruct Write trace to PROFILER_ENV_TRACE (if set), free ring buffers
+ */
+void Profiler_destruct();
+
+#endif // PROFILER_H
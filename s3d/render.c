@@ -12,13 +12,21 @@
 #include "render.h"
 
 #include <math.h>
+#include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#include "bitmapfont.h"
+#include "rendergl.h"
 
 
+static const Render_Backend * BACKEND = &RENDERGL_BACKEND;
+
 static Color COLOR = COLOR_WHITE;
 
 static GLfloat MAX_ALPHA = 1.0;
 
+static GLfloat LINE_WIDTH = RENDER_DEFAULT_LINE_WIDTH;
+
 static GLfloat SCALE_X = 1.0;
 static GLfloat SCALE_Y = 1.0;
 
@@ -26,33 +34,390 @@ static GLfloat OFFSET_X = 0.0;
 static GLfloat OFFSET_Y = 0.0;
 static GLfloat OFFSET_Z = 0.0;
 
-static void * FONT = E2D_BITMAP_HELVETICA_18;
+//transform saved by Render_pushTransform
+typedef struct {
+    GLfloat offset_x, offset_y, offset_z;
+    GLfloat scale_x, scale_y;
+} Transform;
+
+//stack of saved transforms (render thread only)
+static Transform * TRANSFORMS = NULL;
+static size_t TRANSFORMS_COUNT = 0;
+static size_t TRANSFORMS_SIZE = 0;
+
+static void * FONT = RENDER_DEFAULT_FONT;
+
+//base scissor of frame (width 0 -> whole window)
+static int BASE_SCISSOR[4] = {0, 0, 0, 0};
+
+//clip rectangle in window coordinates
+typedef struct {
+    GLfloat x0, y0;
+    GLfloat x1, y1;
+} Clip;
+
+//stack of nested clip rectangles, [0] is set by Render_resetScissor (render thread only)
+static Clip * CLIPS = NULL;
+static size_t CLIPS_COUNT = 0;
+static size_t CLIPS_SIZE = 0;
+//pushes not stored (no base clip or out of memory), matching pops only decrement it
+static size_t CLIPS_DROPPED = 0;
 
 static bool ENABLE_PT_COLOR = false;
 
+//vertices of primitive passed to backend (render thread only)
+static Render_Vertex * VERTICES = NULL;
+static size_t VERTICES_SIZE = 0;
 
-static void applyPtColor(Point2D * p) {
-    if(p != NULL) {
-        if(ENABLE_PT_COLOR) {
-            glColor4f(p->color.red, p->color.green, p->color.blue, MIN(p->color.alpha, MAX_ALPHA));
+//geometry recorded instead of drawing
+static Render_Geometry * RECORDING = NULL;
+//number of flushes + 1, geometry drawn in current one is referenced by pending commands
+static unsigned int FLUSH = 1;
+
+//instances in window coordinates
+static Render_Instance * INSTANCES = NULL;
+static size_t INSTANCES_SIZE = 0;
+
+//ear clipping of mesh faces
+static size_t * RING = NULL;
+static size_t RING_SIZE = 0;
+
+//unit circles (cos, sin pairs) indexed by segment count, created on first use (render thread only)
+static GLfloat * CIRCLES[RENDER_CIRCLE_MAX_SEGMENTS + 1] = {NULL};
+
+//backend data of destructed geometries, released by render thread
+static pthread_mutex_t RELEASED_LOCK = PTHREAD_MUTEX_INITIALIZER;
+static void ** RELEASED = NULL;
+static size_t RELEASED_COUNT = 0;
+static size_t RELEASED_SIZE = 0;
+
+
+static Render_Vertex * vertices(size_t count) {
+    if(count > VERTICES_SIZE) {
+        Render_Vertex * v = realloc(VERTICES, sizeof(Render_Vertex) * count);
+        if(v == NULL) return NULL;
+        VERTICES = v;
+        VERTICES_SIZE = count;
+    }
+    return VERTICES;
+}
+
+static bool reserve(void ** data, size_t * size, size_t count, size_t item) {
+    if(count <= *size) return true;
+
+    size_t new_size = MAX(count, *size * 2);
+    void * d = realloc(*data, new_size * item);
+    if(d == NULL) return false;
+    *data = d;
+    *size = new_size;
+    return true;
+}
+
+static void record(Render_Mode mode, const Render_Vertex * v, size_t count, const Texture * texture) {
+    Render_Geometry * g = RECORDING;
+    size_t n = Render_listCount(mode, count);
+    if(n == 0) return;
+    if(!reserve((void**) &g->vertices, &g->size, g->count + n, sizeof(Render_Vertex))) return;
+
+    mode = Render_toList(mode, v, count, g->vertices + g->count);
+    GLfloat line_width = mode == Render_Lines ? LINE_WIDTH : 0.0;
+
+    //join previous batch with same state
+    Render_GeometryBatch * b = g->batch_count > 0 ? &g->batches[g->batch_count - 1] : NULL;
+    if(b == NULL || b->mode != mode || b->line_width != line_width || b->texture != texture) {
+        if(!reserve((void**) &g->batches, &g->batch_size, g->batch_count + 1, sizeof(Render_GeometryBatch))) return;
+        b = &g->batches[g->batch_count++];
+        *b = (Render_GeometryBatch){mode, line_width, texture, g->count, 0};
+    }
+    b->count += n;
+    g->count += n;
+}
+
+static void submit(Render_Mode mode, const Render_Vertex * v, size_t count, const Texture * texture) {
+    if(RECORDING != NULL) {
+        record(mode, v, count, texture);
+    } else {
+        BACKEND->draw(mode, v, count, LINE_WIDTH, texture);
+    }
+}
+
+static Color currentColor() {
+    return (Color){COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA)};
+}
+
+/**
+ * @brief setVertex Transform point to window coordinates
+ * @param v
+ * @param x
+ * @param y
+ * @param p Point whose color is used if point colors are enabled (NULL -> current color)
+ */
+static void setVertex(Render_Vertex * v, GLfloat x, GLfloat y, const Point2D * p) {
+    v->x = OFFSET_X + x * SCALE_X;
+    v->y = OFFSET_Y + y * SCALE_Y;
+    v->u = 0.0;
+    v->v = 0.0;
+    if(p != NULL && ENABLE_PT_COLOR) {
+        v->color = (Color){p->color.red, p->color.green, p->color.blue, MIN(p->color.alpha, MAX_ALPHA)};
+    } else {
+        v->color = currentColor();
+    }
+}
+
+static void drawPoints(Render_Mode mode, const Point2D * p, size_t count) {
+    Render_Vertex * v = vertices(count);
+    if(v == NULL) return;
+
+    for(size_t i = 0; i < count; ++i) {
+        setVertex(v + i, p[i].x, p[i].y, p + i);
+    }
+    submit(mode, v, count, NULL);
+}
+
+static void drawRectangle(Render_Mode mode, const Point2D * p, size_t width, size_t height) {
+    Render_Vertex * v = vertices(4);
+    if(v == NULL) return;
+
+    setVertex(v, p->x, p->y, NULL);
+    setVertex(v + 1, p->x + width, p->y, NULL);
+    setVertex(v + 2, p->x + width, p->y + height, NULL);
+    setVertex(v + 3, p->x, p->y + height, NULL);
+    submit(mode, v, 4, NULL);
+}
+
+static const GLfloat * circle(size_t segments) {
+    if(CIRCLES[segments] == NULL) {
+        GLfloat * t = malloc(sizeof(GLfloat) * 2 * segments);
+        if(t == NULL) return NULL;
+        for(size_t i = 0; i < segments; ++i) {
+            double theta = 2.0 * 3.14159265358979 * i / segments;
+            t[2 * i] = cos(theta);
+            t[2 * i + 1] = sin(theta);
+        }
+        CIRCLES[segments] = t;
+    }
+    return CIRCLES[segments];
+}
+
+static void drawEllipse(Render_Mode mode, const Point2D * p, GLfloat rx, GLfloat ry) {
+    //level of detail from radius in window
+    GLfloat sx = rx * SCALE_X;
+    GLfloat sy = ry * SCALE_Y;
+    size_t segments = RENDER_CIRCLE_MIN_SEGMENTS + MAX(fabsf(sx), fabsf(sy)) / RENDER_CIRCLE_SEGMENT_STEP;
+    segments = MIN(segments, (size_t) RENDER_CIRCLE_MAX_SEGMENTS);
+
+    const GLfloat * t = circle(segments);
+    Render_Vertex * v = vertices(segments);
+    if(t == NULL || v == NULL) return;
+
+    GLfloat cx = OFFSET_X + p->x * SCALE_X;
+    GLfloat cy = OFFSET_Y + p->y * SCALE_Y;
+    Color color = currentColor();
+    for(size_t i = 0; i < segments; ++i) {
+        v[i] = (Render_Vertex){cx + t[2 * i] * sx, cy + t[2 * i + 1] * sy, 0.0, 0.0, color};
+    }
+    submit(mode, v, segments, NULL);
+}
+
+void Render_setBackend(const Render_Backend * backend) {
+    BACKEND = backend != NULL ? backend : &RENDERGL_BACKEND;
+}
+
+const Render_Backend * Render_getBackend() {
+    return BACKEND;
+}
+
+void Render_init() {
+    BACKEND->init();
+}
+
+void Render_viewport(int width, int height) {
+    BACKEND->viewport(width, height);
+}
+
+void Render_flush() {
+    BACKEND->flush();
+    ++FLUSH;
+
+    pthread_mutex_lock(&RELEASED_LOCK);
+    for(size_t i = 0; i < RELEASED_COUNT; ++i) {
+        BACKEND->releaseGeometry(RELEASED[i]);
+    }
+    RELEASED_COUNT = 0;
+    pthread_mutex_unlock(&RELEASED_LOCK);
+}
+
+void Render_loadTexture(Texture * texture) {
+    if(texture != NULL) {
+        BACKEND->loadTexture(texture);
+    }
+}
+
+size_t Render_listCount(Render_Mode mode, size_t count) {
+    switch(mode) {
+    case Render_Lines: return count & ~(size_t) 1;
+    case Render_LineStrip: return count > 1 ? 2 * (count - 1) : 0;
+    case Render_LineLoop: return count > 2 ? 2 * count : count > 1 ? 2 : 0;
+    case Render_Triangles: return count - count % 3;
+    case Render_TriangleFan: return count > 2 ? 3 * (count - 2) : 0;
+    }
+    return 0;
+}
+
+Render_Mode Render_toList(Render_Mode mode, const Render_Vertex * src, size_t count, Render_Vertex * dst) {
+    size_t i;
+    switch(mode) {
+    case Render_Lines:
+    case Render_Triangles:
+        memcpy(dst, src, Render_listCount(mode, count) * sizeof(Render_Vertex));
+        break;
+    case Render_LineStrip:
+    case Render_LineLoop:
+        for(i = 0; i + 1 < count; ++i) {
+            *dst++ = src[i];
+            *dst++ = src[i + 1];
+        }
+        if(mode == Render_LineLoop && count > 2) {
+            *dst++ = src[count - 1];
+            *dst++ = src[0];
+        }
+        return Render_Lines;
+    case Render_TriangleFan:
+        for(i = 1; i + 1 < count; ++i) {
+            *dst++ = src[0];
+            *dst++ = src[i];
+            *dst++ = src[i + 1];
+        }
+        return Render_Triangles;
+    }
+    return mode;
+}
+
+void Render_initGeometry(Render_Geometry * geometry) {
+    if(geometry != NULL) {
+        memset(geometry, 0, sizeof(Render_Geometry));
+    }
+}
+
+void Render_beginGeometry(Render_Geometry * geometry) {
+    if(geometry != NULL) {
+        //pending draws of previous recording are executed before it is overwritten
+        if(geometry->drawn == FLUSH) Render_flush();
+        geometry->count = 0;
+        geometry->batch_count = 0;
+        geometry->offset_x = OFFSET_X;
+        geometry->offset_y = OFFSET_Y;
+        ++geometry->version;
+    }
+    RECORDING = geometry;
+}
+
+void Render_endGeometry() {
+    RECORDING = NULL;
+}
+
+void Render_drawGeometry(Render_Geometry * geometry) {
+    if(geometry != NULL && geometry->count > 0 && geometry != RECORDING) {
+        geometry->drawn = FLUSH;
+        BACKEND->drawGeometry(geometry, OFFSET_X - geometry->offset_x, OFFSET_Y - geometry->offset_y);
+    }
+}
+
+void Render_drawInstances(const Render_Geometry * unit, const Render_Instance * instances, size_t count) {
+    if(unit == NULL || instances == NULL || count == 0 || unit->count == 0 || unit == RECORDING) return;
+    if(!reserve((void**) &INSTANCES, &INSTANCES_SIZE, count, sizeof(Render_Instance))) return;
+
+    for(size_t i = 0; i < count; ++i) {
+        INSTANCES[i] = instances[i];
+        INSTANCES[i].x = OFFSET_X + instances[i].x * SCALE_X;
+        INSTANCES[i].y = OFFSET_Y + instances[i].y * SCALE_Y;
+        INSTANCES[i].color.alpha = MIN(instances[i].color.alpha, MAX_ALPHA);
+    }
+
+    if(RECORDING != NULL) {
+        GLfloat line_width = LINE_WIDTH;
+        for(size_t i = 0; i < count; ++i) {
+            for(size_t j = 0; j < unit->batch_count; ++j) {
+                const Render_GeometryBatch * b = &unit->batches[j];
+                Render_Vertex * v = vertices(b->count);
+                if(v == NULL) return;
+                Render_instanceVertices(unit, b, &INSTANCES[i], SCALE_X, SCALE_Y, v);
+                LINE_WIDTH = b->line_width;
+                record(b->mode, v, b->count, b->texture);
+            }
         }
+        LINE_WIDTH = line_width;
+    } else {
+        BACKEND->drawInstances(unit, INSTANCES, count, SCALE_X, SCALE_Y);
+    }
+}
+
+void Render_instanceVertices(const Render_Geometry * unit, const Render_GeometryBatch * batch,
+                             const Render_Instance * instance, GLfloat scale_x, GLfloat scale_y,
+                             Render_Vertex * dst) {
+    const Render_Vertex * src = unit->vertices + batch->first;
+    const GLfloat sx = instance->size * scale_x;
+    const GLfloat sy = instance->size * scale_y;
+    const Color * c = &instance->color;
+    for(size_t i = 0; i < batch->count; ++i) {
+        dst[i].x = instance->x + (src[i].x - unit->offset_x) * sx;
+        dst[i].y = instance->y + (src[i].y - unit->offset_y) * sy;
+        dst[i].u = src[i].u;
+        dst[i].v = src[i].v;
+        dst[i].color.red = src[i].color.red * c->red;
+        dst[i].color.green = src[i].color.green * c->green;
+        dst[i].color.blue = src[i].color.blue * c->blue;
+        dst[i].color.alpha = src[i].color.alpha * c->alpha;
+    }
+}
+
+void Render_destructGeometry(Render_Geometry * geometry) {
+    if(geometry != NULL) {
+        if(geometry->backend != NULL) {
+            pthread_mutex_lock(&RELEASED_LOCK);
+            if(reserve((void**) &RELEASED, &RELEASED_SIZE, RELEASED_COUNT + 1, sizeof(void*))) {
+                RELEASED[RELEASED_COUNT++] = geometry->backend;
+            }
+            pthread_mutex_unlock(&RELEASED_LOCK);
+        }
+        free(geometry->vertices);
+        free(geometry->batches);
+        Render_initGeometry(geometry);
+    }
+}
+
+bool Render_pushTransform() {
+    if(!reserve((void**) &TRANSFORMS, &TRANSFORMS_SIZE, TRANSFORMS_COUNT + 1, sizeof(Transform))) return false;
+    TRANSFORMS[TRANSFORMS_COUNT++] = (Transform){OFFSET_X, OFFSET_Y, OFFSET_Z, SCALE_X, SCALE_Y};
+    return true;
+}
+
+void Render_popTransform() {
+    if(TRANSFORMS_COUNT > 0) {
+        const Transform * t = &TRANSFORMS[--TRANSFORMS_COUNT];
+        OFFSET_X = t->offset_x;
+        OFFSET_Y = t->offset_y;
+        OFFSET_Z = t->offset_z;
+        SCALE_X = t->scale_x;
+        SCALE_Y = t->scale_y;
     }
 }
 
+void Render_translate(GLfloat x, GLfloat y) {
+    OFFSET_X += x * SCALE_X;
+    OFFSET_Y += y * SCALE_Y;
+}
+
 void Render_scale(GLfloat x, GLfloat y) {
     if(x > 0.0 && y > 0.0) {
-        if(SCALE_X != 1.0 || SCALE_Y != 1.0) {
-            glScalef(1.0 / SCALE_X, 1.0 / SCALE_Y, 1.0);
-        }
-        SCALE_X = x;
-        SCALE_Y = y;
-        glScalef(x, y, 1.0);
+        SCALE_X *= x;
+        SCALE_Y *= y;
     }
 }
 
 void Render_lineWidth(GLfloat width) {
     if(width > 0.0) {
-        glLineWidth(width);
+        LINE_WIDTH = width;
     }
 }
 
@@ -66,7 +431,13 @@ int Render_getStringWidth(const char * str) {
     if(str == NULL) return 0;
     if(FONT == NULL) return 0;
 
-    return glutBitmapLength(FONT, (const unsigned char *) str);
+    const BitmapFont * font = BitmapFont_get(FONT);
+    int length = 0;
+    for(const char * c = str; *c; ++c) {
+        length += BitmapFont_charWidth(font, *c);
+    }
+
+    return length;
 }
 
 int Render_getStringWidthIndex(const char * str, int lastCharIndex) {
@@ -74,10 +445,10 @@ int Render_getStringWidthIndex(const char * str, int lastCharIndex) {
     if(FONT == NULL) return 0;
     if(lastCharIndex < 0) return 0;
 
+    const BitmapFont * font = BitmapFont_get(FONT);
     int length = 0;
-    int len = strlen(str);
-    for(int index = 0; index < lastCharIndex && index < len && index >= 0; ++index) {
-        length += glutBitmapWidth(FONT, *(str + index));
+    for(int index = 0; index < lastCharIndex && str[index]; ++index) {
+        length += BitmapFont_charWidth(font, str[index]);
     }
 
     return length;
@@ -86,17 +457,25 @@ int Render_getStringWidthIndex(const char * str, int lastCharIndex) {
 int Render_getStringWidthRange(const char * str, int start, int end) {
     if(str == NULL) return 0;
     if(FONT == NULL) return 0;
-    if(start > end) return 0;
+    if(start < 0 || start > end) return 0;
 
+    const BitmapFont * font = BitmapFont_get(FONT);
+    //end of string can be before start
+    for(int index = 0; index < start; ++index) {
+        if(!str[index]) return 0;
+    }
     int length = 0;
-    int len = strlen(str);
-    for(int index = start; index < end && index < len && index >= 0; ++index) {
-        length += glutBitmapWidth(FONT, *(str + index));
+    for(int index = start; index < end && str[index]; ++index) {
+        length += BitmapFont_charWidth(font, str[index]);
     }
 
     return length;
 }
 
+void Render_layoutString(Text_Layout * layout, const char * str) {
+    Text_layout(layout, RENDER_DEFAULT_FONT, str);
+}
+
 int Render_getStringHeight() {
     if(FONT == NULL) return 0;
 
@@ -163,44 +542,90 @@ void Render_applyOffset(GLfloat x, GLfloat y, GLfloat z) {
         OFFSET_X += x;
         OFFSET_Y += y;
         OFFSET_Z += z;
-        glTranslatef(x, y, z);
     }
 }
 
 void Render_clearOffset() {
-    if(OFFSET_X != 0.0 || OFFSET_Y != 0.0 || OFFSET_Z != 0.0) {
-        glTranslatef(-OFFSET_X, -OFFSET_Y, -OFFSET_Z);
-        OFFSET_X = 0.0;
-        OFFSET_Y = 0.0;
-        OFFSET_Z = 0.0;
+    OFFSET_X = 0.0;
+    OFFSET_Y = 0.0;
+    OFFSET_Z = 0.0;
+}
+
+static void applyClip() {
+    const Clip * c = &CLIPS[CLIPS_COUNT - 1];
+    int x0 = floorf(c->x0), y0 = floorf(c->y0);
+    BACKEND->scissor(x0, y0, MAX((int) ceilf(c->x1) - x0, 0), MAX((int) ceilf(c->y1) - y0, 0));
+}
+
+/**
+ * @brief clipRect Rectangle in current coordinates to window coordinates
+ */
+static Clip clipRect(GLfloat x, GLfloat y, GLfloat width, GLfloat height) {
+    GLfloat x0 = OFFSET_X + x * SCALE_X, x1 = OFFSET_X + (x + width) * SCALE_X;
+    GLfloat y0 = OFFSET_Y + y * SCALE_Y, y1 = OFFSET_Y + (y + height) * SCALE_Y;
+    return (Clip){MIN(x0, x1), MIN(y0, y1), MAX(x0, x1), MAX(y0, y1)};
+}
+
+bool Render_pushClip(GLfloat x, GLfloat y, GLfloat width, GLfloat height) {
+    //after dropped push nested ones are dropped too, so pops stay in order
+    if(CLIPS_COUNT == 0 || CLIPS_DROPPED > 0 ||
+            !reserve((void**) &CLIPS, &CLIPS_SIZE, CLIPS_COUNT + 1, sizeof(Clip))) {
+        ++CLIPS_DROPPED;
+        return true;
     }
+
+    const Clip * top = &CLIPS[CLIPS_COUNT - 1];
+    Clip r = clipRect(x, y, width, height);
+    r.x0 = MAX(r.x0, top->x0);
+    r.y0 = MAX(r.y0, top->y0);
+    r.x1 = MAX(MIN(r.x1, top->x1), r.x0);
+    r.y1 = MAX(MIN(r.y1, top->y1), r.y0);
+    CLIPS[CLIPS_COUNT++] = r;
+    applyClip();
+    return r.x1 > r.x0 && r.y1 > r.y0;
 }
 
-void Render_setScissor(GLfloat x, GLfloat y, GLfloat width,
-                       GLfloat height, const Event_Render * evt) {
-    return;  //remove
-    if(width > 0 && height > 0 && evt->window_width > 0 && evt->window_height > 0) {
-        int x_s = OFFSET_X + x;
-        int y_s = evt->window_height - y - OFFSET_Y;
-        glScissor(x_s, y_s,
-                  MIN(width, evt->window_width - x),
-                  MIN(height, evt->window_height - y));
+void Render_popClip() {
+    if(CLIPS_DROPPED > 0) {
+        --CLIPS_DROPPED;
+    } else if(CLIPS_COUNT > 1) {
+        --CLIPS_COUNT;
+        applyClip();
     }
 }
 
+bool Render_isClipped(GLfloat x, GLfloat y, GLfloat width, GLfloat height) {
+    if(CLIPS_COUNT == 0) return false;
+
+    const Clip * top = &CLIPS[CLIPS_COUNT - 1];
+    Clip r = clipRect(x, y, width, height);
+    return r.x1 <= top->x0 || r.x0 >= top->x1 || r.y1 <= top->y0 || r.y0 >= top->y1;
+}
+
 void Render_resetScissor(const Event_Render * evt) {
     if(evt->window_width > 0 && evt->window_height > 0) {
-        glScissor(OFFSET_X, OFFSET_Y,
-                  evt->window_width, evt->window_height);
+        if(!reserve((void**) &CLIPS, &CLIPS_SIZE, 1, sizeof(Clip))) return;
+        if(BASE_SCISSOR[2] > 0 && BASE_SCISSOR[3] > 0) {
+            CLIPS[0] = (Clip){BASE_SCISSOR[0], BASE_SCISSOR[1],
+                              BASE_SCISSOR[0] + BASE_SCISSOR[2], BASE_SCISSOR[1] + BASE_SCISSOR[3]};
+        } else {
+            CLIPS[0] = (Clip){OFFSET_X, OFFSET_Y, OFFSET_X + evt->window_width, OFFSET_Y + evt->window_height};
+        }
+        CLIPS_COUNT = 1;
+        CLIPS_DROPPED = 0;
+        applyClip();
     }
 }
 
-void Render_clear(Event_Render * evt, Color * color) {
-    glClear(GL_COLOR_BUFFER_BIT);
+void Render_setBaseScissor(int x, int y, int width, int height) {
+    BASE_SCISSOR[0] = x;
+    BASE_SCISSOR[1] = y;
+    BASE_SCISSOR[2] = width;
+    BASE_SCISSOR[3] = height;
+}
 
-    if(color != NULL) {
-        glClearColor(color->red, color->green, color->blue, 1.0);
-    }
+void Render_clear(Event_Render * evt, Color * color) {
+    BACKEND->clear(color);
 
     if(evt != NULL) {
         Render_resetScissor(evt);
@@ -208,246 +633,115 @@ void Render_clear(Event_Render * evt, Color * color) {
 
     MAX_ALPHA = 1.0;
     COLOR.red = COLOR.green = COLOR.blue = 1.0;
-    FONT = E2D_BITMAP_HELVETICA_18;
-    glLineWidth(1.0);
+    FONT = RENDER_DEFAULT_FONT;
+    LINE_WIDTH = RENDER_DEFAULT_LINE_WIDTH;
 
     Render_clearOffset();
 
-    if(SCALE_X != 1.0 || SCALE_Y != 1.0) {
-        glScalef(1.0 / SCALE_X, 1.0 / SCALE_Y, 1.0);
-        SCALE_X = 1.0;
-        SCALE_Y = 1.0;
-    }
+    SCALE_X = 1.0;
+    SCALE_Y = 1.0;
+    TRANSFORMS_COUNT = 0;
 }
 
 void Render_drawLine(Point2D * p1, Point2D * p2) {
     if(p1 != NULL && p2 != NULL) {
-        if(!ENABLE_PT_COLOR) {
-            glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        }
-        glBegin(GL_LINES);
-        applyPtColor(p1);
-        glVertex2f(p1->x, p1->y);
-        applyPtColor(p2);
-        glVertex2f(p2->x, p2->y);
-        glEnd();
+        Point2D p[2] = {*p1, *p2};
+        drawPoints(Render_Lines, p, 2);
     }
 }
 
 void Render_drawLines(Point2D * p, size_t count) {
-    if(p != NULL && count > 0) {
-        Point2D * p1, *p2;
-        p1 = p;
-        p2 = NULL;
-        if(!ENABLE_PT_COLOR) {
-            glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        }
-        for(size_t i = 1; i < count; ++i) {
-            p2 = p1 + 1;
-            glBegin(GL_LINES);
-            applyPtColor(p1);
-            glVertex2f(p1->x, p1->y);
-            applyPtColor(p2);
-            glVertex2f(p2->x, p2->y);
-            glEnd();
-            p1 = p2;
-        }
+    if(p != NULL && count > 1) {
+        drawPoints(Render_LineStrip, p, count);
     }
 }
 
 void Render_drawTriangle(Point2D * p1, Point2D * p2, Point2D * p3) {
     if(p1 != NULL && p2 != NULL && p3 != NULL) {
-        if(!ENABLE_PT_COLOR) {
-            glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        }
-        glBegin(GL_LINE_LOOP);
-        applyPtColor(p1);
-        glVertex2f(p1->x, p1->y);
-        applyPtColor(p2);
-        glVertex2f(p2->x, p2->y);
-        applyPtColor(p3);
-        glVertex2f(p3->x, p3->y);
-        glEnd();
+        Point2D p[3] = {*p1, *p2, *p3};
+        drawPoints(Render_LineLoop, p, 3);
     }
 }
 
 void Render_drawQuad(Point2D * p1, Point2D * p2, Point2D * p3, Point2D * p4) {
-    if(p1 != NULL && p2 != NULL && p3 != NULL) {
-        if(!ENABLE_PT_COLOR) {
-            glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        }
-        glBegin(GL_LINE_LOOP);
-        applyPtColor(p1);
-        glVertex2f(p1->x, p1->y);
-        applyPtColor(p2);
-        glVertex2f(p2->x, p2->y);
-        applyPtColor(p3);
-        glVertex2f(p3->x, p3->y);
-        applyPtColor(p4);
-        glVertex2f(p4->x, p4->y);
-        glEnd();
+    if(p1 != NULL && p2 != NULL && p3 != NULL && p4 != NULL) {
+        Point2D p[4] = {*p1, *p2, *p3, *p4};
+        drawPoints(Render_LineLoop, p, 4);
     }
 }
 
 void Render_drawPolygon(Point2D * p, size_t count) {
     if(p != NULL && count > 3) {
-        if(!ENABLE_PT_COLOR) {
-            glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        }
-        glBegin(GL_LINE_LOOP);
-        for(size_t i = 0; i <= count; ++i) {
-            applyPtColor(p + i);
-            glVertex2f((p + i)->x, (p + i)->y);
-        }
-        glEnd();
+        drawPoints(Render_LineLoop, p, count);
     }
 }
 
 void Render_drawRectangle(Point2D * p, size_t width, size_t height) {
     if(p != NULL && width > 0 && height > 0) {
-        glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        glBegin(GL_LINE_LOOP);
-        glVertex2f(p->x, p->y);
-        glVertex2f(p->x + width, p->y);
-        glVertex2f(p->x + width, p->y + height);
-        glVertex2f(p->x, p->y + height);
-        glEnd();
+        drawRectangle(Render_LineLoop, p, width, height);
     }
 }
 
 void Render_fillTriangle(Point2D * p1, Point2D * p2, Point2D * p3) {
     if(p1 != NULL && p2 != NULL && p3 != NULL) {
-        if(!ENABLE_PT_COLOR) {
-            glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        }
-        glBegin(GL_TRIANGLES);
-        applyPtColor(p1);
-        glVertex2f(p1->x, p1->y);
-        applyPtColor(p2);
-        glVertex2f(p2->x, p2->y);
-        applyPtColor(p3);
-        glVertex2f(p3->x, p3->y);
-        glEnd();
+        Point2D p[3] = {*p1, *p2, *p3};
+        drawPoints(Render_Triangles, p, 3);
     }
 }
 
 void Render_fillQuad(Point2D * p1, Point2D * p2, Point2D * p3, Point2D * p4) {
-    if(p1 != NULL && p2 != NULL && p3 != NULL) {
-        if(!ENABLE_PT_COLOR) {
-            glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        }
-        glBegin(GL_QUADS);
-        applyPtColor(p1);
-        glVertex2f(p1->x, p1->y);
-        applyPtColor(p2);
-        glVertex2f(p2->x, p2->y);
-        applyPtColor(p3);
-        glVertex2f(p3->x, p3->y);
-        applyPtColor(p4);
-        glVertex2f(p4->x, p4->y);
-        glEnd();
+    if(p1 != NULL && p2 != NULL && p3 != NULL && p4 != NULL) {
+        Point2D p[4] = {*p1, *p2, *p3, *p4};
+        drawPoints(Render_TriangleFan, p, 4);
     }
 }
 
 void Render_fillPolygon(Point2D * p, size_t count) {
     if(p != NULL && count > 3) {
-        if(!ENABLE_PT_COLOR) {
-            glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        }
-        glBegin(GL_POLYGON);
-        for(size_t i = 0; i < count; ++i) {
-            applyPtColor(p + i);
-            glVertex2f((p + i)->x, (p + i)->y);
-        }
-        glEnd();
+        drawPoints(Render_TriangleFan, p, count);
     }
 }
 
 void Render_drawEllipse(Point2D * p, GLfloat rx, GLfloat ry) {
     if(p != NULL) {
-        int num_segments = 12 + MAX(rx, ry) / 5;
-        float theta = 2 * 3.1415926 / num_segments;
-        float c = cosf(theta);
-        float s = sinf(theta);
-        float t;
-        float x = 1;
-        float y = 0;
-        glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        glBegin(GL_LINE_LOOP);
-        for(int i = 0; i < num_segments; i++)
-        {
-            glVertex2f(x * rx + p->x, y * ry + p->y);
-            t = x;
-            x = c * x - s * y;
-            y = s * t + c * y;
-        }
-        glEnd();
+        drawEllipse(Render_LineLoop, p, rx, ry);
     }
 }
 
 void Render_fillEllipse(Point2D * p, GLfloat rx, GLfloat ry) {
     if(p != NULL) {
-        int num_segments = 12 + MAX(rx, ry) / 5;
-        float theta = 2 * 3.1415926 / num_segments;
-        float c = cosf(theta);
-        float s = sinf(theta);
-        float t;
-        float x = 1;
-        float y = 0;
-        glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        glBegin(GL_POLYGON);
-        for(int i = 0; i < num_segments; i++)
-        {
-            glVertex2f(x * rx + p->x, y * ry + p->y);
-            t = x;
-            x = c * x - s * y;
-            y = s * t + c * y;
-        }
-        glEnd();
+        drawEllipse(Render_TriangleFan, p, rx, ry);
     }
 }
 
 void Render_fillRectangle(Point2D * p, size_t width, size_t height) {
     if(p != NULL && width > 0 && height > 0) {
-        glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-        glBegin(GL_QUADS);
-        glVertex2f(p->x, p->y);
-        glVertex2f(p->x + width, p->y);
-        glVertex2f(p->x + width, p->y + height);
-        glVertex2f(p->x, p->y + height);
-        glEnd();
+        drawRectangle(Render_TriangleFan, p, width, height);
     }
 }
 
 void Render_drawImage(Point2D * p, Texture * texture, bool defaultShape) {
-    if(p != NULL) {
-        glColor4f(1.0, 1.0, 1.0, COLOR.alpha);
-        glBindTexture(GL_TEXTURE_2D, texture->textureID);
-        glEnable(GL_TEXTURE_2D);
-        glBegin(GL_QUADS);
+    if(p != NULL && texture != NULL) {
+        Render_Vertex * v = vertices(4);
+        if(v == NULL) return;
 
         if(defaultShape) {
-            glTexCoord2i(0, 0);
-            glVertex2f(p->x, p->y + texture->height);
-
-            glTexCoord2i(0, 1);
-            glVertex2f(p->x, p->y);
-
-            glTexCoord2i(1, 1);
-            glVertex2f(p->x + texture->width, p->y);
-
-            glTexCoord2i(1, 0);
-            glVertex2f(p->x + texture->width, p->y + texture->height);
+            setVertex(v, p->x, p->y + texture->height, NULL);
+            setVertex(v + 1, p->x, p->y, NULL);
+            setVertex(v + 2, p->x + texture->width, p->y, NULL);
+            setVertex(v + 3, p->x + texture->width, p->y + texture->height, NULL);
         } else {
             for(unsigned int i = 0; i < 4; ++i) {
-                glTexCoord2i(i > 1, i > 0 && i < 3);
-                glVertex2f((p + i)->x, (p + i)->y);
+                setVertex(v + i, (p + i)->x, (p + i)->y, NULL);
             }
         }
+        for(unsigned int i = 0; i < 4; ++i) {
+            v[i].u = i > 1;
+            v[i].v = i > 0 && i < 3;
+            v[i].color = (Color){1.0, 1.0, 1.0, COLOR.alpha};
+        }
 
-        glEnd();
-        glDisable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        submit(Render_TriangleFan, v, 4, texture);
     }
 }
 
@@ -468,19 +762,158 @@ void Render_setFont(void * font, GLint size) {
 }
 
 void Render_drawString(GLfloat x, GLfloat y, const char * const str) {
-    if(str != NULL) {
-        if(strlen(str) > 0) {
-            glColor4f(COLOR.red, COLOR.green, COLOR.blue, MIN(COLOR.alpha, MAX_ALPHA));
-            glRasterPos2f(x, y);
-            const char * c  = str;
-            while(*c){
-                glutBitmapCharacter(FONT, *c);
-                c = c + 1;
-            }
+    if(str == NULL || *str == 0) return;
+    const Text_Atlas * atlas = Text_getAtlas(FONT);
+    if(atlas == NULL) return;
+
+    Render_Vertex * v = vertices(strlen(str) * 6);
+    if(v == NULL) return;
+
+    //same placement as glRasterPos + glBitmap, glyphs are not scaled
+    Color color = currentColor();
+    const Texture * texture = &atlas->texture;
+    GLfloat px = floorf(OFFSET_X + x * SCALE_X);
+    GLfloat bottom = floorf(OFFSET_Y + y * SCALE_Y) + atlas->font->descent;
+    GLfloat top = bottom - atlas->font->height;
+    GLfloat v0, v1;
+    size_t count = 0;
+    for(const char * c = str; *c; ++c) {
+        const Text_Glyph * g = Text_glyph(atlas, *c);
+        if(g == NULL) continue;
+        if(!g->empty) {
+            //two triangles, rows of atlas go from bottom
+            Render_Vertex * q = v + count;
+            v0 = (GLfloat) g->y / texture->height;
+            v1 = (GLfloat) (g->y + atlas->font->height) / texture->height;
+            q[0] = (Render_Vertex){px, bottom, (GLfloat) g->x / texture->width, v0, color};
+            q[1] = (Render_Vertex){px + g->width, bottom, (GLfloat) (g->x + g->width) / texture->width, v0, color};
+            q[2] = (Render_Vertex){px + g->width, top, q[1].u, v1, color};
+            q[3] = q[0];
+            q[4] = q[2];
+            q[5] = (Render_Vertex){px, top, q[0].u, v1, color};
+            count += 6;
+        }
+        px += g->width;
+    }
+
+    if(count > 0) {
+        submit(Render_Triangles, v, count, texture);
+    }
+}
+
+//doubled signed area of triangle
+static GLfloat area2(const Point2D * a, const Point2D * b, const Point2D * c) {
+    return (b->x - a->x) * (c->y - a->y) - (b->y - a->y) * (c->x - a->x);
+}
+
+/**
+ * @brief triangulate Triangulate simple polygon by ear clipping, rest of
+ *        self-intersecting polygon is triangulated as fan
+ * @param p
+ * @param count
+ * @param dst (count - 2) * 3 vertices
+ * @return Number of vertices
+ */
+static size_t triangulate(const Point2D * p, size_t count, Render_Vertex * dst) {
+    if(!reserve((void**) &RING, &RING_SIZE, count, sizeof(size_t))) return 0;
+
+    //orientation of polygon
+    GLfloat orientation = 0.0;
+    for(size_t i = 0; i < count; ++i) {
+        RING[i] = i;
+        orientation += area2(p, p + i, p + (i + 1) % count);
+    }
+    orientation = orientation < 0.0 ? -1.0 : 1.0;
+
+    size_t n = 0;
+    size_t left = count;
+    size_t i = 0;
+    size_t tries = 0;
+    while(left > 3 && tries < left) {
+        const Point2D * a = p + RING[(i + left - 1) % left];
+        const Point2D * b = p + RING[i];
+        const Point2D * c = p + RING[(i + 1) % left];
+
+        bool ear = area2(a, b, c) * orientation > 0.0;
+        for(size_t j = 0; ear && j < left; ++j) {
+            const Point2D * q = p + RING[j];
+            if(q == a || q == b || q == c) continue;
+            ear = !(area2(a, b, q) * orientation >= 0.0 &&
+                    area2(b, c, q) * orientation >= 0.0 &&
+                    area2(c, a, q) * orientation >= 0.0);
+        }
+
+        if(ear) {
+            setVertex(dst + n++, a->x, a->y, a);
+            setVertex(dst + n++, b->x, b->y, b);
+            setVertex(dst + n++, c->x, c->y, c);
+            memmove(RING + i, RING + i + 1, sizeof(size_t) * (left - i - 1));
+            --left;
+            i %= left;
+            tries = 0;
+        } else {
+            i = (i + 1) % left;
+            ++tries;
+        }
+    }
+
+    for(size_t j = 1; j + 1 < left; ++j) {
+        setVertex(dst + n++, p[RING[0]].x, p[RING[0]].y, p + RING[0]);
+        setVertex(dst + n++, p[RING[j]].x, p[RING[j]].y, p + RING[j]);
+        setVertex(dst + n++, p[RING[j + 1]].x, p[RING[j + 1]].y, p + RING[j + 1]);
+    }
+    return n;
+}
+
+static void buildFace(const Face2D * face, const Texture * texture) {
+    Render_Vertex * v = vertices((face->count - 2) * 3);
+    if(v == NULL) return;
+    size_t n = triangulate(face->points, face->count, v);
+
+    if(texture != NULL) {
+        GLfloat x0 = face->points[0].x, x1 = x0;
+        GLfloat y0 = face->points[0].y, y1 = y0;
+        for(size_t i = 1; i < face->count; ++i) {
+            x0 = MIN(x0, face->points[i].x);
+            x1 = MAX(x1, face->points[i].x);
+            y0 = MIN(y0, face->points[i].y);
+            y1 = MAX(y1, face->points[i].y);
+        }
+        //bounding box in window coordinates
+        GLfloat w = (x1 - x0) * SCALE_X;
+        GLfloat h = (y1 - y0) * SCALE_Y;
+        x0 = OFFSET_X + x0 * SCALE_X;
+        y0 = OFFSET_Y + y0 * SCALE_Y;
+        for(size_t i = 0; i < n; ++i) {
+            v[i].u = w != 0.0 ? (v[i].x - x0) / w : 0.0;
+            v[i].v = h != 0.0 ? 1.0 - (v[i].y - y0) / h : 0.0;
+            v[i].color = (Color){1.0, 1.0, 1.0, COLOR.alpha};
         }
     }
+    submit(Render_Triangles, v, n, texture);
 }
 
-void Render_mesh(Point2D * p, LinkedList * faces) {
-    if(p == NULL || faces == NULL) return;
+void Render_buildMesh(Render_Geometry * mesh, LinkedList * faces, Texture * const * textures, size_t texture_count) {
+    if(mesh == NULL || faces == NULL || mesh == RECORDING) return;
+
+    Render_Geometry * recording = RECORDING;
+    Render_beginGeometry(mesh);
+    //group faces by texture, -1 -> without texture
+    for(long key = -1; key < (long) texture_count; ++key) {
+        for(LinkedList_Element * e = faces->first; e != NULL; e = e->next) {
+            const Face2D * face = e->ptr;
+            if(face == NULL || face->points == NULL || face->count < 3) continue;
+            bool textured = textures != NULL && face->textureID >= 0 && (size_t) face->textureID < texture_count;
+            if((textured ? face->textureID : -1) != key) continue;
+            buildFace(face, textured ? textures[key] : NULL);
+        }
+    }
+    RECORDING = recording;
+}
+
+void Render_mesh(Point2D * p, Render_Geometry * mesh) {
+    if(p != NULL && mesh != NULL && mesh->count > 0 && mesh != RECORDING) {
+        BACKEND->drawGeometry(mesh, OFFSET_X + p->x * SCALE_X - mesh->offset_x,
+                              OFFSET_Y + p->y * SCALE_Y - mesh->offset_y);
+    }
 }
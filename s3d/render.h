@@ -30,6 +30,7 @@
 #include "util.h"
 #include "linkedlist.h"
 #include "event.h"
+#include "text.h"
 
 
 //colors
@@ -69,6 +70,12 @@
 #define E2D_BITMAP_HELVETICA_18     GLUT_BITMAP_HELVETICA_18
 
 #define RENDER_DEFAULT_LINE_WIDTH 1
+#define RENDER_DEFAULT_FONT E2D_BITMAP_HELVETICA_18
+
+//segments of ellipse: min + screen radius / step, at most max
+#define RENDER_CIRCLE_MIN_SEGMENTS 12
+#define RENDER_CIRCLE_MAX_SEGMENTS 256
+#define RENDER_CIRCLE_SEGMENT_STEP 5
 
 
 //RGB color
@@ -114,8 +121,212 @@ typedef struct {
     GLint textureID;
 } Face3D;
 
+//primitive drawn by render backend
+typedef enum {
+    Render_Lines,
+    Render_LineStrip,
+    Render_LineLoop,
+    Render_Triangles,
+    Render_TriangleFan      /** convex polygon */
+} Render_Mode;
+
+//vertex passed to render backend
+typedef struct {
+    GLfloat x;      /** window coordinates (y axis down) */
+    GLfloat y;
+    GLfloat u;      /** texture coordinates */
+    GLfloat v;
+    Color color;    /** final color (alpha limited by max alpha) */
+} Render_Vertex;
+
+//part of retained geometry with same state
+typedef struct {
+    Render_Mode mode;           /** Render_Lines or Render_Triangles */
+    GLfloat line_width;
+    const Texture * texture;
+    size_t first;               /** first vertex */
+    size_t count;
+} Render_GeometryBatch;
+
+//primitives recorded once (Render_beginGeometry) and drawn by one call,
+//strips, loops and fans are stored as lists
+typedef struct {
+    Render_Vertex * vertices;
+    size_t count;
+    size_t size;
+    Render_GeometryBatch * batches;
+    size_t batch_count;
+    size_t batch_size;
+    GLfloat offset_x;           /** offset of recording */
+    GLfloat offset_y;
+    unsigned int version;       /** incremented by each recording */
+    unsigned int drawn;         /** flush in which geometry was drawn (render.c) */
+    void * backend;             /** data of backend (static VBO of GL backend) */
+} Render_Geometry;
+
+//copy of unit geometry (Render_drawInstances)
+typedef struct {
+    GLfloat x;      /** position of origin of unit geometry */
+    GLfloat y;
+    GLfloat size;   /** scale of unit geometry */
+    Color color;    /** multiplies colors of unit geometry */
+} Render_Instance;
+
+//render backend, Render_* functions tessellate, transform and color
+//primitives on CPU and backend only rasterizes them (strings are
+//textured quads of glyph atlas, text.h)
+typedef struct {
+    const char * name;
+    int gl_version;                                             /** required core profile (33 -> 3.3), 0 -> legacy context */
+    void (*init)();                                             /** context was created */
+    void (*viewport)(int width, int height);                    /** size of window */
+    void (*clear)(const Color * color);                         /** NULL -> last color */
+    void (*scissor)(int x, int y, int width, int height);       /** window coordinates (y axis down) */
+    void (*draw)(Render_Mode mode, const Render_Vertex * vertices, size_t count,
+                 GLfloat line_width, const Texture * texture);  /** texture NULL -> color only */
+    void (*loadTexture)(Texture * texture);                     /** texture->data was loaded */
+    void (*drawGeometry)(Render_Geometry * geometry, GLfloat dx, GLfloat dy);   /** translated */
+    void (*releaseGeometry)(void * data);                       /** free Render_Geometry.backend */
+    void (*drawInstances)(const Render_Geometry * unit, const Render_Instance * instances,
+                          size_t count, GLfloat scale_x, GLfloat scale_y);  /** window coordinates */
+    void (*flush)();                                            /** end of frame, before swap */
+} Render_Backend;
+
+
+/**
+ * @brief Render_setBackend Change render backend, must be called before
+ *        Render_init (default is legacy OpenGL backend, rendergl.h)
+ * @param backend NULL -> default backend
+ */
+void Render_setBackend(const Render_Backend * backend);
+
+/**
+ * @brief Render_getBackend
+ * @return Current render backend
+ */
+const Render_Backend * Render_getBackend();
+
+/**
+ * @brief Render_init Init backend (after creation of GL context)
+ */
+void Render_init();
+
+/**
+ * @brief Render_viewport Size of window was changed
+ * @param width
+ * @param height
+ */
+void Render_viewport(int width, int height);
+
+/**
+ * @brief Render_flush Submit everything drawn in frame (backend can defer drawing
+ *        until end of frame), called before swap of buffers
+ */
+void Render_flush();
+
+/**
+ * @brief Render_loadTexture Pass loaded texture data to backend
+ * @param texture
+ */
+void Render_loadTexture(Texture * texture);
+
+/**
+ * @brief Render_listCount Number of vertices of primitives converted to list
+ * @param mode
+ * @param count
+ * @return
+ */
+size_t Render_listCount(Render_Mode mode, size_t count);
+
+/**
+ * @brief Render_toList Convert strip, loop or fan to list of lines or triangles
+ * @param mode
+ * @param src
+ * @param count
+ * @param dst Render_listCount(mode, count) vertices
+ * @return Render_Lines or Render_Triangles
+ */
+Render_Mode Render_toList(Render_Mode mode, const Render_Vertex * src, size_t count, Render_Vertex * dst);
+
+/**
+ * @brief Render_initGeometry
+ * @param geometry
+ */
+void Render_initGeometry(Render_Geometry * geometry);
+
+/**
+ * @brief Render_beginGeometry Clear geometry and record all following primitives
+ *        into it instead of drawing them (render thread). Primitives are recorded
+ *        with current offset and scale, scissor is not recorded. Geometry drawn since
+ *        last flush is flushed first, backends read it when commands are executed
+ * @param geometry
+ */
+void Render_beginGeometry(Render_Geometry * geometry);
+
+/**
+ * @brief Render_endGeometry Stop recording
+ */
+void Render_endGeometry();
+
+/**
+ * @brief Render_drawGeometry Draw recorded primitives, geometry is moved by
+ *        difference of current offset and offset of recording
+ * @param geometry
+ */
+void Render_drawGeometry(Render_Geometry * geometry);
+
+/**
+ * @brief Render_drawInstances Draw unit geometry once for each instance by one call.
+ *        Unit geometry is recorded without scale, its coordinates are relative
+ *        to offset of recording
+ * @param unit
+ * @param instances
+ * @param count
+ */
+void Render_drawInstances(const Render_Geometry * unit, const Render_Instance * instances, size_t count);
+
+/**
+ * @brief Render_instanceVertices Vertices of batch of unit geometry placed by instance
+ *        (for backends)
+ * @param unit
+ * @param batch
+ * @param instance Instance in window coordinates
+ * @param scale_x Scale of unit geometry in addition to instance size
+ * @param scale_y
+ * @param dst batch->count vertices
+ */
+void Render_instanceVertices(const Render_Geometry * unit, const Render_GeometryBatch * batch,
+                             const Render_Instance * instance, GLfloat scale_x, GLfloat scale_y,
+                             Render_Vertex * dst);
+
+/**
+ * @brief Render_destructGeometry Free geometry (any thread), backend data are
+ *        released by render thread in next Render_flush
+ * @param geometry
+ */
+void Render_destructGeometry(Render_Geometry * geometry);
+
+/**
+ * @brief Render_pushTransform Save current transform (offset and scale),
+ *        vertices are transformed on CPU when they are submitted
+ * @return False -> out of memory, nothing saved, caller must not change transform or pop
+ */
+bool Render_pushTransform();
+
+/**
+ * @brief Render_popTransform Restore transform saved by last Render_pushTransform
+ */
+void Render_popTransform();
+
+/**
+ * @brief Render_translate Move origin of current coordinates (translation is scaled)
+ * @param x
+ * @param y
+ */
+void Render_translate(GLfloat x, GLfloat y);
+
 /**
- * @brief Render_scale
+ * @brief Render_scale Multiply scale of current coordinates
  * @param x
  * @param y
  */
@@ -157,6 +368,15 @@ int Render_getStringWidthIndex(const char * str, int lastCharIndex);
  */
 int Render_getStringWidthRange(const char * str, int start, int end);
 
+/**
+ * @brief Render_layoutString Widths of all prefixes of string with default font
+ *        (any thread, each frame starts with it), width queries of layout
+ *        (Text_width, Text_index) are O(1)
+ * @param layout Layout initialized by Text_initLayout
+ * @param str
+ */
+void Render_layoutString(Text_Layout * layout, const char * str);
+
 /**
  * @brief Render_getStringHeight
  * @return
@@ -196,7 +416,8 @@ void Render_enablePtColor();
 void Render_disablePtColor();
 
 /**
- * @brief Render_applyOffset
+ * @brief Render_applyOffset Move origin by offset in window coordinates
+ *        (containers use Render_pushTransform and Render_translate)
  * @param x
  * @param y
  * @param z
@@ -204,27 +425,55 @@ void Render_disablePtColor();
 void Render_applyOffset(GLfloat x, GLfloat y, GLfloat z);
 
 /**
- * @brief Render_clearOffset
+ * @brief Render_clearOffset Move origin to upper-left corner of window
  */
 void Render_clearOffset();
 
 /**
- * @brief Render_setScissor
+ * @brief Render_pushClip Intersect clip rectangle with rectangle in current
+ *        coordinates (offset and scale are applied), Render_popClip
+ *        restores previous clip rectangle. Every push is matched by one pop,
+ *        push which can not be stored keeps clip of parent
  * @param x
  * @param y
  * @param width
- * @param heigh
- * @param evt
+ * @param height
+ * @return False -> intersection is empty, nothing drawn until pop is visible
  */
-void Render_setScissor(GLfloat x, GLfloat y, GLfloat width,
-                       GLfloat height, const Event_Render * evt);
+bool Render_pushClip(GLfloat x, GLfloat y, GLfloat width, GLfloat height);
 
 /**
- * @brief Render_resetScissor
+ * @brief Render_popClip Restore clip rectangle of previous Render_pushClip
+ */
+void Render_popClip();
+
+/**
+ * @brief Render_isClipped Is rectangle in current coordinates entirely outside
+ *        of clip rectangle? Containers skip rendering of such childs
+ * @param x
+ * @param y
+ * @param width
+ * @param height
+ * @return
+ */
+bool Render_isClipped(GLfloat x, GLfloat y, GLfloat width, GLfloat height);
+
+/**
+ * @brief Render_resetScissor Clear clip stack, clip to whole window or to base rectangle
  * @param evt
  */
 void Render_resetScissor(const Event_Render * evt);
 
+/**
+ * @brief Render_setBaseScissor Limit rendering of frame to rectangle (damaged
+ *        part of window), Render_resetScissor restores it instead of whole window
+ * @param x Window coordinates (y axis down)
+ * @param y
+ * @param width 0 -> whole window
+ * @param height 0 -> whole window
+ */
+void Render_setBaseScissor(int x, int y, int width, int height);
+
 /**
  * @brief Render_clear
  * @param evt
@@ -303,7 +552,8 @@ void Render_fillQuad(Point2D * p1, Point2D * p2, Point2D * p3, Point2D * p4);
 void Render_fillPolygon(Point2D * p, size_t count);
 
 /**
- * @brief Render_drawEllipse
+ * @brief Render_drawEllipse Segment count is chosen from radius in window
+ *        (RENDER_CIRCLE_MIN_SEGMENTS .. RENDER_CIRCLE_MAX_SEGMENTS)
  * @param p
  * @param rx
  * @param ry
@@ -349,10 +599,22 @@ void Render_setFont(void * font, GLint size);
 void Render_drawString(GLfloat x, GLfloat y,  const char * const str);
 
 /**
- * @brief Render_mesh
- * @param p
+ * @brief Render_buildMesh Triangulate faces (simple polygons) and record them into
+ *        geometry grouped by texture, faces without texture are drawn first.
+ *        Texture is stretched over bounding box of face
+ * @param mesh Initialized geometry, previous content is replaced
+ * @param faces List of <Face2D>, textureID is index in textures (-1 -> point colors)
+ * @param textures
+ * @param texture_count
+ */
+void Render_buildMesh(Render_Geometry * mesh, LinkedList * faces, Texture * const * textures, size_t texture_count);
+
+/**
+ * @brief Render_mesh Draw mesh built by Render_buildMesh
+ * @param p Position of mesh origin
+ * @param mesh
  */
-void Render_mesh(Point2D * p, LinkedList * faces);
+void Render_mesh(Point2D * p, Render_Geometry * mesh);
 
 
 #endif // RENDER_H
@@ -0,0 +1,548 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    rendergl.c
+ * @brief   Implementation of rendergl.h
+ * <------------------------------------------------------------------>
+ */
+
+#define GL_GLEXT_PROTOTYPES
+
+#include "rendergl.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+
+typedef enum {
+    Command_Draw,
+    Command_Clear,
+    Command_Scissor,
+    Command_Geometry
+} Command_Type;
+
+//recorded command, commands are executed in order by flush
+typedef struct {
+    Command_Type type;
+    //draw
+    GLenum mode;            /** GL_LINES or GL_TRIANGLES */
+    GLfloat line_width;     /** 0 for triangles */
+    GLuint texture;         /** 0 -> color only */
+    float bounds[4];        /** x0, y0, x1, y1 of all primitives */
+    Render_Vertex * vertices;   /** kept between frames */
+    size_t count;
+    size_t size;
+    //clear
+    Color color;
+    bool set_color;
+    //scissor (GL coordinates)
+    GLint rect[4];
+    //geometry
+    Render_Geometry * geometry;
+    GLfloat dx, dy;
+} Command;
+
+//static VBO of retained geometry
+typedef struct {
+    GLuint vbo;
+    unsigned int version;   /** version of geometry in VBO */
+} Geometry;
+
+
+static int WINDOW_WIDTH = 0;
+static int WINDOW_HEIGHT = 0;
+
+//shadow of GL state, calls which would not change it are skipped and counted
+static struct {
+    Color clear_color;
+    GLfloat line_width;
+    GLuint texture;
+    bool texturing;
+    bool blend;
+    GLint scissor[4];
+} STATE = {{0, 0, 0, 0}, 1.0, 0, false, false, {0, 0, 0, 0}};
+
+//scissor after all recorded commands, same scissor is not recorded again
+static GLint RECORDED_SCISSOR[4] = {0, 0, 0, 0};
+static bool RECORDED_SCISSOR_VALID = false;
+
+static Command * COMMANDS = NULL;
+static size_t COMMANDS_COUNT = 0;
+static size_t COMMANDS_SIZE = 0;
+
+//all vertices of frame, uploaded into VBO at once
+static Render_Vertex * UPLOAD = NULL;
+static size_t UPLOAD_SIZE = 0;
+static GLuint VBO = 0;
+static size_t VBO_SIZE = 0;
+
+static RenderGL_Stats STATS;
+static unsigned long PRIMITIVES = 0;
+static unsigned long REDUNDANT[RenderGL_StateCount];
+
+
+static bool sameColor(const Color * a, const Color * b) {
+    return a->red == b->red && a->green == b->green && a->blue == b->blue && a->alpha == b->alpha;
+}
+
+static void setClearColor(const Color * color) {
+    if(sameColor(&STATE.clear_color, color)) {
+        ++REDUNDANT[RenderGL_Color];
+        return;
+    }
+    glClearColor(color->red, color->green, color->blue, color->alpha);
+    STATE.clear_color = *color;
+}
+
+static void setLineWidth(GLfloat width) {
+    if(STATE.line_width == width) {
+        ++REDUNDANT[RenderGL_LineWidth];
+        return;
+    }
+    glLineWidth(width);
+    STATE.line_width = width;
+}
+
+static void bindTexture(GLuint texture) {
+    if(STATE.texture == texture) {
+        ++REDUNDANT[RenderGL_Texture];
+        return;
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+    STATE.texture = texture;
+}
+
+static void setTexturing(bool enabled) {
+    if(STATE.texturing == enabled) {
+        ++REDUNDANT[RenderGL_Texture];
+        return;
+    }
+    if(enabled) {
+        glEnable(GL_TEXTURE_2D);
+    } else {
+        glDisable(GL_TEXTURE_2D);
+    }
+    STATE.texturing = enabled;
+}
+
+static void setBlend(bool enabled) {
+    if(STATE.blend == enabled) {
+        ++REDUNDANT[RenderGL_Blend];
+        return;
+    }
+    if(enabled) {
+        glEnable(GL_BLEND);
+    } else {
+        glDisable(GL_BLEND);
+    }
+    STATE.blend = enabled;
+}
+
+static void setScissor(const GLint * rect) {
+    if(memcmp(STATE.scissor, rect, sizeof(STATE.scissor)) == 0) {
+        ++REDUNDANT[RenderGL_Scissor];
+        return;
+    }
+    glScissor(rect[0], rect[1], rect[2], rect[3]);
+    memcpy(STATE.scissor, rect, sizeof(STATE.scissor));
+}
+
+
+static bool reserve(void ** data, size_t * size, size_t count, size_t item) {
+    if(count <= *size) return true;
+
+    size_t new_size = MAX(count, *size * 2);
+    void * d = realloc(*data, new_size * item);
+    if(d == NULL) return false;
+    *data = d;
+    *size = new_size;
+    return true;
+}
+
+static Command * pushCommand(Command_Type type) {
+    if(COMMANDS_COUNT == COMMANDS_SIZE) {
+        size_t size = COMMANDS_SIZE;
+        if(!reserve((void**) &COMMANDS, &COMMANDS_SIZE, COMMANDS_COUNT + 1, sizeof(Command))) return NULL;
+        //vertex buffers of commands are reused by next frames
+        memset(COMMANDS + size, 0, (COMMANDS_SIZE - size) * sizeof(Command));
+    }
+    Command * c = &COMMANDS[COMMANDS_COUNT++];
+    c->type = type;
+    c->count = 0;
+    return c;
+}
+
+static bool overlaps(const float * a, const float * b) {
+    return a[0] <= b[2] && b[0] <= a[2] && a[1] <= b[3] && b[1] <= a[3];
+}
+
+/**
+ * @brief findBatch Recorded draw command with same state which primitive can join
+ *        without change of drawing order of overlapping primitives
+ */
+static Command * findBatch(GLenum mode, GLfloat line_width, GLuint texture, const float * bounds) {
+    for(size_t i = COMMANDS_COUNT, n = 0; i > 0 && n < RENDERGL_BATCH_LOOKBACK; --i, ++n) {
+        Command * c = &COMMANDS[i - 1];
+        if(c->type != Command_Draw) return NULL;
+        if(c->mode == mode && c->line_width == line_width && c->texture == texture) return c;
+        if(overlaps(c->bounds, bounds)) return NULL;
+    }
+    return NULL;
+}
+
+static void init() {
+    glEnable(GL_SCISSOR_TEST);
+    glDepthFunc(GL_NEVER);
+    glEnable(GL_MULTISAMPLE);
+    glHint(GL_MULTISAMPLE_FILTER_HINT_NV, GL_NICEST);
+    glEnable(GL_LINE_SMOOTH);
+    glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
+    glEnable(GL_POINT_SMOOTH);
+    glHint(GL_POINT_SMOOTH_HINT, GL_NICEST);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    STATE.blend = false;
+    setBlend(true);
+    //GL defaults
+    glGetIntegerv(GL_SCISSOR_BOX, STATE.scissor);
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, (GLfloat*) &STATE.clear_color);
+
+    glGenBuffers(1, &VBO);
+}
+
+static void viewport(int width, int height) {
+    if(WINDOW_WIDTH == width && WINDOW_HEIGHT == height) {
+        ++REDUNDANT[RenderGL_Transform];
+        return;
+    }
+    WINDOW_WIDTH = width;
+    WINDOW_HEIGHT = height;
+    glViewport(0, 0, width, height);        /* Establish viewing area to cover entire window. */
+    glMatrixMode(GL_PROJECTION);            /* Start modifying the projection matrix. */
+    glLoadIdentity();                       /* Reset project matrix. */
+    glOrtho(0, width, 0, height, -1, 1);    /* Map abstract coords directly to window coords. */
+    glScalef(1, -1, 1);                     /* Invert Y axis so increasing Y goes down. */
+    glTranslatef(0, -height, 0);            /* Shift origin up to upper-left corner. */
+}
+
+static void clear(const Color * color) {
+    Command * c = pushCommand(Command_Clear);
+    if(c == NULL) return;
+
+    c->set_color = color != NULL;
+    if(color != NULL) c->color = *color;
+}
+
+static void scissor(int x, int y, int width, int height) {
+    GLint rect[4] = {x, WINDOW_HEIGHT - y - height, width, height};
+    //scissor command breaks batching, skip it if it does not change anything
+    if(RECORDED_SCISSOR_VALID && memcmp(RECORDED_SCISSOR, rect, sizeof(rect)) == 0) {
+        ++REDUNDANT[RenderGL_Scissor];
+        return;
+    }
+
+    Command * c = pushCommand(Command_Scissor);
+    if(c == NULL) return;
+
+    memcpy(c->rect, rect, sizeof(rect));
+    memcpy(RECORDED_SCISSOR, rect, sizeof(rect));
+    RECORDED_SCISSOR_VALID = true;
+}
+
+/**
+ * @brief append Reserve vertices of primitives in batch with same state
+ * @return Place of n vertices in batch
+ */
+static Render_Vertex * append(GLenum mode, GLfloat line_width, GLuint texture, const float * bounds, size_t n) {
+    Command * c = findBatch(mode, line_width, texture, bounds);
+    if(c == NULL) {
+        c = pushCommand(Command_Draw);
+        if(c == NULL) return NULL;
+        c->mode = mode;
+        c->line_width = line_width;
+        c->texture = texture;
+        memcpy(c->bounds, bounds, sizeof(c->bounds));
+    } else {
+        c->bounds[0] = MIN(c->bounds[0], bounds[0]);
+        c->bounds[1] = MIN(c->bounds[1], bounds[1]);
+        c->bounds[2] = MAX(c->bounds[2], bounds[2]);
+        c->bounds[3] = MAX(c->bounds[3], bounds[3]);
+    }
+    if(!reserve((void**) &c->vertices, &c->size, c->count + n, sizeof(Render_Vertex))) return NULL;
+
+    Render_Vertex * v = c->vertices + c->count;
+    c->count += n;
+    return v;
+}
+
+/**
+ * @brief computeBounds Bounds of vertices with margin of line width and smoothed edge
+ */
+static void computeBounds(const Render_Vertex * vertices, size_t count, GLfloat line_width, float * bounds) {
+    float margin = line_width / 2.0 + 1.0;
+    bounds[0] = bounds[2] = vertices[0].x;
+    bounds[1] = bounds[3] = vertices[0].y;
+    for(size_t i = 1; i < count; ++i) {
+        bounds[0] = MIN(bounds[0], vertices[i].x);
+        bounds[1] = MIN(bounds[1], vertices[i].y);
+        bounds[2] = MAX(bounds[2], vertices[i].x);
+        bounds[3] = MAX(bounds[3], vertices[i].y);
+    }
+    bounds[0] -= margin;
+    bounds[1] -= margin;
+    bounds[2] += margin;
+    bounds[3] += margin;
+}
+
+static void draw(Render_Mode mode, const Render_Vertex * vertices, size_t count,
+                 GLfloat line_width, const Texture * texture) {
+    //lines and fans are converted into independent lines and triangles
+    size_t n = Render_listCount(mode, count);
+    if(n == 0) return;
+
+    bool lines = mode <= Render_LineLoop;
+    GLfloat width = lines ? line_width : 0.0;
+    float bounds[4];
+    computeBounds(vertices, count, width, bounds);
+
+    Render_Vertex * v = append(lines ? GL_LINES : GL_TRIANGLES, width,
+                               texture != NULL ? texture->textureID : 0, bounds, n);
+    if(v == NULL) return;
+
+    Render_toList(mode, vertices, count, v);
+    ++PRIMITIVES;
+}
+
+static void drawInstances(const Render_Geometry * unit, const Render_Instance * instances,
+                          size_t count, GLfloat scale_x, GLfloat scale_y) {
+    //instances are expanded into one batch for each batch of unit geometry
+    float bounds[4], b[4];
+    for(size_t i = 0; i < unit->batch_count; ++i) {
+        const Render_GeometryBatch * batch = &unit->batches[i];
+        if(batch->count == 0) continue;
+
+        //bounds of instances from bounds of unit batch
+        float unit_bounds[4];
+        computeBounds(unit->vertices + batch->first, batch->count, batch->line_width, unit_bounds);
+        for(size_t j = 0; j < count; ++j) {
+            const Render_Instance * inst = &instances[j];
+            GLfloat sx = inst->size * scale_x, sy = inst->size * scale_y;
+            b[0] = inst->x + (unit_bounds[0] - unit->offset_x) * sx;
+            b[1] = inst->y + (unit_bounds[1] - unit->offset_y) * sy;
+            b[2] = inst->x + (unit_bounds[2] - unit->offset_x) * sx;
+            b[3] = inst->y + (unit_bounds[3] - unit->offset_y) * sy;
+            if(j == 0) {
+                memcpy(bounds, b, sizeof(bounds));
+            }
+            bounds[0] = MIN(bounds[0], MIN(b[0], b[2]));
+            bounds[1] = MIN(bounds[1], MIN(b[1], b[3]));
+            bounds[2] = MAX(bounds[2], MAX(b[0], b[2]));
+            bounds[3] = MAX(bounds[3], MAX(b[1], b[3]));
+        }
+
+        Render_Vertex * v = append(batch->mode == Render_Lines ? GL_LINES : GL_TRIANGLES, batch->line_width,
+                                   batch->texture != NULL ? batch->texture->textureID : 0,
+                                   bounds, batch->count * count);
+        if(v == NULL) return;
+        for(size_t j = 0; j < count; ++j, v += batch->count) {
+            Render_instanceVertices(unit, batch, &instances[j], scale_x, scale_y, v);
+        }
+    }
+    ++PRIMITIVES;
+}
+
+static void drawGeometry(Render_Geometry * geometry, GLfloat dx, GLfloat dy) {
+    Geometry * g = geometry->backend;
+    if(g == NULL) {
+        g = calloc(1, sizeof(Geometry));
+        if(g == NULL) return;
+        glGenBuffers(1, &g->vbo);
+        g->version = geometry->version - 1;
+        geometry->backend = g;
+    }
+    //geometry is uploaded only after it was recorded again
+    if(g->version != geometry->version) {
+        glBindBuffer(GL_ARRAY_BUFFER, g->vbo);
+        glBufferData(GL_ARRAY_BUFFER, geometry->count * sizeof(Render_Vertex), geometry->vertices, GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        g->version = geometry->version;
+    }
+
+    Command * c = pushCommand(Command_Geometry);
+    if(c == NULL) return;
+
+    c->geometry = geometry;
+    c->dx = dx;
+    c->dy = dy;
+    ++PRIMITIVES;
+}
+
+static void releaseGeometry(void * data) {
+    Geometry * g = data;
+    glDeleteBuffers(1, &g->vbo);
+    free(g);
+}
+
+static void loadTexture(Texture * texture) {
+    //create one OpenGL texture
+    glGenTextures(1, &texture->textureID);
+    //"bind" the newly created texture : all future texture functions will modify this texture
+    bindTexture(texture->textureID);
+    //give the image to OpenGL
+    glTexImage2D(GL_TEXTURE_2D, 0, texture->rgba ? GL_RGBA : GL_RGB, texture->width,
+                 texture->height, 0, texture->rgba ? GL_BGRA : GL_BGR, GL_UNSIGNED_BYTE, texture->data);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+}
+
+static bool upload(size_t * total) {
+    *total = 0;
+    for(size_t i = 0; i < COMMANDS_COUNT; ++i) {
+        if(COMMANDS[i].type == Command_Draw) *total += COMMANDS[i].count;
+    }
+    if(*total == 0) return true;
+    if(!reserve((void**) &UPLOAD, &UPLOAD_SIZE, *total, sizeof(Render_Vertex))) return false;
+
+    //batches are placed one after another in order of commands
+    size_t first = 0;
+    for(size_t i = 0; i < COMMANDS_COUNT; ++i) {
+        Command * c = &COMMANDS[i];
+        if(c->type != Command_Draw) continue;
+        memcpy(UPLOAD + first, c->vertices, c->count * sizeof(Render_Vertex));
+        first += c->count;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    if(*total > VBO_SIZE) {
+        VBO_SIZE = MAX(*total, VBO_SIZE * 2);
+    }
+    //orphan storage of previous frame, driver does not wait until it is used
+    glBufferData(GL_ARRAY_BUFFER, VBO_SIZE * sizeof(Render_Vertex), NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, *total * sizeof(Render_Vertex), UPLOAD);
+    return true;
+}
+
+static void bindArrays(GLuint vbo) {
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glVertexPointer(2, GL_FLOAT, sizeof(Render_Vertex), (const void*) offsetof(Render_Vertex, x));
+    glTexCoordPointer(2, GL_FLOAT, sizeof(Render_Vertex), (const void*) offsetof(Render_Vertex, u));
+    glColorPointer(4, GL_FLOAT, sizeof(Render_Vertex), (const void*) offsetof(Render_Vertex, color));
+}
+
+static void drawArrays(GLenum mode, GLfloat line_width, GLuint texture, GLint first, size_t count) {
+    if(mode == GL_LINES) {
+        setLineWidth(line_width);
+    }
+    if(texture != 0) {
+        bindTexture(texture);
+        setTexturing(true);
+    } else if(STATE.texturing) {
+        setTexturing(false);
+    }
+    glDrawArrays(mode, first, count);
+    ++STATS.batches;
+    STATS.vertices += count;
+}
+
+static void drawGeometryCommand(const Command * c) {
+    const Render_Geometry * geometry = c->geometry;
+    const Geometry * g = geometry->backend;
+    bool move = c->dx != 0.0 || c->dy != 0.0;
+    if(move) {
+        glMatrixMode(GL_MODELVIEW);
+        glPushMatrix();
+        glTranslatef(c->dx, c->dy, 0.0);
+    } else {
+        ++REDUNDANT[RenderGL_Transform];
+    }
+
+    bindArrays(g->vbo);
+    for(size_t i = 0; i < geometry->batch_count; ++i) {
+        const Render_GeometryBatch * b = &geometry->batches[i];
+        drawArrays(b->mode == Render_Lines ? GL_LINES : GL_TRIANGLES, b->line_width,
+                   b->texture != NULL ? b->texture->textureID : 0, b->first, b->count);
+    }
+
+    if(move) {
+        glPopMatrix();
+        glMatrixMode(GL_PROJECTION);
+    }
+}
+
+static void flush() {
+    STATS.primitives = PRIMITIVES;
+    STATS.batches = 0;
+    STATS.vertices = 0;
+
+    size_t total = 0;
+    bool stream = VBO != 0 && upload(&total) && total > 0;
+    if(COMMANDS_COUNT > 0) {
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glEnableClientState(GL_COLOR_ARRAY);
+        if(stream) bindArrays(VBO);
+    }
+
+    setBlend(true);
+    Color color;
+    GLint first = 0;
+    for(size_t i = 0; i < COMMANDS_COUNT; ++i) {
+        Command * c = &COMMANDS[i];
+        switch(c->type) {
+        case Command_Draw:
+            if(!stream) break;
+            drawArrays(c->mode, c->line_width, c->texture, first, c->count);
+            first += c->count;
+            break;
+        case Command_Clear:
+            if(c->set_color) {
+                color = c->color;
+                color.alpha = 1.0;
+                setClearColor(&color);
+            }
+            glClear(GL_COLOR_BUFFER_BIT);
+            break;
+        case Command_Scissor:
+            setScissor(c->rect);
+            break;
+        case Command_Geometry:
+            drawGeometryCommand(c);
+            if(stream) bindArrays(VBO);
+            break;
+        }
+    }
+
+    if(COMMANDS_COUNT > 0) {
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glDisableClientState(GL_COLOR_ARRAY);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    memcpy(STATS.redundant, REDUNDANT, sizeof(REDUNDANT));
+    memset(REDUNDANT, 0, sizeof(REDUNDANT));
+
+    COMMANDS_COUNT = 0;
+    PRIMITIVES = 0;
+}
+
+const Render_Backend RENDERGL_BACKEND = {
+    .name = "gl",
+    .init = init,
+    .viewport = viewport,
+    .clear = clear,
+    .scissor = scissor,
+    .draw = draw,
+    .loadTexture = loadTexture,
+    .drawGeometry = drawGeometry,
+    .releaseGeometry = releaseGeometry,
+    .drawInstances = drawInstances,
+    .flush = flush
+};
+
+const RenderGL_Stats * RenderGL_getStats() {
+    return &STATS;
+}
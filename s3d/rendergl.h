@@ -0,0 +1,53 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    rendergl.h
+ * @brief   Legacy OpenGL render backend (fixed function). Primitives of
+ *          frame are recorded into batches of same state, vertices are
+ *          uploaded once per frame into streaming VBO by Render_flush.
+ *          GL state is shadowed and only changes are sent to driver
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef RENDERGL_H
+#define RENDERGL_H
+
+#include "render.h"
+
+
+//maximum number of recorded commands searched for batch with same state,
+//primitive can join earlier batch only if it does not overlap commands after it
+#define RENDERGL_BATCH_LOOKBACK 16
+
+//GL state shadowed by backend, state calls which would not change it are skipped
+typedef enum {
+    RenderGL_Color,     /** clear color */
+    RenderGL_LineWidth,
+    RenderGL_Texture,   /** bound texture and GL_TEXTURE_2D */
+    RenderGL_Blend,
+    RenderGL_Scissor,
+    RenderGL_Transform, /** viewport and projection */
+    RenderGL_StateCount
+} RenderGL_State;
+
+//statistics of last flushed frame
+typedef struct {
+    unsigned long primitives;   /** primitives drawn by Render_* functions */
+    unsigned long batches;      /** glDrawArrays calls */
+    unsigned long vertices;     /** vertices uploaded into VBO */
+    unsigned long redundant[RenderGL_StateCount];   /** skipped state calls */
+} RenderGL_Stats;
+
+
+extern const Render_Backend RENDERGL_BACKEND;
+
+/**
+ * @brief RenderGL_getStats
+ * @return Statistics of last flushed frame
+ */
+const RenderGL_Stats * RenderGL_getStats();
+
+#endif // RENDERGL_H
@@ -0,0 +1,774 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    rendergl33.c
+ * @brief   Implementation of rendergl33.h
+ * <------------------------------------------------------------------>
+ */
+
+#define GL_GLEXT_PROTOTYPES
+
+#include "rendergl33.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+
+
+//vertex attributes of shader program
+enum {
+    Attrib_Position,
+    Attrib_TexCoord,
+    Attrib_Color,
+    Attrib_Line,            /** direction, side, half width */
+    Attrib_Instance,        /** position, size */
+    Attrib_InstanceColor
+};
+
+//vertex of shader program, line is quad of two triangles
+typedef struct {
+    GLfloat x;
+    GLfloat y;
+    GLfloat u;
+    GLfloat v;
+    Color color;
+    GLfloat dir_x;          /** direction of line (0 for triangles) */
+    GLfloat dir_y;
+    GLfloat side;           /** -1 or 1, side of line */
+    GLfloat half_width;     /** 0 for triangles */
+} ShaderVertex;
+
+typedef enum {
+    Command_Draw,
+    Command_Clear,
+    Command_Scissor,
+    Command_Geometry,
+    Command_Instances
+} Command_Type;
+
+//recorded command, commands are executed in order by flush
+typedef struct {
+    Command_Type type;
+    //draw
+    GLuint texture;         /** 0 -> color only */
+    float bounds[4];        /** x0, y0, x1, y1 of all primitives */
+    ShaderVertex * vertices;    /** kept between frames */
+    size_t count;
+    size_t size;
+    //clear
+    Color color;
+    bool set_color;
+    //scissor (GL coordinates)
+    GLint rect[4];
+    //geometry, instances
+    const Render_Geometry * geometry;
+    GLfloat dx, dy;         /** translation, scale of instances */
+    size_t first;           /** first instance */
+} Command;
+
+//range of batch of geometry in VBO
+typedef struct {
+    GLint first;
+    GLsizei count;
+} Batch;
+
+//static VBO of retained geometry, lines are expanded into quads
+typedef struct {
+    GLuint vbo;
+    unsigned int version;   /** version of geometry in VBO */
+    Batch * batches;
+    size_t batch_size;
+} Geometry;
+
+
+static const char * VERTEX_SHADER =
+    "#version 330 core\n"
+    "layout(std140) uniform Transform {\n"
+    "    mat4 projection;\n"
+    "};\n"
+    "uniform vec2 offset;\n"
+    "uniform vec2 scale;\n"
+    "layout(location = 0) in vec2 position;\n"
+    "layout(location = 1) in vec2 texcoord;\n"
+    "layout(location = 2) in vec4 color;\n"
+    "layout(location = 3) in vec4 line;\n"
+    "layout(location = 4) in vec3 instance;\n"
+    "layout(location = 5) in vec4 instance_color;\n"
+    "out vec2 v_texcoord;\n"
+    "out vec4 v_color;\n"
+    "out float v_distance;\n"
+    "out float v_half_width;\n"
+    "void main() {\n"
+    "    vec2 s = instance.z * scale;\n"
+    "    vec2 p = instance.xy + (position + offset) * s;\n"
+    "    vec2 d = line.xy * s;\n"
+    "    v_distance = 0.0;\n"
+    "    if(line.w > 0.0 && dot(d, d) > 0.0) {\n"
+    "        v_distance = line.z * (line.w + 1.0);\n"
+    "        p += normalize(vec2(-d.y, d.x)) * v_distance;\n"
+    "    }\n"
+    "    v_half_width = line.w;\n"
+    "    v_texcoord = texcoord;\n"
+    "    v_color = color * instance_color;\n"
+    "    gl_Position = projection * vec4(p, 0.0, 1.0);\n"
+    "}\n";
+
+static const char * FRAGMENT_SHADER =
+    "#version 330 core\n"
+    "uniform sampler2D image;\n"
+    "uniform bool textured;\n"
+    "in vec2 v_texcoord;\n"
+    "in vec4 v_color;\n"
+    "in float v_distance;\n"
+    "in float v_half_width;\n"
+    "out vec4 fragment;\n"
+    "void main() {\n"
+    "    vec4 c = v_color;\n"
+    "    if(textured) c *= texture(image, v_texcoord);\n"
+    "    if(v_half_width > 0.0) c.a *= clamp(v_half_width + 0.5 - abs(v_distance), 0.0, 1.0);\n"
+    "    fragment = c;\n"
+    "}\n";
+
+
+static int WINDOW_WIDTH = 0;
+static int WINDOW_HEIGHT = 0;
+
+static GLuint PROGRAM = 0;
+static GLuint VAO = 0;
+static GLuint UBO = 0;
+static GLint UNIFORM_OFFSET = -1;
+static GLint UNIFORM_SCALE = -1;
+static GLint UNIFORM_TEXTURED = -1;
+
+//shadow of GL state, calls which would not change it are skipped and counted
+static struct {
+    Color clear_color;
+    GLuint texture;
+    bool texturing;
+    GLint scissor[4];
+    GLfloat offset[2];
+    GLfloat scale[2];
+} STATE = {{0, 0, 0, 0}, 0, false, {0, 0, 0, 0}, {0, 0}, {1, 1}};
+
+//scissor after all recorded commands, same scissor is not recorded again
+static GLint RECORDED_SCISSOR[4] = {0, 0, 0, 0};
+static bool RECORDED_SCISSOR_VALID = false;
+
+static Command * COMMANDS = NULL;
+static size_t COMMANDS_COUNT = 0;
+static size_t COMMANDS_SIZE = 0;
+
+//strips, loops and fans converted into lists
+static Render_Vertex * LIST = NULL;
+static size_t LIST_SIZE = 0;
+
+//all vertices of frame, uploaded into VBO at once
+static ShaderVertex * UPLOAD = NULL;
+static size_t UPLOAD_SIZE = 0;
+static GLuint VBO = 0;
+static size_t VBO_SIZE = 0;
+
+//all instances of frame
+static Render_Instance * INSTANCES = NULL;
+static size_t INSTANCES_COUNT = 0;
+static size_t INSTANCES_SIZE = 0;
+static GLuint INSTANCE_VBO = 0;
+static size_t INSTANCE_VBO_SIZE = 0;
+
+static RenderGL_Stats STATS;
+static unsigned long PRIMITIVES = 0;
+static unsigned long REDUNDANT[RenderGL_StateCount];
+
+
+static bool sameColor(const Color * a, const Color * b) {
+    return a->red == b->red && a->green == b->green && a->blue == b->blue && a->alpha == b->alpha;
+}
+
+static void setClearColor(const Color * color) {
+    if(sameColor(&STATE.clear_color, color)) {
+        ++REDUNDANT[RenderGL_Color];
+        return;
+    }
+    glClearColor(color->red, color->green, color->blue, color->alpha);
+    STATE.clear_color = *color;
+}
+
+static void bindTexture(GLuint texture) {
+    if(STATE.texture == texture) {
+        ++REDUNDANT[RenderGL_Texture];
+        return;
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+    STATE.texture = texture;
+}
+
+static void setTexturing(bool enabled) {
+    if(STATE.texturing == enabled) {
+        ++REDUNDANT[RenderGL_Texture];
+        return;
+    }
+    glUniform1i(UNIFORM_TEXTURED, enabled);
+    STATE.texturing = enabled;
+}
+
+static void setScissor(const GLint * rect) {
+    if(memcmp(STATE.scissor, rect, sizeof(STATE.scissor)) == 0) {
+        ++REDUNDANT[RenderGL_Scissor];
+        return;
+    }
+    glScissor(rect[0], rect[1], rect[2], rect[3]);
+    memcpy(STATE.scissor, rect, sizeof(STATE.scissor));
+}
+
+/**
+ * @brief setTransform Translation of vertices and scale of instances
+ */
+static void setTransform(GLfloat offset_x, GLfloat offset_y, GLfloat scale_x, GLfloat scale_y) {
+    if(STATE.offset[0] == offset_x && STATE.offset[1] == offset_y &&
+            STATE.scale[0] == scale_x && STATE.scale[1] == scale_y) {
+        ++REDUNDANT[RenderGL_Transform];
+        return;
+    }
+    glUniform2f(UNIFORM_OFFSET, offset_x, offset_y);
+    glUniform2f(UNIFORM_SCALE, scale_x, scale_y);
+    STATE.offset[0] = offset_x;
+    STATE.offset[1] = offset_y;
+    STATE.scale[0] = scale_x;
+    STATE.scale[1] = scale_y;
+}
+
+
+static bool reserve(void ** data, size_t * size, size_t count, size_t item) {
+    if(count <= *size) return true;
+
+    size_t new_size = MAX(count, *size * 2);
+    void * d = realloc(*data, new_size * item);
+    if(d == NULL) return false;
+    *data = d;
+    *size = new_size;
+    return true;
+}
+
+static Command * pushCommand(Command_Type type) {
+    if(COMMANDS_COUNT == COMMANDS_SIZE) {
+        size_t size = COMMANDS_SIZE;
+        if(!reserve((void**) &COMMANDS, &COMMANDS_SIZE, COMMANDS_COUNT + 1, sizeof(Command))) return NULL;
+        //vertex buffers of commands are reused by next frames
+        memset(COMMANDS + size, 0, (COMMANDS_SIZE - size) * sizeof(Command));
+    }
+    Command * c = &COMMANDS[COMMANDS_COUNT++];
+    c->type = type;
+    c->count = 0;
+    return c;
+}
+
+static bool overlaps(const float * a, const float * b) {
+    return a[0] <= b[2] && b[0] <= a[2] && a[1] <= b[3] && b[1] <= a[3];
+}
+
+/**
+ * @brief findBatch Recorded draw command with same texture which primitive can join
+ *        without change of drawing order of overlapping primitives
+ */
+static Command * findBatch(GLuint texture, const float * bounds) {
+    for(size_t i = COMMANDS_COUNT, n = 0; i > 0 && n < RENDERGL_BATCH_LOOKBACK; --i, ++n) {
+        Command * c = &COMMANDS[i - 1];
+        if(c->type != Command_Draw) return NULL;
+        if(c->texture == texture) return c;
+        if(overlaps(c->bounds, bounds)) return NULL;
+    }
+    return NULL;
+}
+
+/**
+ * @brief expandedCount Number of vertices of list after lines are expanded into quads
+ */
+static size_t expandedCount(Render_Mode mode, size_t count) {
+    return mode == Render_Lines ? count / 2 * 6 : count;
+}
+
+/**
+ * @brief expand Convert list of lines or triangles into vertices of shader program
+ * @param mode Render_Lines or Render_Triangles
+ * @param src
+ * @param count
+ * @param line_width
+ * @param dst expandedCount(mode, count) vertices
+ */
+static void expand(Render_Mode mode, const Render_Vertex * src, size_t count, GLfloat line_width, ShaderVertex * dst) {
+    if(mode != Render_Lines) {
+        for(size_t i = 0; i < count; ++i) {
+            dst[i] = (ShaderVertex){src[i].x, src[i].y, src[i].u, src[i].v, src[i].color, 0.0, 0.0, 0.0, 0.0};
+        }
+        return;
+    }
+
+    //quad of line: a-, a+, b- and b-, a+, b+
+    static const int END[6] = {0, 0, 1, 1, 0, 1};
+    static const GLfloat SIDE[6] = {-1.0, 1.0, -1.0, -1.0, 1.0, 1.0};
+    for(size_t i = 0; i + 1 < count; i += 2) {
+        GLfloat dx = src[i + 1].x - src[i].x;
+        GLfloat dy = src[i + 1].y - src[i].y;
+        for(int j = 0; j < 6; ++j) {
+            const Render_Vertex * s = &src[i + END[j]];
+            *dst++ = (ShaderVertex){s->x, s->y, s->u, s->v, s->color, dx, dy, SIDE[j], line_width / 2.0};
+        }
+    }
+}
+
+static GLuint compileShader(GLenum type, const char * source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint status;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if(!status) {
+        char log[512];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "rendergl33: shader compilation failed: %s\n", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+static GLuint createProgram() {
+    GLuint vs = compileShader(GL_VERTEX_SHADER, VERTEX_SHADER);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, FRAGMENT_SHADER);
+    GLuint program = 0;
+    if(vs != 0 && fs != 0) {
+        program = glCreateProgram();
+        glAttachShader(program, vs);
+        glAttachShader(program, fs);
+        glLinkProgram(program);
+
+        GLint status;
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if(!status) {
+            char log[512];
+            glGetProgramInfoLog(program, sizeof(log), NULL, log);
+            fprintf(stderr, "rendergl33: program linking failed: %s\n", log);
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+    if(vs != 0) glDeleteShader(vs);
+    if(fs != 0) glDeleteShader(fs);
+    return program;
+}
+
+static void init() {
+    PROGRAM = createProgram();
+    if(PROGRAM == 0) return;
+
+    glUseProgram(PROGRAM);
+    UNIFORM_OFFSET = glGetUniformLocation(PROGRAM, "offset");
+    UNIFORM_SCALE = glGetUniformLocation(PROGRAM, "scale");
+    UNIFORM_TEXTURED = glGetUniformLocation(PROGRAM, "textured");
+    glUniform1i(glGetUniformLocation(PROGRAM, "image"), 0);
+    glUniform2f(UNIFORM_OFFSET, STATE.offset[0], STATE.offset[1]);
+    glUniform2f(UNIFORM_SCALE, STATE.scale[0], STATE.scale[1]);
+    glUniform1i(UNIFORM_TEXTURED, STATE.texturing);
+
+    //projection in uniform buffer (binding point 0)
+    glGenBuffers(1, &UBO);
+    glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+    glBufferData(GL_UNIFORM_BUFFER, 16 * sizeof(GLfloat), NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, UBO);
+    glUniformBlockBinding(PROGRAM, glGetUniformBlockIndex(PROGRAM, "Transform"), 0);
+
+    //one VAO, buffers of attributes are switched by bindArrays
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+    glEnableVertexAttribArray(Attrib_Position);
+    glEnableVertexAttribArray(Attrib_TexCoord);
+    glEnableVertexAttribArray(Attrib_Color);
+    glEnableVertexAttribArray(Attrib_Line);
+    glVertexAttribDivisor(Attrib_Instance, 1);
+    glVertexAttribDivisor(Attrib_InstanceColor, 1);
+    //not instanced draws use constant instance
+    glVertexAttrib3f(Attrib_Instance, 0.0, 0.0, 1.0);
+    glVertexAttrib4f(Attrib_InstanceColor, 1.0, 1.0, 1.0, 1.0);
+
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &INSTANCE_VBO);
+
+    glEnable(GL_SCISSOR_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glActiveTexture(GL_TEXTURE0);
+    //GL defaults
+    glGetIntegerv(GL_SCISSOR_BOX, STATE.scissor);
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, (GLfloat*) &STATE.clear_color);
+}
+
+static void viewport(int width, int height) {
+    if(WINDOW_WIDTH == width && WINDOW_HEIGHT == height) {
+        ++REDUNDANT[RenderGL_Transform];
+        return;
+    }
+    WINDOW_WIDTH = width;
+    WINDOW_HEIGHT = height;
+    glViewport(0, 0, width, height);
+
+    //window coordinates (origin in upper-left corner, y axis down) -> clip space
+    GLfloat projection[16] = {
+        2.0 / width, 0.0, 0.0, 0.0,
+        0.0, -2.0 / height, 0.0, 0.0,
+        0.0, 0.0, -1.0, 0.0,
+        -1.0, 1.0, 0.0, 1.0
+    };
+    if(UBO != 0) {
+        glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(projection), projection);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+}
+
+static void clear(const Color * color) {
+    Command * c = pushCommand(Command_Clear);
+    if(c == NULL) return;
+
+    c->set_color = color != NULL;
+    if(color != NULL) c->color = *color;
+}
+
+static void scissor(int x, int y, int width, int height) {
+    GLint rect[4] = {x, WINDOW_HEIGHT - y - height, width, height};
+    //scissor command breaks batching, skip it if it does not change anything
+    if(RECORDED_SCISSOR_VALID && memcmp(RECORDED_SCISSOR, rect, sizeof(rect)) == 0) {
+        ++REDUNDANT[RenderGL_Scissor];
+        return;
+    }
+
+    Command * c = pushCommand(Command_Scissor);
+    if(c == NULL) return;
+
+    memcpy(c->rect, rect, sizeof(rect));
+    memcpy(RECORDED_SCISSOR, rect, sizeof(rect));
+    RECORDED_SCISSOR_VALID = true;
+}
+
+/**
+ * @brief append Reserve vertices of primitives in batch with same texture
+ * @return Place of n vertices in batch
+ */
+static ShaderVertex * append(GLuint texture, const float * bounds, size_t n) {
+    Command * c = findBatch(texture, bounds);
+    if(c == NULL) {
+        c = pushCommand(Command_Draw);
+        if(c == NULL) return NULL;
+        c->texture = texture;
+        memcpy(c->bounds, bounds, sizeof(c->bounds));
+    } else {
+        c->bounds[0] = MIN(c->bounds[0], bounds[0]);
+        c->bounds[1] = MIN(c->bounds[1], bounds[1]);
+        c->bounds[2] = MAX(c->bounds[2], bounds[2]);
+        c->bounds[3] = MAX(c->bounds[3], bounds[3]);
+    }
+    if(!reserve((void**) &c->vertices, &c->size, c->count + n, sizeof(ShaderVertex))) return NULL;
+
+    ShaderVertex * v = c->vertices + c->count;
+    c->count += n;
+    return v;
+}
+
+/**
+ * @brief computeBounds Bounds of vertices with margin of line width and smoothed edge
+ */
+static void computeBounds(const Render_Vertex * vertices, size_t count, GLfloat line_width, float * bounds) {
+    float margin = line_width / 2.0 + 1.0;
+    bounds[0] = bounds[2] = vertices[0].x;
+    bounds[1] = bounds[3] = vertices[0].y;
+    for(size_t i = 1; i < count; ++i) {
+        bounds[0] = MIN(bounds[0], vertices[i].x);
+        bounds[1] = MIN(bounds[1], vertices[i].y);
+        bounds[2] = MAX(bounds[2], vertices[i].x);
+        bounds[3] = MAX(bounds[3], vertices[i].y);
+    }
+    bounds[0] -= margin;
+    bounds[1] -= margin;
+    bounds[2] += margin;
+    bounds[3] += margin;
+}
+
+static void draw(Render_Mode mode, const Render_Vertex * vertices, size_t count,
+                 GLfloat line_width, const Texture * texture) {
+    size_t n = Render_listCount(mode, count);
+    if(n == 0) return;
+    if(!reserve((void**) &LIST, &LIST_SIZE, n, sizeof(Render_Vertex))) return;
+    mode = Render_toList(mode, vertices, count, LIST);
+
+    GLfloat width = mode == Render_Lines ? line_width : 0.0;
+    float bounds[4];
+    computeBounds(vertices, count, width, bounds);
+
+    ShaderVertex * v = append(texture != NULL ? texture->textureID : 0, bounds, expandedCount(mode, n));
+    if(v == NULL) return;
+
+    expand(mode, LIST, n, width, v);
+    ++PRIMITIVES;
+}
+
+/**
+ * @brief uploadGeometry Create VBO of geometry or upload it again after it was recorded
+ * @return Backend data of geometry
+ */
+static Geometry * uploadGeometry(Render_Geometry * geometry) {
+    Geometry * g = geometry->backend;
+    if(g == NULL) {
+        g = calloc(1, sizeof(Geometry));
+        if(g == NULL) return NULL;
+        glGenBuffers(1, &g->vbo);
+        g->version = geometry->version - 1;
+        geometry->backend = g;
+    }
+    if(g->version == geometry->version) return g;
+
+    //ranges of batches after lines are expanded
+    if(!reserve((void**) &g->batches, &g->batch_size, geometry->batch_count, sizeof(Batch))) return NULL;
+    size_t total = 0;
+    for(size_t i = 0; i < geometry->batch_count; ++i) {
+        const Render_GeometryBatch * b = &geometry->batches[i];
+        g->batches[i].first = total;
+        g->batches[i].count = expandedCount(b->mode, b->count);
+        total += g->batches[i].count;
+    }
+    if(!reserve((void**) &UPLOAD, &UPLOAD_SIZE, total, sizeof(ShaderVertex))) return NULL;
+    for(size_t i = 0; i < geometry->batch_count; ++i) {
+        const Render_GeometryBatch * b = &geometry->batches[i];
+        expand(b->mode, geometry->vertices + b->first, b->count, b->line_width, UPLOAD + g->batches[i].first);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, g->vbo);
+    glBufferData(GL_ARRAY_BUFFER, total * sizeof(ShaderVertex), UPLOAD, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    g->version = geometry->version;
+    return g;
+}
+
+static void drawGeometry(Render_Geometry * geometry, GLfloat dx, GLfloat dy) {
+    if(uploadGeometry(geometry) == NULL) return;
+
+    Command * c = pushCommand(Command_Geometry);
+    if(c == NULL) return;
+
+    c->geometry = geometry;
+    c->dx = dx;
+    c->dy = dy;
+    ++PRIMITIVES;
+}
+
+static void drawInstances(const Render_Geometry * unit, const Render_Instance * instances,
+                          size_t count, GLfloat scale_x, GLfloat scale_y) {
+    //backend data of unit geometry are created by first draw
+    if(uploadGeometry((Render_Geometry*) unit) == NULL) return;
+    if(!reserve((void**) &INSTANCES, &INSTANCES_SIZE, INSTANCES_COUNT + count, sizeof(Render_Instance))) return;
+
+    Command * c = pushCommand(Command_Instances);
+    if(c == NULL) return;
+
+    memcpy(INSTANCES + INSTANCES_COUNT, instances, count * sizeof(Render_Instance));
+    c->geometry = unit;
+    c->first = INSTANCES_COUNT;
+    c->count = count;
+    c->dx = scale_x;
+    c->dy = scale_y;
+    INSTANCES_COUNT += count;
+    ++PRIMITIVES;
+}
+
+static void releaseGeometry(void * data) {
+    Geometry * g = data;
+    glDeleteBuffers(1, &g->vbo);
+    free(g->batches);
+    free(g);
+}
+
+static void loadTexture(Texture * texture) {
+    glGenTextures(1, &texture->textureID);
+    bindTexture(texture->textureID);
+    glTexImage2D(GL_TEXTURE_2D, 0, texture->rgba ? GL_RGBA : GL_RGB, texture->width,
+                 texture->height, 0, texture->rgba ? GL_BGRA : GL_BGR, GL_UNSIGNED_BYTE, texture->data);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+}
+
+static bool upload(size_t * total) {
+    *total = 0;
+    for(size_t i = 0; i < COMMANDS_COUNT; ++i) {
+        if(COMMANDS[i].type == Command_Draw) *total += COMMANDS[i].count;
+    }
+    if(*total == 0) return true;
+    if(!reserve((void**) &UPLOAD, &UPLOAD_SIZE, *total, sizeof(ShaderVertex))) return false;
+
+    //batches are placed one after another in order of commands
+    size_t first = 0;
+    for(size_t i = 0; i < COMMANDS_COUNT; ++i) {
+        Command * c = &COMMANDS[i];
+        if(c->type != Command_Draw) continue;
+        memcpy(UPLOAD + first, c->vertices, c->count * sizeof(ShaderVertex));
+        first += c->count;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    if(*total > VBO_SIZE) {
+        VBO_SIZE = MAX(*total, VBO_SIZE * 2);
+    }
+    //orphan storage of previous frame, driver does not wait until it is used
+    glBufferData(GL_ARRAY_BUFFER, VBO_SIZE * sizeof(ShaderVertex), NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, *total * sizeof(ShaderVertex), UPLOAD);
+    return true;
+}
+
+static void uploadInstances() {
+    if(INSTANCES_COUNT == 0) return;
+
+    glBindBuffer(GL_ARRAY_BUFFER, INSTANCE_VBO);
+    if(INSTANCES_COUNT > INSTANCE_VBO_SIZE) {
+        INSTANCE_VBO_SIZE = MAX(INSTANCES_COUNT, INSTANCE_VBO_SIZE * 2);
+    }
+    glBufferData(GL_ARRAY_BUFFER, INSTANCE_VBO_SIZE * sizeof(Render_Instance), NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, INSTANCES_COUNT * sizeof(Render_Instance), INSTANCES);
+}
+
+static void bindArrays(GLuint vbo) {
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glVertexAttribPointer(Attrib_Position, 2, GL_FLOAT, GL_FALSE, sizeof(ShaderVertex), (const void*) offsetof(ShaderVertex, x));
+    glVertexAttribPointer(Attrib_TexCoord, 2, GL_FLOAT, GL_FALSE, sizeof(ShaderVertex), (const void*) offsetof(ShaderVertex, u));
+    glVertexAttribPointer(Attrib_Color, 4, GL_FLOAT, GL_FALSE, sizeof(ShaderVertex), (const void*) offsetof(ShaderVertex, color));
+    glVertexAttribPointer(Attrib_Line, 4, GL_FLOAT, GL_FALSE, sizeof(ShaderVertex), (const void*) offsetof(ShaderVertex, dir_x));
+}
+
+static void bindInstances(size_t first) {
+    const size_t offset = first * sizeof(Render_Instance);
+    glBindBuffer(GL_ARRAY_BUFFER, INSTANCE_VBO);
+    glVertexAttribPointer(Attrib_Instance, 3, GL_FLOAT, GL_FALSE, sizeof(Render_Instance),
+                          (const void*) (offset + offsetof(Render_Instance, x)));
+    glVertexAttribPointer(Attrib_InstanceColor, 4, GL_FLOAT, GL_FALSE, sizeof(Render_Instance),
+                          (const void*) (offset + offsetof(Render_Instance, color)));
+    glEnableVertexAttribArray(Attrib_Instance);
+    glEnableVertexAttribArray(Attrib_InstanceColor);
+}
+
+static void setTexture(GLuint texture) {
+    if(texture != 0) {
+        bindTexture(texture);
+        setTexturing(true);
+    } else if(STATE.texturing) {
+        setTexturing(false);
+    }
+}
+
+static void drawGeometryCommand(const Command * c) {
+    const Render_Geometry * geometry = c->geometry;
+    const Geometry * g = geometry->backend;
+    bool instanced = c->type == Command_Instances;
+    if(instanced) {
+        setTransform(-geometry->offset_x, -geometry->offset_y, c->dx, c->dy);
+        bindInstances(c->first);
+    } else {
+        setTransform(c->dx, c->dy, 1.0, 1.0);
+    }
+
+    bindArrays(g->vbo);
+    for(size_t i = 0; i < geometry->batch_count; ++i) {
+        const Render_GeometryBatch * b = &geometry->batches[i];
+        if(g->batches[i].count == 0) continue;
+        setTexture(b->texture != NULL ? b->texture->textureID : 0);
+        if(instanced) {
+            glDrawArraysInstanced(GL_TRIANGLES, g->batches[i].first, g->batches[i].count, c->count);
+            STATS.vertices += g->batches[i].count * c->count;
+        } else {
+            glDrawArrays(GL_TRIANGLES, g->batches[i].first, g->batches[i].count);
+            STATS.vertices += g->batches[i].count;
+        }
+        ++STATS.batches;
+    }
+
+    if(instanced) {
+        glDisableVertexAttribArray(Attrib_Instance);
+        glDisableVertexAttribArray(Attrib_InstanceColor);
+        //current values are undefined after draw with enabled arrays
+        glVertexAttrib3f(Attrib_Instance, 0.0, 0.0, 1.0);
+        glVertexAttrib4f(Attrib_InstanceColor, 1.0, 1.0, 1.0, 1.0);
+    }
+}
+
+static void flush() {
+    STATS.primitives = PRIMITIVES;
+    STATS.batches = 0;
+    STATS.vertices = 0;
+
+    size_t total = 0;
+    bool stream = PROGRAM != 0 && upload(&total) && total > 0;
+    if(PROGRAM != 0) uploadInstances();
+    if(stream) bindArrays(VBO);
+
+    Color color;
+    GLint first = 0;
+    for(size_t i = 0; i < COMMANDS_COUNT; ++i) {
+        Command * c = &COMMANDS[i];
+        switch(c->type) {
+        case Command_Draw:
+            if(!stream) break;
+            setTransform(0.0, 0.0, 1.0, 1.0);
+            setTexture(c->texture);
+            glDrawArrays(GL_TRIANGLES, first, c->count);
+            ++STATS.batches;
+            STATS.vertices += c->count;
+            first += c->count;
+            break;
+        case Command_Clear:
+            if(c->set_color) {
+                color = c->color;
+                color.alpha = 1.0;
+                setClearColor(&color);
+            }
+            glClear(GL_COLOR_BUFFER_BIT);
+            break;
+        case Command_Scissor:
+            setScissor(c->rect);
+            break;
+        case Command_Geometry:
+        case Command_Instances:
+            if(PROGRAM == 0) break;
+            drawGeometryCommand(c);
+            if(stream) bindArrays(VBO);
+            break;
+        }
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    memcpy(STATS.redundant, REDUNDANT, sizeof(REDUNDANT));
+    memset(REDUNDANT, 0, sizeof(REDUNDANT));
+
+    COMMANDS_COUNT = 0;
+    INSTANCES_COUNT = 0;
+    PRIMITIVES = 0;
+}
+
+const Render_Backend RENDERGL33_BACKEND = {
+    .name = "gl33",
+    .gl_version = 33,
+    .init = init,
+    .viewport = viewport,
+    .clear = clear,
+    .scissor = scissor,
+    .draw = draw,
+    .loadTexture = loadTexture,
+    .drawGeometry = drawGeometry,
+    .releaseGeometry = releaseGeometry,
+    .drawInstances = drawInstances,
+    .flush = flush
+};
+
+const RenderGL_Stats * RenderGL33_getStats() {
+    return &STATS;
+}
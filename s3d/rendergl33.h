@@ -0,0 +1,31 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    rendergl33.h
+ * @brief   OpenGL 3.3 core profile render backend. Vertices of frame are
+ *          streamed into one VBO and drawn by shader program, projection
+ *          is in uniform buffer. Lines are expanded into quads smoothed
+ *          by fragment shader, so lines and triangles share batches.
+ *          Instances of unit geometry are drawn by one instanced call
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef RENDERGL33_H
+#define RENDERGL33_H
+
+#include "render.h"
+#include "rendergl.h"
+
+
+extern const Render_Backend RENDERGL33_BACKEND;
+
+/**
+ * @brief RenderGL33_getStats
+ * @return Statistics of last flushed frame (redundant[RenderGL_LineWidth] is unused)
+ */
+const RenderGL_Stats * RenderGL33_getStats();
+
+#endif // RENDERGL33_H
@@ -0,0 +1,514 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    rendersoft.c
+ * @brief   Implementation of rendersoft.h
+ *
+ *          Convex polygons are scan converted row by row (pixel centers,
+ *          right and bottom edges excluded). Spans of constant color are
+ *          filled by SSE2 four pixels at once, primitives with texture or
+ *          with different vertex colors interpolate attributes per pixel.
+ *          Blending is same as glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA)
+ * <------------------------------------------------------------------>
+ */
+
+#include "rendersoft.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+//linear function of vertex attribute over triangle
+typedef struct {
+    float value;    /** value at first vertex */
+    float dx;
+    float dy;
+} Gradient;
+
+//texture data prepared for sampling
+typedef struct {
+    const unsigned char * data;
+    int width;
+    int height;
+    bool rgba;
+    size_t bpp;     /** bytes per texel */
+    size_t stride;  /** bytes per row */
+    size_t size;
+} Sampler;
+
+enum {
+    ATTR_RED, ATTR_GREEN, ATTR_BLUE, ATTR_ALPHA, ATTR_U, ATTR_V, ATTR_COUNT
+};
+
+
+static RenderSoft_Framebuffer FB = {0, 0, NULL};
+
+//moved vertices of retained geometry and instances
+static Render_Vertex * MOVED = NULL;
+static size_t MOVED_SIZE = 0;
+
+//scissor [x0, y0, x1, y1) limited by framebuffer
+static int CLIP[4] = {0, 0, 0, 0};
+
+static uint32_t CLEAR_COLOR = 0xFF000000;
+
+
+static inline uint32_t div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+static inline uint32_t channel(GLfloat c) {
+    return c <= 0.0 ? 0 : c >= 1.0 ? 255 : (uint32_t)(c * 255.0 + 0.5);
+}
+
+static inline uint32_t pack(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    return channel(alpha) << 24 | channel(red) << 16 | channel(green) << 8 | channel(blue);
+}
+
+static inline uint32_t blend(uint32_t dst, uint32_t src) {
+    uint32_t a = src >> 24;
+    if(a == 255) return src;
+    if(a == 0) return dst;
+
+    uint32_t out = 0;
+    for(int shift = 0; shift < 32; shift += 8) {
+        uint32_t s = (src >> shift) & 0xFF;
+        uint32_t d = (dst >> shift) & 0xFF;
+        out |= div255(s * a + d * (255 - a)) << shift;
+    }
+    return out;
+}
+
+//first pixel whose center is right of (below) coordinate
+static inline int pixel(float x) {
+    return MAX(MIN(ceilf(x - 0.5f), 1 << 24), -(1 << 24));
+}
+
+static void fillSpan(uint32_t * dst, int count, uint32_t color) {
+    uint32_t a = color >> 24;
+    if(a == 0) return;
+
+    int i = 0;
+#ifdef __SSE2__
+    if(a == 255) {
+        __m128i c = _mm_set1_epi32(color);
+        for(; i + 4 <= count; i += 4) {
+            _mm_storeu_si128((__m128i*)(dst + i), c);
+        }
+    } else {
+        //16 bit lanes: dst * (255 - a) + src * a, divided by 255 with rounding
+        __m128i zero = _mm_setzero_si128();
+        __m128i src = _mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32(color), zero), _mm_set1_epi16(a));
+        __m128i inv = _mm_set1_epi16(255 - a);
+        __m128i round = _mm_set1_epi16(128);
+        for(; i + 4 <= count; i += 4) {
+            __m128i d = _mm_loadu_si128((__m128i*)(dst + i));
+            __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv), src);
+            __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv), src);
+            lo = _mm_add_epi16(lo, round);
+            hi = _mm_add_epi16(hi, round);
+            lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+            hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+        }
+    }
+#endif
+    for(; i < count; ++i) {
+        dst[i] = blend(dst[i], color);
+    }
+}
+
+/**
+ * @brief polygonSpan Span of convex polygon in row
+ * @param v
+ * @param count
+ * @param y Center of row
+ * @param x0 Left end
+ * @param x1 Right end
+ * @return False if row does not intersect polygon
+ */
+static bool polygonSpan(const Render_Vertex * v, size_t count, float y, float * x0, float * x1) {
+    bool found = false;
+    for(size_t i = 0; i < count; ++i) {
+        const Render_Vertex * a = v + i;
+        const Render_Vertex * b = v + (i + 1) % count;
+        //same direction for shared edges of adjacent polygons
+        if(a->y > b->y) {
+            const Render_Vertex * t = a;
+            a = b;
+            b = t;
+        }
+        if(y < a->y || y >= b->y) continue;
+
+        float x = a->x + (y - a->y) * (b->x - a->x) / (b->y - a->y);
+        if(!found) {
+            *x0 = *x1 = x;
+            found = true;
+        } else {
+            *x0 = MIN(*x0, x);
+            *x1 = MAX(*x1, x);
+        }
+    }
+    return found;
+}
+
+static void rows(const Render_Vertex * v, size_t count, int * y0, int * y1) {
+    float min = v[0].y;
+    float max = v[0].y;
+    for(size_t i = 1; i < count; ++i) {
+        min = MIN(min, v[i].y);
+        max = MAX(max, v[i].y);
+    }
+    *y0 = MAX(pixel(min), CLIP[1]);
+    *y1 = MIN(pixel(max), CLIP[3]);
+}
+
+static void fillConvex(const Render_Vertex * v, size_t count, uint32_t color) {
+    int y0, y1;
+    rows(v, count, &y0, &y1);
+
+    float x0 = 0.0f, x1 = 0.0f;
+    for(int y = y0; y < y1; ++y) {
+        if(!polygonSpan(v, count, y + 0.5f, &x0, &x1)) continue;
+        int sx0 = MAX(pixel(x0), CLIP[0]);
+        int sx1 = MIN(pixel(x1), CLIP[2]);
+        if(sx0 < sx1) {
+            fillSpan(FB.pixels + (size_t) y * FB.width + sx0, sx1 - sx0, color);
+        }
+    }
+}
+
+static void initSampler(Sampler * sampler, const Texture * texture) {
+    sampler->data = texture->data;
+    sampler->width = texture->width;
+    sampler->height = texture->height;
+    sampler->rgba = texture->rgba;
+    sampler->bpp = texture->rgba ? 4 : 3;
+    //rows of BMP are aligned to 4 B (same as default GL_UNPACK_ALIGNMENT)
+    sampler->stride = (texture->width * sampler->bpp + 3) & ~(size_t) 3;
+    sampler->size = texture->imageSize;
+}
+
+//nearest texel (GL_NEAREST), row 0 of texture data is v = 0
+static inline uint32_t texel(const Sampler * sampler, float u, float v) {
+    if(sampler->data == NULL) return 0xFFFFFFFF;
+
+    int x = MAX(MIN((int)(u * sampler->width), sampler->width - 1), 0);
+    int y = MAX(MIN((int)(v * sampler->height), sampler->height - 1), 0);
+    size_t index = y * sampler->stride + x * sampler->bpp;
+    if(index + sampler->bpp > sampler->size) return 0xFFFFFFFF;
+
+    const unsigned char * p = sampler->data + index;
+    return (uint32_t)(sampler->rgba ? p[3] : 255) << 24 | (uint32_t) p[2] << 16 | (uint32_t) p[1] << 8 | p[0];
+}
+
+//texel * color (GL_MODULATE)
+static inline uint32_t modulate(uint32_t texel, uint32_t color) {
+    if(color == 0xFFFFFFFF) return texel;
+
+    uint32_t out = 0;
+    for(int shift = 0; shift < 32; shift += 8) {
+        out |= div255(((texel >> shift) & 0xFF) * ((color >> shift) & 0xFF)) << shift;
+    }
+    return out;
+}
+
+static float attribute(const Render_Vertex * v, int attr) {
+    switch(attr) {
+    case ATTR_RED: return v->color.red;
+    case ATTR_GREEN: return v->color.green;
+    case ATTR_BLUE: return v->color.blue;
+    case ATTR_ALPHA: return v->color.alpha;
+    case ATTR_U: return v->u;
+    default: return v->v;
+    }
+}
+
+static bool sameColor(const Color * a, const Color * b) {
+    return a->red == b->red && a->green == b->green && a->blue == b->blue && a->alpha == b->alpha;
+}
+
+static void fillTriangle(const Render_Vertex * a, const Render_Vertex * b,
+                         const Render_Vertex * c, const Texture * texture) {
+    float area = (b->x - a->x) * (c->y - a->y) - (c->x - a->x) * (b->y - a->y);
+    if(fabsf(area) < 1e-6f) return;
+
+    //interpolated attributes: color (if vertex colors differ), texture coordinates
+    bool flat = sameColor(&a->color, &b->color) && sameColor(&a->color, &c->color);
+    int first = flat ? ATTR_U : ATTR_RED;
+    int last = texture != NULL ? ATTR_COUNT : ATTR_U;
+
+    Gradient g[ATTR_COUNT];
+    for(int i = first; i < last; ++i) {
+        float fa = attribute(a, i);
+        float fb = attribute(b, i) - fa;
+        float fc = attribute(c, i) - fa;
+        g[i].value = fa;
+        g[i].dx = (fb * (c->y - a->y) - fc * (b->y - a->y)) / area;
+        g[i].dy = (fc * (b->x - a->x) - fb * (c->x - a->x)) / area;
+    }
+
+    Sampler sampler = {NULL, 0, 0, false, 0, 0, 0};
+    if(texture != NULL) {
+        initSampler(&sampler, texture);
+    }
+
+    const Render_Vertex v[3] = {*a, *b, *c};
+    int y0, y1;
+    rows(v, 3, &y0, &y1);
+
+    uint32_t color = pack(a->color.red, a->color.green, a->color.blue, a->color.alpha);
+    float x0 = 0.0f, x1 = 0.0f;
+    float f[ATTR_COUNT];
+    for(int y = y0; y < y1; ++y) {
+        if(!polygonSpan(v, 3, y + 0.5f, &x0, &x1)) continue;
+        int sx0 = MAX(pixel(x0), CLIP[0]);
+        int sx1 = MIN(pixel(x1), CLIP[2]);
+        if(sx0 >= sx1) continue;
+
+        for(int i = first; i < last; ++i) {
+            f[i] = g[i].value + (sx0 + 0.5f - a->x) * g[i].dx + (y + 0.5f - a->y) * g[i].dy;
+        }
+        uint32_t * dst = FB.pixels + (size_t) y * FB.width;
+        for(int x = sx0; x < sx1; ++x) {
+            if(!flat) {
+                color = pack(f[ATTR_RED], f[ATTR_GREEN], f[ATTR_BLUE], f[ATTR_ALPHA]);
+            }
+            uint32_t src = texture != NULL ? modulate(texel(&sampler, f[ATTR_U], f[ATTR_V]), color) : color;
+            dst[x] = blend(dst[x], src);
+            for(int i = first; i < last; ++i) {
+                f[i] += g[i].dx;
+            }
+        }
+    }
+}
+
+static void fillPolygon(const Render_Vertex * v, size_t count, const Texture * texture) {
+    if(count < 3) return;
+
+    bool flat = texture == NULL;
+    for(size_t i = 1; i < count && flat; ++i) {
+        flat = sameColor(&v[0].color, &v[i].color);
+    }
+
+    if(flat) {
+        fillConvex(v, count, pack(v->color.red, v->color.green, v->color.blue, v->color.alpha));
+    } else {
+        for(size_t i = 1; i + 1 < count; ++i) {
+            fillTriangle(v, v + i, v + i + 1, texture);
+        }
+    }
+}
+
+static void drawLine(const Render_Vertex * a, const Render_Vertex * b, GLfloat width) {
+    float dx = b->x - a->x;
+    float dy = b->y - a->y;
+    float length = sqrtf(dx * dx + dy * dy);
+    if(length <= 0.0f) return;
+
+    //line is quad of line width around segment
+    float w = MAX(width, 1.0f) * 0.5f;
+    float nx = -dy / length * w;
+    float ny = dx / length * w;
+    Render_Vertex quad[4] = {*a, *b, *b, *a};
+    quad[0].x += nx;
+    quad[0].y += ny;
+    quad[1].x += nx;
+    quad[1].y += ny;
+    quad[2].x -= nx;
+    quad[2].y -= ny;
+    quad[3].x -= nx;
+    quad[3].y -= ny;
+    fillPolygon(quad, 4, NULL);
+}
+
+static void init() {
+}
+
+static void viewport(int width, int height) {
+    width = MAX(width, 0);
+    height = MAX(height, 0);
+    if(width != FB.width || height != FB.height) {
+        uint32_t * pixels = NULL;
+        if(width > 0 && height > 0) {
+            pixels = realloc(FB.pixels, sizeof(uint32_t) * width * height);
+            if(pixels == NULL) return;
+        } else {
+            free(FB.pixels);
+        }
+        FB.pixels = pixels;
+        FB.width = width;
+        FB.height = height;
+    }
+
+    CLIP[0] = CLIP[1] = 0;
+    CLIP[2] = FB.width;
+    CLIP[3] = FB.height;
+    for(int y = 0; y < FB.height; ++y) {
+        fillSpan(FB.pixels + (size_t) y * FB.width, FB.width, CLEAR_COLOR);
+    }
+}
+
+static void clear(const Color * color) {
+    if(color != NULL) {
+        CLEAR_COLOR = pack(color->red, color->green, color->blue, 1.0);
+    }
+    //glClear is limited by scissor
+    for(int y = CLIP[1]; y < CLIP[3]; ++y) {
+        fillSpan(FB.pixels + (size_t) y * FB.width + CLIP[0], CLIP[2] - CLIP[0], CLEAR_COLOR);
+    }
+}
+
+static void scissor(int x, int y, int width, int height) {
+    CLIP[0] = MAX(x, 0);
+    CLIP[1] = MAX(y, 0);
+    CLIP[2] = MAX(MIN(x + width, FB.width), CLIP[0]);
+    CLIP[3] = MAX(MIN(y + height, FB.height), CLIP[1]);
+}
+
+static void draw(Render_Mode mode, const Render_Vertex * vertices, size_t count,
+                 GLfloat line_width, const Texture * texture) {
+    if(FB.pixels == NULL) return;
+
+    size_t i;
+    switch(mode) {
+    case Render_Lines:
+        for(i = 0; i + 1 < count; i += 2) {
+            drawLine(vertices + i, vertices + i + 1, line_width);
+        }
+        break;
+    case Render_LineStrip:
+    case Render_LineLoop:
+        for(i = 0; i + 1 < count; ++i) {
+            drawLine(vertices + i, vertices + i + 1, line_width);
+        }
+        if(mode == Render_LineLoop && count > 2) {
+            drawLine(vertices + count - 1, vertices, line_width);
+        }
+        break;
+    case Render_Triangles:
+        for(i = 0; i + 2 < count; i += 3) {
+            fillPolygon(vertices + i, 3, texture);
+        }
+        break;
+    case Render_TriangleFan:
+        fillPolygon(vertices, count, texture);
+        break;
+    }
+}
+
+static void drawGeometry(Render_Geometry * geometry, GLfloat dx, GLfloat dy) {
+    for(size_t i = 0; i < geometry->batch_count; ++i) {
+        const Render_GeometryBatch * b = &geometry->batches[i];
+        const Render_Vertex * v = geometry->vertices + b->first;
+        if(dx != 0.0 || dy != 0.0) {
+            if(b->count > MOVED_SIZE) {
+                Render_Vertex * m = realloc(MOVED, b->count * sizeof(Render_Vertex));
+                if(m == NULL) return;
+                MOVED = m;
+                MOVED_SIZE = b->count;
+            }
+            for(size_t j = 0; j < b->count; ++j) {
+                MOVED[j] = v[j];
+                MOVED[j].x += dx;
+                MOVED[j].y += dy;
+            }
+            v = MOVED;
+        }
+        draw(b->mode, v, b->count, b->line_width, b->texture);
+    }
+}
+
+static void drawInstances(const Render_Geometry * unit, const Render_Instance * instances,
+                          size_t count, GLfloat scale_x, GLfloat scale_y) {
+    for(size_t i = 0; i < unit->batch_count; ++i) {
+        const Render_GeometryBatch * b = &unit->batches[i];
+        if(b->count > MOVED_SIZE) {
+            Render_Vertex * m = realloc(MOVED, b->count * sizeof(Render_Vertex));
+            if(m == NULL) return;
+            MOVED = m;
+            MOVED_SIZE = b->count;
+        }
+        for(size_t j = 0; j < count; ++j) {
+            Render_instanceVertices(unit, b, &instances[j], scale_x, scale_y, MOVED);
+            draw(b->mode, MOVED, b->count, b->line_width, b->texture);
+        }
+    }
+}
+
+static void releaseGeometry(void * data) {
+    (void) data;
+    //vertices are drawn directly from geometry, no data are created
+}
+
+static void loadTexture(Texture * texture) {
+    //texture is sampled from its data
+    texture->textureID = 0;
+}
+
+static void flush() {
+}
+
+const Render_Backend RENDERSOFT_BACKEND = {
+    .name = "soft",
+    .init = init,
+    .viewport = viewport,
+    .clear = clear,
+    .scissor = scissor,
+    .draw = draw,
+    .loadTexture = loadTexture,
+    .drawGeometry = drawGeometry,
+    .releaseGeometry = releaseGeometry,
+    .drawInstances = drawInstances,
+    .flush = flush
+};
+
+const RenderSoft_Framebuffer * RenderSoft_framebuffer() {
+    return &FB;
+}
+
+bool RenderSoft_writePPM(const char * path) {
+    if(FB.pixels == NULL) return false;
+
+    FILE * file = fopen(path, "wb");
+    if(file == NULL) return false;
+
+    unsigned char * row = malloc(FB.width * 3);
+    if(row == NULL) {
+        fclose(file);
+        return false;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", FB.width, FB.height);
+    for(int y = 0; y < FB.height; ++y) {
+        const uint32_t * src = FB.pixels + (size_t) y * FB.width;
+        for(int x = 0; x < FB.width; ++x) {
+            row[x * 3] = src[x] >> 16;
+            row[x * 3 + 1] = src[x] >> 8;
+            row[x * 3 + 2] = src[x];
+        }
+        fwrite(row, 1, FB.width * 3, file);
+    }
+    free(row);
+
+    bool ok = !ferror(file);
+    return fclose(file) == 0 && ok;
+}
+
+void RenderSoft_destruct() {
+    free(FB.pixels);
+    FB.pixels = NULL;
+    FB.width = 0;
+    FB.height = 0;
+    free(MOVED);
+    MOVED = NULL;
+    MOVED_SIZE = 0;
+}
@@ -0,0 +1,49 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    rendersoft.h
+ * @brief   Software render backend, rasterizes primitives into framebuffer
+ *          in memory (no window or GL context needed). Framebuffer is
+ *          allocated by Render_viewport and can be written as PPM image
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef RENDERSOFT_H
+#define RENDERSOFT_H
+
+#include <stdint.h>
+#include "render.h"
+
+
+//framebuffer of software backend
+typedef struct {
+    int width;
+    int height;
+    uint32_t * pixels;  /** 0xAARRGGBB, rows from top */
+} RenderSoft_Framebuffer;
+
+
+extern const Render_Backend RENDERSOFT_BACKEND;
+
+/**
+ * @brief RenderSoft_framebuffer
+ * @return Framebuffer (pixels are NULL before Render_viewport)
+ */
+const RenderSoft_Framebuffer * RenderSoft_framebuffer();
+
+/**
+ * @brief RenderSoft_writePPM Write framebuffer as binary PPM (P6) image
+ * @param path
+ * @return
+ */
+bool RenderSoft_writePPM(const char * path);
+
+/**
+ * @brief RenderSoft_destruct Free framebuffer
+ */
+void RenderSoft_destruct();
+
+#endif // RENDERSOFT_H
@@ -0,0 +1,214 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    scenestore.c
+ * @brief   Implementation of scenestore.h
+ * <------------------------------------------------------------------>
+ */
+
+#include "scenestore.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "epoch.h"
+
+
+static SceneStore_Table * copyTable(const SceneStore_Table * table, bool grow);
+
+static void freeTable(void * table);
+
+static void append(SceneStore_Array * array, E_Obj * obj, void (*handler)(void));
+
+static bool removeObj(SceneStore_Array * array, E_Obj * obj);
+
+static void publishTable(SceneStore * store, SceneStore_Table * table);
+
+
+bool SceneStore_init(SceneStore * store) {
+    if(store == NULL) return false;
+
+    SceneStore_Table * table = calloc(1, sizeof(SceneStore_Table));
+    if(table == NULL) return false;
+    if(pthread_mutex_init(&store->lock, NULL)) {
+        free(table);
+        return false;
+    }
+    atomic_init(&store->table, table);
+
+    return true;
+}
+
+const SceneStore_Table * SceneStore_read(SceneStore * store) {
+    if(store == NULL) return NULL;
+    return atomic_load_explicit(&store->table, memory_order_acquire);
+}
+
+unsigned int SceneStore_count(const SceneStore_Array * array) {
+    //acquire -> entries appended by writer are visible
+    return atomic_load_explicit(&array->count, memory_order_acquire);
+}
+
+bool SceneStore_insert(SceneStore * store, E_Obj * obj) {
+    if(store == NULL || obj == NULL || obj->events == NULL) return false;
+
+    pthread_mutex_lock(&store->lock);
+
+    //append in place, copy only when some array is full
+    SceneStore_Table * current = atomic_load(&store->table);
+    SceneStore_Table * table = current;
+    for(int i = -1; i < SceneStore_EventCount; ++i) {
+        const SceneStore_Array * array = i < 0 ? &table->objects : &table->dispatch[i];
+        if(atomic_load_explicit(&array->count, memory_order_relaxed) == array->capacity) {
+            table = copyTable(current, true);
+            break;
+        }
+    }
+    if(table == NULL) {
+        pthread_mutex_unlock(&store->lock);
+        return false;
+    }
+
+    const E_Obj_Evts * evts = obj->events;
+    append(&table->objects, obj, (void (*)(void)) evts->destruct);
+    if(evts->render) append(&table->dispatch[SceneStore_Render], obj, (void (*)(void)) evts->render);
+    if(evts->resize) append(&table->dispatch[SceneStore_Resize], obj, (void (*)(void)) evts->resize);
+    if(evts->update) append(&table->dispatch[SceneStore_Update], obj, (void (*)(void)) evts->update);
+    if(evts->mouseMoveEvt) append(&table->dispatch[SceneStore_MouseMove], obj, (void (*)(void)) evts->mouseMoveEvt);
+    if(evts->mouseButtonEvt) append(&table->dispatch[SceneStore_MouseButton], obj, (void (*)(void)) evts->mouseButtonEvt);
+    if(evts->pressKeyEvt) append(&table->dispatch[SceneStore_PressKey], obj, (void (*)(void)) evts->pressKeyEvt);
+    if(evts->releaseKeyEvt) append(&table->dispatch[SceneStore_ReleaseKey], obj, (void (*)(void)) evts->releaseKeyEvt);
+    if(evts->onLoad) append(&table->dispatch[SceneStore_OnLoad], obj, (void (*)(void)) evts->onLoad);
+    if(evts->publish) append(&table->dispatch[SceneStore_Publish], obj, (void (*)(void)) evts->publish);
+
+    if(table != current) publishTable(store, table);
+    pthread_mutex_unlock(&store->lock);
+
+    return true;
+}
+
+bool SceneStore_remove(SceneStore * store, E_Obj * obj, bool destruct) {
+    if(store == NULL || obj == NULL) return false;
+
+    pthread_mutex_lock(&store->lock);
+
+    //destructor of object, captured when it was inserted
+    const SceneStore_Table * current = atomic_load(&store->table);
+    unsigned int count = atomic_load_explicit(&current->objects.count, memory_order_relaxed);
+    void (*destructor)(void * obj) = NULL;
+    unsigned int i;
+    for(i = 0; i < count; ++i) {
+        if(current->objects.data[i].obj == obj) {
+            destructor = current->objects.data[i].handler.destruct;
+            break;
+        }
+    }
+    if(i == count) {
+        pthread_mutex_unlock(&store->lock);
+        return false;
+    }
+
+    //dispatchers can iterate current table, entries are shifted in copy
+    SceneStore_Table * table = copyTable(current, false);
+    if(table == NULL) {
+        pthread_mutex_unlock(&store->lock);
+        return false;
+    }
+    removeObj(&table->objects, obj);
+    for(i = 0; i < SceneStore_EventCount; ++i) {
+        removeObj(&table->dispatch[i], obj);
+    }
+
+    publishTable(store, table);
+    pthread_mutex_unlock(&store->lock);
+
+    //dispatchers can still hold object
+    if(destruct && destructor) Epoch_retire(obj, destructor);
+
+    return true;
+}
+
+void SceneStore_destruct(SceneStore * store) {
+    if(store == NULL) return;
+
+    SceneStore_Table * table = atomic_exchange(&store->table, NULL);
+    if(table != NULL) {
+        unsigned int count = atomic_load(&table->objects.count);
+        for(unsigned int i = 0; i < count; ++i) {
+            SceneStore_Entry * entry = &table->objects.data[i];
+            if(entry->handler.destruct) entry->handler.destruct(entry->obj);
+        }
+        freeTable(table);
+    }
+    pthread_mutex_destroy(&store->lock);
+}
+
+static SceneStore_Table * copyTable(const SceneStore_Table * table, bool grow) {
+    SceneStore_Table * copy = calloc(1, sizeof(SceneStore_Table));
+    if(copy == NULL) return NULL;
+
+    for(int i = -1; i < SceneStore_EventCount; ++i) {
+        const SceneStore_Array * src = i < 0 ? &table->objects : &table->dispatch[i];
+        SceneStore_Array * dst = i < 0 ? &copy->objects : &copy->dispatch[i];
+        unsigned int count = atomic_load_explicit(&src->count, memory_order_relaxed);
+
+        //full arrays are doubled, so n inserts copy O(n) entries in total
+        dst->capacity = src->capacity;
+        if(grow && count == src->capacity) {
+            dst->capacity = count ? count * 2 : SCENESTORE_MIN_CAPACITY;
+        }
+        if(dst->capacity == 0) continue;
+
+        dst->data = malloc(sizeof(SceneStore_Entry) * dst->capacity);
+        if(dst->data == NULL) {
+            freeTable(copy);
+            return NULL;
+        }
+        if(count) memcpy(dst->data, src->data, sizeof(SceneStore_Entry) * count);
+        atomic_init(&dst->count, count);
+    }
+
+    return copy;
+}
+
+static void freeTable(void * ptr) {
+    SceneStore_Table * table = (SceneStore_Table*) ptr;
+
+    if(table->objects.data) free(table->objects.data);
+    for(unsigned int i = 0; i < SceneStore_EventCount; ++i) {
+        if(table->dispatch[i].data) free(table->dispatch[i].data);
+    }
+    free(table);
+}
+
+static void append(SceneStore_Array * array, E_Obj * obj, void (*handler)(void)) {
+    //space was reserved by copyTable, entry is written before it is counted
+    unsigned int count = atomic_load_explicit(&array->count, memory_order_relaxed);
+    SceneStore_Entry * entry = &array->data[count];
+    entry->obj = obj;
+    entry->handler.destruct = (void (*)(void *)) handler;
+    atomic_store_explicit(&array->count, count + 1, memory_order_release);
+}
+
+static bool removeObj(SceneStore_Array * array, E_Obj * obj) {
+    //array is not published yet
+    unsigned int count = atomic_load_explicit(&array->count, memory_order_relaxed);
+    for(unsigned int i = 0; i < count; ++i) {
+        if(array->data[i].obj == obj) {
+            //shift tail, order of objects is kept
+            memmove(&array->data[i], &array->data[i + 1],
+                    sizeof(SceneStore_Entry) * (count - i - 1));
+            atomic_store_explicit(&array->count, count - 1, memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void publishTable(SceneStore * store, SceneStore_Table * table) {
+    //release -> content of table is visible to dispatchers
+    SceneStore_Table * old = atomic_exchange_explicit(&store->table, table, memory_order_acq_rel);
+    if(old != NULL) Epoch_retire(old, freeTable);
+}
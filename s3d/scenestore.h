@@ -0,0 +1,129 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    scenestore.h
+ * @brief   Contiguous storage of scene objects, for each event keeps
+ *          dense array of objects that implement its handler, so
+ *          dispatch is linear pass without NULL tests of E_Obj_Evts,
+ *          objects are appended in place to spare capacity, arrays are
+ *          copied on growth or removal and old ones are reclaimed by
+ *          epoch.h, so dispatch never waits for writers
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef SCENESTORE_H
+#define SCENESTORE_H
+
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "engine_object.h"
+
+
+//capacity of array allocated on first growth, doubled on each next
+#define SCENESTORE_MIN_CAPACITY 8
+
+
+//events with dispatch array
+typedef enum {
+    SceneStore_Render,
+    SceneStore_Resize,
+    SceneStore_Update,
+    SceneStore_MouseMove,
+    SceneStore_MouseButton,
+    SceneStore_PressKey,
+    SceneStore_ReleaseKey,
+    SceneStore_OnLoad,
+    SceneStore_Publish,
+    SceneStore_EventCount
+} SceneStore_Event;
+
+//object with handler of one event
+typedef struct {
+    E_Obj * obj;
+    union {
+        void (*destruct)(void * obj);
+        void (*render)(void * obj, const Event_Render * evt);
+        void (*resize)(void * obj, const Event_Resize * evt);
+        void (*update)(void * obj, SceneData * scene, const Event_Update * evt);
+        void (*mouse)(void * obj, SceneData * scene, const Event_Mouse * evt);
+        void (*key)(void * obj, SceneData * scene, const Event_Key * evt);
+        void (*onLoad)(void * obj, SceneData * scene);
+        void (*publish)(void * obj);
+    } handler;
+} SceneStore_Entry;
+
+typedef struct {
+    SceneStore_Entry * data;
+    atomic_uint count;      /** entries below count are immutable, read by SceneStore_count */
+    unsigned int capacity;
+} SceneStore_Array;
+
+/**
+ * Objects are kept in insert order in all arrays (render order of scene),
+ * handlers are read from E_Obj_Evts once, when object is inserted.
+ * Published table only grows by appends below capacity, removal publishes copy.
+ */
+typedef struct {
+    SceneStore_Array objects;   /** all objects, handler is destructor */
+    SceneStore_Array dispatch[SceneStore_EventCount];
+} SceneStore_Table;
+
+typedef struct _SceneStore {
+    _Atomic(SceneStore_Table *) table;  /** current table, replaced on growth and removal */
+    pthread_mutex_t lock;   /** serialises changes */
+} SceneStore;
+
+
+/**
+ * @brief SceneStore_init
+ * @param store
+ * @return
+ */
+bool SceneStore_init(SceneStore * store);
+
+/**
+ * @brief SceneStore_read Current table of store, valid until the calling thread
+ *        leaves critical section (Epoch_enter / Epoch_exit)
+ * @param store
+ * @return
+ */
+const SceneStore_Table * SceneStore_read(SceneStore * store);
+
+/**
+ * @brief SceneStore_count Number of entries of array, dispatchers read it once before
+ *        the pass, objects inserted during dispatch are not visited by it
+ * @param array Array of table returned by SceneStore_read
+ * @return
+ */
+unsigned int SceneStore_count(const SceneStore_Array * array);
+
+/**
+ * @brief SceneStore_insert Append object to scene and to dispatch arrays of its events
+ * @param store
+ * @param obj Object with events
+ * @return
+ */
+bool SceneStore_insert(SceneStore * store, E_Obj * obj);
+
+/**
+ * @brief SceneStore_remove Remove object from scene and from all dispatch arrays,
+ *        can be called during dispatch from any thread
+ * @param store
+ * @param obj
+ * @param destruct True -> destruct object once no dispatcher can hold reference on it
+ * @return
+ */
+bool SceneStore_remove(SceneStore * store, E_Obj * obj, bool destruct);
+
+/**
+ * @brief SceneStore_destruct Destruct all objects and free arrays, store struct is not freed,
+ *        no thread may dispatch events of store
+ * @param store
+ */
+void SceneStore_destruct(SceneStore * store);
+
+#endif // SCENESTORE_H
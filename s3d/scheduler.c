@@ -0,0 +1,74 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    scheduler.c
+ * @brief   Implementation of scheduler.h
+ * <------------------------------------------------------------------>
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "scheduler.h"
+
+#include <time.h>
+#include <errno.h>
+
+
+#define NS_PER_SECOND 1000000000LL
+
+
+bool Scheduler_init(Scheduler * scheduler, unsigned int ups, unsigned int max_steps) {
+    if(scheduler == NULL || ups == 0 || max_steps == 0) return false;
+
+    scheduler->step = NS_PER_SECOND / ups;
+    scheduler->max_steps = max_steps;
+    scheduler->deadline = Scheduler_now() + scheduler->step;
+    scheduler->stats = (Scheduler_Stats){0, 0, 0, 0, 0.0, 0.0};
+
+    return true;
+}
+
+unsigned int Scheduler_wait(Scheduler * scheduler) {
+    if(scheduler == NULL) return 0;
+
+    Scheduler_Stats * stats = &scheduler->stats;
+    int64_t now = Scheduler_now();
+
+    if(now >= scheduler->deadline) {
+        //previous tick took longer than step
+        stats->overruns++;
+    } else {
+        struct timespec ts;
+        ts.tv_sec = scheduler->deadline / NS_PER_SECOND;
+        ts.tv_nsec = scheduler->deadline % NS_PER_SECOND;
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+        now = Scheduler_now();
+
+        //wake up delay
+        double jitter = (now - scheduler->deadline) / (double) NS_PER_SECOND;
+        unsigned long slept = stats->ticks - stats->overruns;
+        stats->jitter_mean += (jitter - stats->jitter_mean) / (slept + 1);
+        if(jitter > stats->jitter_max) stats->jitter_max = jitter;
+    }
+    stats->ticks++;
+
+    //all deadlines that passed, next deadline keeps phase of schedule
+    int64_t steps = 1 + (now - scheduler->deadline) / scheduler->step;
+    scheduler->deadline += steps * scheduler->step;
+    if(steps > scheduler->max_steps) {
+        stats->dropped += steps - scheduler->max_steps;
+        steps = scheduler->max_steps;
+    }
+    stats->steps += steps;
+
+    return (unsigned int) steps;
+}
+
+int64_t Scheduler_now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * NS_PER_SECOND + ts.tv_nsec;
+}
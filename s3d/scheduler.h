@@ -0,0 +1,61 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    scheduler.h
+ * @brief   Fixed timestep scheduler of update loop, sleeps to absolute
+ *          deadlines of monotonic clock, so period does not drift by
+ *          duration of update and does not follow changes of wall time
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+//statistics of scheduler
+typedef struct {
+    unsigned long ticks;    /** wake ups of scheduler */
+    unsigned long steps;    /** update steps to execute */
+    unsigned long overruns; /** ticks whose deadline passed before scheduler was called (update was longer than step) */
+    unsigned long dropped;  /** steps dropped by limit of catch-up steps */
+    double jitter_mean;     /** mean delay of wake up after deadline [s] */
+    double jitter_max;      /** maximum delay of wake up after deadline [s] */
+} Scheduler_Stats;
+
+typedef struct {
+    int64_t step;           /** length of step [ns] */
+    unsigned int max_steps; /** maximum number of steps of one tick (catch-up) */
+    int64_t deadline;       /** deadline of next step [ns, CLOCK_MONOTONIC] */
+    Scheduler_Stats stats;
+} Scheduler;
+
+
+/**
+ * @brief Scheduler_init First deadline is one step from now
+ * @param scheduler
+ * @param ups Steps per second
+ * @param max_steps Maximum number of steps of one tick, longer delays are dropped
+ * @return
+ */
+bool Scheduler_init(Scheduler * scheduler, unsigned int ups, unsigned int max_steps);
+
+/**
+ * @brief Scheduler_wait Sleep until next deadline
+ * @param scheduler
+ * @return Number of steps to execute (more than 1 -> catching up missed deadlines)
+ */
+unsigned int Scheduler_wait(Scheduler * scheduler);
+
+/**
+ * @brief Scheduler_now Current time of monotonic clock
+ * @return ns
+ */
+int64_t Scheduler_now();
+
+#endif // SCHEDULER_H
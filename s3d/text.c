@@ -0,0 +1,171 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    text.c
+ * @brief   Implementation of text.h
+ * <------------------------------------------------------------------>
+ */
+
+#include "text.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "render.h"
+
+
+static Text_Atlas * ATLASES[TEXT_MAX_FONTS];
+static unsigned int ATLASES_COUNT = 0;
+
+
+static bool pixel(const unsigned char * glyph, int row, int column) {
+    const unsigned char * data = glyph + 1 + row * ((glyph[0] + 7) / 8);
+    return data[column / 8] & (0x80 >> (column % 8));
+}
+
+static Text_Atlas * createAtlas(const BitmapFont * font) {
+    Text_Atlas * atlas = malloc(sizeof(Text_Atlas));
+    if(atlas == NULL) return NULL;
+    atlas->font = font;
+
+    //glyphs are placed into rows from left, 1 texel gap around each glyph
+    int x = 1, y = 1;
+    for(int i = 0; i < BITMAPFONT_GLYPHS; ++i) {
+        const unsigned char * glyph = BitmapFont_glyph(font, BITMAPFONT_FIRST + i);
+        Text_Glyph * g = &atlas->glyphs[i];
+        g->width = glyph[0];
+        if(x + g->width + 1 > TEXT_ATLAS_WIDTH) {
+            x = 1;
+            y += font->height + 1;
+        }
+        g->x = x;
+        g->y = y;
+        x += g->width + 1;
+    }
+
+    Texture * texture = &atlas->texture;
+    texture->textureID = 0;
+    texture->width = TEXT_ATLAS_WIDTH;
+    texture->height = y + font->height + 1;
+    texture->imageSize = texture->width * texture->height * 4;
+    texture->rgba = true;
+    texture->data = calloc(texture->imageSize, 1);
+    if(texture->data == NULL) {
+        free(atlas);
+        return NULL;
+    }
+
+    //white BGRA texels, coverage in alpha
+    for(int i = 0; i < BITMAPFONT_GLYPHS; ++i) {
+        const unsigned char * glyph = BitmapFont_glyph(font, BITMAPFONT_FIRST + i);
+        Text_Glyph * g = &atlas->glyphs[i];
+        g->empty = true;
+        for(int r = 0; r < font->height; ++r) {
+            unsigned char * row = texture->data + ((g->y + r) * texture->width + g->x) * 4;
+            for(int c = 0; c < g->width; ++c) {
+                if(!pixel(glyph, r, c)) continue;
+                memset(row + c * 4, 0xFF, 4);
+                g->empty = false;
+            }
+        }
+    }
+
+    Render_loadTexture(texture);
+
+    return atlas;
+}
+
+const Text_Atlas * Text_getAtlas(const void * font) {
+    const BitmapFont * f = BitmapFont_get(font);
+    if(f == NULL) return NULL;
+
+    for(unsigned int i = 0; i < ATLASES_COUNT; ++i) {
+        if(ATLASES[i]->font == f) return ATLASES[i];
+    }
+    if(ATLASES_COUNT == TEXT_MAX_FONTS) return NULL;
+
+    Text_Atlas * atlas = createAtlas(f);
+    if(atlas != NULL) {
+        ATLASES[ATLASES_COUNT++] = atlas;
+    }
+    return atlas;
+}
+
+const Text_Glyph * Text_glyph(const Text_Atlas * atlas, unsigned char c) {
+    if(c < BITMAPFONT_FIRST || c >= BITMAPFONT_FIRST + BITMAPFONT_GLYPHS) return NULL;
+
+    return &atlas->glyphs[c - BITMAPFONT_FIRST];
+}
+
+void Text_destruct() {
+    for(unsigned int i = 0; i < ATLASES_COUNT; ++i) {
+        free(ATLASES[i]->texture.data);
+        free(ATLASES[i]);
+    }
+    ATLASES_COUNT = 0;
+}
+
+bool Text_initLayout(Text_Layout * layout, size_t capacity) {
+    if(layout == NULL) return false;
+
+    layout->font = NULL;
+    layout->length = 0;
+    layout->capacity = capacity;
+    layout->prefix = calloc(capacity + 1, sizeof(int));
+
+    return layout->prefix != NULL;
+}
+
+void Text_destructLayout(Text_Layout * layout) {
+    if(layout != NULL) {
+        free(layout->prefix);
+        layout->prefix = NULL;
+        layout->length = layout->capacity = 0;
+    }
+}
+
+void Text_layout(Text_Layout * layout, const void * font, const char * str) {
+    if(layout == NULL || layout->prefix == NULL) return;
+
+    layout->font = BitmapFont_get(font);
+    size_t i = 0;
+    if(layout->font != NULL && str != NULL) {
+        for(; i < layout->capacity && str[i]; ++i) {
+            layout->prefix[i + 1] = layout->prefix[i] + BitmapFont_charWidth(layout->font, str[i]);
+        }
+    }
+    layout->length = i;
+}
+
+int Text_width(const Text_Layout * layout, int index) {
+    if(layout == NULL || layout->prefix == NULL || index <= 0) return 0;
+
+    return layout->prefix[MIN((size_t) index, layout->length)];
+}
+
+int Text_widthRange(const Text_Layout * layout, int start, int end) {
+    if(start < 0 || start > end) return 0;
+
+    return Text_width(layout, end) - Text_width(layout, start);
+}
+
+int Text_index(const Text_Layout * layout, int x) {
+    if(layout == NULL || layout->prefix == NULL) return 0;
+
+    //first boundary not left of x, then nearer of it and previous one
+    size_t low = 0, high = layout->length;
+    while(low < high) {
+        size_t mid = (low + high) / 2;
+        if(layout->prefix[mid] < x) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if(low > 0 && x - layout->prefix[low - 1] <= layout->prefix[low] - x) {
+        return low - 1;
+    }
+    return low;
+}
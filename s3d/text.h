@@ -0,0 +1,118 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    text.h
+ * @brief   Text rendering support. Glyphs of bitmap font are rasterized
+ *          into texture atlas once and strings are drawn as textured
+ *          quads. Layout of string keeps widths of all its prefixes
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef TEXT_H
+#define TEXT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "util.h"
+#include "bitmapfont.h"
+
+
+#define TEXT_ATLAS_WIDTH 256    /** glyphs are placed into rows of this width */
+#define TEXT_MAX_FONTS 8
+
+//position of glyph in atlas texture
+typedef struct {
+    short x, y;     /** bottom left texel */
+    short width;    /** width and advance */
+    bool empty;     /** glyph has no pixel (space) */
+} Text_Glyph;
+
+//all glyphs of one font, texture rows go from bottom like glyph rows
+typedef struct {
+    const BitmapFont * font;
+    Texture texture;
+    Text_Glyph glyphs[BITMAPFONT_GLYPHS];
+} Text_Atlas;
+
+//widths of all prefixes of string
+typedef struct {
+    const BitmapFont * font;
+    size_t length;      /** characters of string */
+    size_t capacity;    /** maximum length */
+    int * prefix;       /** prefix[i] = width of first i characters */
+} Text_Layout;
+
+
+/**
+ * @brief Text_getAtlas Atlas of font, atlas is created and its texture loaded
+ *        by render backend on first use (render thread)
+ * @param font GLUT font (E2D_*)
+ * @return NULL if font is not GLUT font
+ */
+const Text_Atlas * Text_getAtlas(const void * font);
+
+/**
+ * @brief Text_glyph
+ * @param atlas
+ * @param c
+ * @return Glyph of character, NULL if character is not embedded
+ */
+const Text_Glyph * Text_glyph(const Text_Atlas * atlas, unsigned char c);
+
+/**
+ * @brief Text_destruct Free all atlases, textures of backend must not be used anymore
+ */
+void Text_destruct();
+
+/**
+ * @brief Text_initLayout Allocate layout, layout never allocates again so it
+ *        can be read by other thread while string is laid out
+ * @param layout
+ * @param capacity Maximum length of string
+ * @return
+ */
+bool Text_initLayout(Text_Layout * layout, size_t capacity);
+
+/**
+ * @brief Text_destructLayout
+ * @param layout
+ */
+void Text_destructLayout(Text_Layout * layout);
+
+/**
+ * @brief Text_layout Compute widths of prefixes of string, string is cut to capacity
+ * @param layout
+ * @param font GLUT font (E2D_*)
+ * @param str
+ */
+void Text_layout(Text_Layout * layout, const void * font, const char * str);
+
+/**
+ * @brief Text_width Width of first characters of laid out string, O(1)
+ * @param layout
+ * @param index Number of characters (clamped to length of string)
+ * @return
+ */
+int Text_width(const Text_Layout * layout, int index);
+
+/**
+ * @brief Text_widthRange Width of characters [start, end) of laid out string, O(1)
+ * @param layout
+ * @param start
+ * @param end
+ * @return
+ */
+int Text_widthRange(const Text_Layout * layout, int start, int end);
+
+/**
+ * @brief Text_index Index of character boundary nearest to x, O(log n)
+ * @param layout
+ * @param x Distance from start of string
+ * @return
+ */
+int Text_index(const Text_Layout * layout, int x);
+
+#endif // TEXT_H
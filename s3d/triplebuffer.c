@@ -0,0 +1,68 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    triplebuffer.c
+ * @brief   Implementation of triplebuffer.h
+ * <------------------------------------------------------------------>
+ */
+
+#include "triplebuffer.h"
+
+#include <stdlib.h>
+
+
+//middle buffer was published and not read yet
+#define TRIPLEBUFFER_FRESH 0x4
+#define TRIPLEBUFFER_INDEX 0x3
+
+
+bool TripleBuffer_init(TripleBuffer * tb, size_t size) {
+    if(tb == NULL || size == 0) return false;
+
+    tb->data = calloc(3, size);
+    if(tb->data == NULL) return false;
+
+    tb->size = size;
+    tb->back = 0;
+    atomic_init(&tb->middle, 1);
+    tb->front = 2;
+
+    return true;
+}
+
+void * TripleBuffer_writeBuffer(TripleBuffer * tb) {
+    if(tb == NULL) return NULL;
+    return tb->data + tb->back * tb->size;
+}
+
+void TripleBuffer_publish(TripleBuffer * tb) {
+    if(tb == NULL) return;
+
+    //release -> content of back buffer is visible to reader
+    unsigned int old = atomic_exchange_explicit(&tb->middle, tb->back | TRIPLEBUFFER_FRESH,
+                                                memory_order_acq_rel);
+    tb->back = old & TRIPLEBUFFER_INDEX;
+}
+
+const void * TripleBuffer_read(TripleBuffer * tb) {
+    if(tb == NULL) return NULL;
+
+    if(atomic_load_explicit(&tb->middle, memory_order_relaxed) & TRIPLEBUFFER_FRESH) {
+        //acquire -> content written before publish is visible
+        unsigned int old = atomic_exchange_explicit(&tb->middle, tb->front, memory_order_acq_rel);
+        tb->front = old & TRIPLEBUFFER_INDEX;
+    }
+
+    return tb->data + tb->front * tb->size;
+}
+
+void TripleBuffer_destruct(TripleBuffer * tb) {
+    if(tb == NULL) return;
+
+    if(tb->data) free(tb->data);
+    tb->data = NULL;
+    tb->size = 0;
+}
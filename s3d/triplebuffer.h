@@ -0,0 +1,72 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    2D Engine
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    triplebuffer.h
+ * @brief   Lock-free triple buffer for passing snapshots of state
+ *          from one writer thread (update) to one reader thread
+ *          (render), neither side ever waits for the other
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+
+/**
+ * Writer fills back buffer and publishes it by swapping it with middle
+ * buffer, reader takes middle buffer (if it is newer than its front buffer)
+ * by swapping it with front buffer. Reader always sees complete snapshot.
+ */
+typedef struct {
+    unsigned char * data;   /** three buffers of size bytes */
+    size_t size;            /** size of one buffer */
+    atomic_uint middle;     /** index of middle buffer | TRIPLEBUFFER_FRESH */
+    unsigned int back;      /** buffer owned by writer */
+    unsigned int front;     /** buffer owned by reader */
+} TripleBuffer;
+
+
+/**
+ * @brief TripleBuffer_init
+ * @param tb
+ * @param size Size of one snapshot in bytes
+ * @return
+ */
+bool TripleBuffer_init(TripleBuffer * tb, size_t size);
+
+/**
+ * @brief TripleBuffer_writeBuffer Back buffer (writer thread only), content
+ *        is undefined, whole snapshot has to be written before publishing
+ * @param tb
+ * @return
+ */
+void * TripleBuffer_writeBuffer(TripleBuffer * tb);
+
+/**
+ * @brief TripleBuffer_publish Publish back buffer as newest snapshot (writer thread only)
+ * @param tb
+ */
+void TripleBuffer_publish(TripleBuffer * tb);
+
+/**
+ * @brief TripleBuffer_read Newest published snapshot (reader thread only),
+ *        buffer stays valid until next call of TripleBuffer_read
+ * @param tb
+ * @return
+ */
+const void * TripleBuffer_read(TripleBuffer * tb);
+
+/**
+ * @brief TripleBuffer_destruct Free buffers, struct is not freed
+ * @param tb
+ */
+void TripleBuffer_destruct(TripleBuffer * tb);
+
+#endif // TRIPLEBUFFER_H
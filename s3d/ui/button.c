@@ -12,6 +12,7 @@
 #include "button.h"
 
 #include "../util.h"
+#include "../damage.h"
 #include "ui_obj.h"
 #include "colors.h"
 #include <stdlib.h>
@@ -19,6 +20,14 @@
 #include <stdio.h>
 
 
+//render state of button
+typedef struct {
+    UI_View ui;
+    Color background;
+    Color foreground;
+} Button_View;
+
+
 /* Object event functions -------------------------------------------------------- */
 
 static void destruct(void * obj) {
@@ -28,25 +37,34 @@ static void destruct(void * obj) {
 
 static void render(void * obj, const Event_Render * evt) {
     Button * btn = (Button*) obj;
-    if(!btn->events.visible) return;
+    Button_View view = *(const Button_View*) UI_OBJ_view(btn);
+    if(!view.ui.visible) return;
 
-    Render_setColor(&btn->background);
-    Render_drawRectangle(&btn->position, btn->width, btn->height);
+    Render_setColor(&view.background);
+    Render_drawRectangle(&view.ui.position, view.ui.width, view.ui.height);
 
-    if(btn->events.hover) {
-        Render_fillRectangle(&btn->position, btn->width, btn->height);
-        Color foreground_hover = COLOR_LIGHTER(btn->foreground, 0.6);
+    if(view.ui.hover) {
+        Render_fillRectangle(&view.ui.position, view.ui.width, view.ui.height);
+        Color foreground_hover = COLOR_LIGHTER(view.foreground, 0.6);
         Render_setColor(&foreground_hover);
     } else {
-        Render_setColor(&btn->foreground);
+        Render_setColor(&view.foreground);
     }
 
     Render_drawString(
-                btn->position.x + (btn->width - Render_getStringWidth(btn->text))/2,
-                btn->position.y + (btn->height + Render_getStringHeight())/2,
+                view.ui.position.x + (view.ui.width - Render_getStringWidth(btn->text))/2,
+                view.ui.position.y + (view.ui.height + Render_getStringHeight())/2,
                 btn->text);
 }
 
+static void publish(void * obj) {
+    Button * btn = (Button*) obj;
+    Button_View * view = UI_OBJ_writeView(btn);
+    view->background = btn->background;
+    view->foreground = btn->foreground;
+    UI_OBJ_publishView(btn);
+}
+
 static void mouseMoveEvt(void * obj, SceneData * scene, const Event_Mouse * evt) {
     Button * btn = (Button*) obj;
     if(!btn->events.enabled || !btn->events.visible) return;
@@ -54,12 +72,14 @@ static void mouseMoveEvt(void * obj, SceneData * scene, const Event_Mouse * evt)
     if(evt->x >= 0 && evt->y >= 0) {
         if(IN_RANGE(evt->x, btn->position.x, btn->position.x + btn->width)) {
             if(IN_RANGE(evt->y, btn->position.y, btn->position.y + btn->height)) {
+                if(!btn->events.hover) UI_OBJ_damage(btn);
                 btn->events.hover = true;
                 if(btn->events.mouseMovedAction) btn->events.mouseMovedAction(btn, evt);
                 return;
             }
         }
     }
+    if(btn->events.hover) UI_OBJ_damage(btn);
     btn->events.hover = false;
 }
 
@@ -67,19 +87,28 @@ static void mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * ev
     Button * btn = (Button*) obj;
     if(!btn->events.enabled || !btn->events.visible) return;
 
+    bool focus = btn->events.focus;
     btn->events.focus = false;
     if(evt->x >= 0 && evt->y >= 0) {
         if(IN_RANGE(evt->x, btn->position.x, btn->position.x + btn->width)) {
             if(IN_RANGE(evt->y, btn->position.y, btn->position.y + btn->height)) {
                 btn->events.focus = true;
                 if(evt->state == EVT_M_DOWN) {
-                    if(btn->events.mousePressAction) btn->events.mousePressAction(btn, evt);
+                    if(btn->events.mousePressAction) {
+                        //action can change any object
+                        Damage_markAll();
+                        btn->events.mousePressAction(btn, evt);
+                    }
                 } else if(evt->state == EVT_M_UP) {
-                    if(btn->events.mouseReleaseAction) btn->events.mouseReleaseAction(btn, evt);
+                    if(btn->events.mouseReleaseAction) {
+                        Damage_markAll();
+                        btn->events.mouseReleaseAction(btn, evt);
+                    }
                 }
             }
         }
     }
+    if(focus != btn->events.focus) UI_OBJ_damage(btn);
 }
 
 static const E_Obj_Evts e_obj_evts = {
@@ -91,7 +120,8 @@ static const E_Obj_Evts e_obj_evts = {
     .mouseButtonEvt = mouseButtonEvt,
     .pressKeyEvt = UI_OBJ_pressKeyEvt,
     .releaseKeyEvt = UI_OBJ_releaseKeyEvt,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = publish
 };
 
 /* Object functions -------------------------------------------------------- */
@@ -104,6 +134,7 @@ Button * Button_create(int x, int y, size_t width, size_t heigth,
     if(btn == NULL) return NULL;
 
     btn->objEvts = &e_obj_evts;
+    IntrusiveList_initNode(&btn->node);
     btn->events = UI_EVENTS_INIT;
 
     btn->background = UI_BUTTON_BG_COLOR;
@@ -114,6 +145,11 @@ Button * Button_create(int x, int y, size_t width, size_t heigth,
     btn->width = width;
     btn->height = heigth;
     btn->text = malloc(sizeof (char) * (strlen(txt) + 1));
+    if(btn->text == NULL || !UI_OBJ_initView(btn, sizeof(Button_View))) {
+        free(btn->text);
+        free(btn);
+        return NULL;
+    }
     sprintf(btn->text, "%s", txt);
 
     return btn;
@@ -122,6 +158,7 @@ Button * Button_create(int x, int y, size_t width, size_t heigth,
 void Button_destruct(Button * btn) {
     if(btn != NULL) {
         if(btn->text) free(btn->text);
+        UI_OBJ_destructView(btn);
         free(btn);
     }
 }
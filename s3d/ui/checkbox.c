@@ -12,12 +12,23 @@
 #include "checkbox.h"
 
 #include "../util.h"
+#include "../damage.h"
 #include "ui_obj.h"
 #include "colors.h"
 #include <stdlib.h>
 #include <stdio.h>
 
 
+//render state of check box
+typedef struct {
+    UI_View ui;
+    bool value;
+    Color background;
+    Color borderColor;
+    Color foreground;
+} CheckBox_View;
+
+
 /* Object event functions -------------------------------------------------------- */
 
 static void destruct(void * obj) {
@@ -27,42 +38,54 @@ static void destruct(void * obj) {
 
 static void render(void * obj, const Event_Render * evt) {
     CheckBox * cb = (CheckBox*) obj;
-    if(!cb->events.visible) return;
+    CheckBox_View view = *(const CheckBox_View*) UI_OBJ_view(cb);
+    if(!view.ui.visible) return;
 
-    Render_setColor(&cb->background);
-    Render_fillRectangle(&cb->position, cb->width, cb->height);
-    Render_setColor(&cb->borderColor);
-    Render_drawRectangle(&cb->position, cb->width, cb->height);
+    Render_setColor(&view.background);
+    Render_fillRectangle(&view.ui.position, view.ui.width, view.ui.height);
+    Render_setColor(&view.borderColor);
+    Render_drawRectangle(&view.ui.position, view.ui.width, view.ui.height);
 
-    if(cb->value) {
-        Render_setColor(&cb->foreground);
+    if(view.value) {
+        Render_setColor(&view.foreground);
         Point2D pts[3];
-        pts[0].x = cb->position.x + (int)cb->width / 4;
-        pts[0].y = cb->position.y + (int)cb->height / 4;
-        pts[1].x = cb->position.x + (int)cb->width / 2;
-        pts[1].y = cb->position.y + (int)cb->height * 0.7;
-        pts[2].x = cb->position.x + (int)cb->width * 1.2;
-        pts[2].y = cb->position.y - (int)cb->height / 6;
+        pts[0].x = view.ui.position.x + (int)view.ui.width / 4;
+        pts[0].y = view.ui.position.y + (int)view.ui.height / 4;
+        pts[1].x = view.ui.position.x + (int)view.ui.width / 2;
+        pts[1].y = view.ui.position.y + (int)view.ui.height * 0.7;
+        pts[2].x = view.ui.position.x + (int)view.ui.width * 1.2;
+        pts[2].y = view.ui.position.y - (int)view.ui.height / 6;
         Render_lineWidth(2.5);
         Render_drawLines(pts, 3);
         Render_lineWidth(RENDER_DEFAULT_LINE_WIDTH);
     }
 
     if(cb->label != NULL) {
-        if(cb->label->objEvts->render) {
-            int center = cb->height/2 + Render_getStringHeight()/3;
+        if(cb->label->objEvts->render && Render_pushTransform()) {
+            int center = view.ui.height/2 + Render_getStringHeight()/3;
             //shift origin
-            glTranslatef(cb->position.x, cb->position.y + center, 0);
+            Render_translate(view.ui.position.x, view.ui.position.y + center);
 
             //render
             cb->label->objEvts->render(cb->label, evt);
 
-            //shift origin back
-            glTranslatef(-cb->position.x, -cb->position.y - center, 0);
+            Render_popTransform();
         }
     }
 }
 
+static void publish(void * obj) {
+    CheckBox * cb = (CheckBox*) obj;
+    CheckBox_View * view = UI_OBJ_writeView(cb);
+    view->value = cb->value;
+    view->background = cb->background;
+    view->borderColor = cb->borderColor;
+    view->foreground = cb->foreground;
+    UI_OBJ_publishView(cb);
+
+    if(cb->label != NULL) cb->label->objEvts->publish(cb->label);
+}
+
 static void resize(void * obj, const Event_Resize * evt) {
     UI_Obj * uiobj = (UI_Obj*) obj;
     if(uiobj->events.resizable) {
@@ -75,6 +98,7 @@ static void mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * ev
     CheckBox * cb = (CheckBox*) obj;
     if(!cb->events.enabled || !cb->events.visible) return;
 
+    bool focus = cb->events.focus;
     cb->events.focus = false;
     if(evt->x >= 0 && evt->y >= 0) {
         if(IN_RANGE(evt->x, cb->position.x, cb->position.x + cb->width)) {
@@ -83,13 +107,24 @@ static void mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * ev
 
                 if(evt->state == EVT_M_DOWN) {
                     cb->value = !cb->value;
-                    if(cb->events.mousePressAction) cb->events.mousePressAction(cb, evt);
+                    //tick overflows box
+                    Damage_markRect(cb->position.x - UI_DAMAGE_MARGIN, cb->position.y - cb->height / 4,
+                                    cb->width * 1.25 + 2 * UI_DAMAGE_MARGIN, cb->height * 1.25 + UI_DAMAGE_MARGIN);
+                    if(cb->events.mousePressAction) {
+                        //action can change any object
+                        Damage_markAll();
+                        cb->events.mousePressAction(cb, evt);
+                    }
                 } else if(evt->state == EVT_M_UP) {
-                    if(cb->events.mouseReleaseAction) cb->events.mouseReleaseAction(cb, evt);
+                    if(cb->events.mouseReleaseAction) {
+                        Damage_markAll();
+                        cb->events.mouseReleaseAction(cb, evt);
+                    }
                 }
             }
         }
     }
+    if(focus != cb->events.focus) UI_OBJ_damage(cb);
 }
 
 
@@ -102,7 +137,8 @@ static const E_Obj_Evts e_obj_evts = {
     .mouseButtonEvt = mouseButtonEvt,
     .pressKeyEvt = UI_OBJ_pressKeyEvt,
     .releaseKeyEvt = UI_OBJ_releaseKeyEvt,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = publish
 };
 
 /* Object functions -------------------------------------------------------- */
@@ -113,6 +149,7 @@ CheckBox * CheckBox_create(int x, int y, size_t size, bool value,
     if(cb == NULL) return NULL;
 
     cb->objEvts = &e_obj_evts;
+    IntrusiveList_initNode(&cb->node);
     cb->events = UI_EVENTS_INIT;
 
     cb->position.x = x;
@@ -123,7 +160,12 @@ CheckBox * CheckBox_create(int x, int y, size_t size, bool value,
     cb->background = UI_CHECK_BG_COLOR;
     cb->borderColor = UI_CHECK_BORDER_COLOR;
     cb->foreground = UI_CHECK_FG_COLOR;
+    if(!UI_OBJ_initView(cb, sizeof(CheckBox_View))) {
+        free(cb);
+        return NULL;
+    }
 
+    cb->label = NULL;
     if(txt != NULL) {
         if(*txt != 0) {
             cb->label = Label_create(size + 10, 0, txt);
@@ -136,6 +178,7 @@ CheckBox * CheckBox_create(int x, int y, size_t size, bool value,
 void CheckBox_destruct(CheckBox * cb) {
     if(cb != NULL) {
         if(cb->label) Label_destruct(cb->label);
+        UI_OBJ_destructView(cb);
         free(cb);
     }
 }
@@ -15,6 +15,7 @@
 #include "../event.h"
 #include "../render.h"
 #include "../engine_object.h"
+#include "../triplebuffer.h"
 #include "label.h"
 #include <stdbool.h>
 
@@ -22,6 +23,7 @@
 typedef struct {
     //[engine object event]
     const E_Obj_Evts * objEvts;
+    IntrusiveList_Node node;
 
     //[data]
 
@@ -33,6 +35,9 @@ typedef struct {
     GLfloat width;
     GLfloat height;
 
+    //published render state (UI_View)
+    TripleBuffer view;
+
     //data
     bool value;
     Color background;
@@ -26,36 +26,37 @@ static void destruct(void * obj) {
 
 static void render(void * obj, const Event_Render * evt) {
     Image * img = (Image*) obj;
-    if(!img->events.visible) return;
+    UI_View view = *(const UI_View*) UI_OBJ_view(img);
+    if(!view.visible) return;
 
-    if(img->width == IMAGE_SIZE_AUTO && img->height == IMAGE_SIZE_AUTO) {
+    if(view.width == IMAGE_SIZE_AUTO && view.height == IMAGE_SIZE_AUTO) {
         //default size of texture
-        Render_drawImage(&img->position, img->texture, true);
+        Render_drawImage(&view.position, img->texture, true);
     } else {
         Point2D bounds[4];
-        bounds[0] = img->position;
-        bounds[1] = img->position;
-        bounds[2] = img->position;
-        bounds[3] = img->position;
-        if(img->width != IMAGE_SIZE_AUTO && img->height != IMAGE_SIZE_AUTO) {
-            bounds[0].y += img->height;
-            bounds[2].x += img->width;
-            bounds[3].x += img->width;
-            bounds[3].y += img->height;
-        } else if(img->width != IMAGE_SIZE_AUTO) {
+        bounds[0] = view.position;
+        bounds[1] = view.position;
+        bounds[2] = view.position;
+        bounds[3] = view.position;
+        if(view.width != IMAGE_SIZE_AUTO && view.height != IMAGE_SIZE_AUTO) {
+            bounds[0].y += view.height;
+            bounds[2].x += view.width;
+            bounds[3].x += view.width;
+            bounds[3].y += view.height;
+        } else if(view.width != IMAGE_SIZE_AUTO) {
             //auto height
-            int height = ((float)img->width / img->texture->width) * img->texture->height;
+            int height = ((float)view.width / img->texture->width) * img->texture->height;
             bounds[0].y += height;
-            bounds[2].x += img->width;
-            bounds[3].x += img->width;
+            bounds[2].x += view.width;
+            bounds[3].x += view.width;
             bounds[3].y += height;
-        } else if(img->height != IMAGE_SIZE_AUTO) {
+        } else if(view.height != IMAGE_SIZE_AUTO) {
             //auto width
-            int width = ((float)img->height / img->texture->height) * img->texture->width;
-            bounds[0].y += img->height;
+            int width = ((float)view.height / img->texture->height) * img->texture->width;
+            bounds[0].y += view.height;
             bounds[2].x += width;
             bounds[3].x += width;
-            bounds[3].y += img->height;
+            bounds[3].y += view.height;
         }
         Render_drawImage(bounds, img->texture, false);
     }
@@ -67,11 +68,13 @@ static const E_Obj_Evts e_obj_evts = {
     .render = render,
     .resize = UI_OBJ_resize,
     .update = NULL,
-    .mouseMoveEvt = UI_OBJ_mouseMoveEvt,
-    .mouseButtonEvt = UI_OBJ_mouseButtonEvt,
+    //passive, mouse events pass to childs of panel under it
+    .mouseMoveEvt = NULL,
+    .mouseButtonEvt = NULL,
     .pressKeyEvt = UI_OBJ_pressKeyEvt,
     .releaseKeyEvt = UI_OBJ_releaseKeyEvt,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = UI_OBJ_publish
 };
 
 /* Object functions -------------------------------------------------------- */
@@ -81,6 +84,7 @@ Image * Image_create(int x, int y, size_t width, size_t heigth, Texture * textur
     if(img == NULL) return NULL;
 
     img->objEvts = &e_obj_evts;
+    IntrusiveList_initNode(&img->node);
     img->events = UI_EVENTS_INIT;
 
     img->position.x = x;
@@ -88,12 +92,17 @@ Image * Image_create(int x, int y, size_t width, size_t heigth, Texture * textur
     img->width = width;
     img->height = heigth;
     img->texture = texture;
+    if(!UI_OBJ_initView(img, sizeof(UI_View))) {
+        free(img);
+        return NULL;
+    }
 
     return img;
 }
 
 void Image_destruct(Image * img) {
     if(img != NULL) {
+        UI_OBJ_destructView(img);
         free(img);
     }
 }
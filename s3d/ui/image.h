@@ -15,6 +15,7 @@
 #include "../event.h"
 #include "../render.h"
 #include "../engine_object.h"
+#include "../triplebuffer.h"
 #include <stdbool.h>
 
 
@@ -27,6 +28,7 @@
 typedef struct {
     //[engine object event]
     const E_Obj_Evts * objEvts;
+    IntrusiveList_Node node;
 
     //[data]
 
@@ -38,6 +40,9 @@ typedef struct {
     GLfloat width;
     GLfloat height;
 
+    //published render state (UI_View)
+    TripleBuffer view;
+
     //data
     Texture * texture;
 } Image;
@@ -12,6 +12,8 @@
 #include "label.h"
 
 #include "../util.h"
+#include "../damage.h"
+#include "../epoch.h"
 #include "ui_obj.h"
 #include "colors.h"
 #include <stdlib.h>
@@ -19,6 +21,15 @@
 #include <stdio.h>
 
 
+//render state of label, text is owned by label and retired on change
+typedef struct {
+    UI_View ui;
+    Color foreground;
+    const char * text;
+    bool centered;
+} Label_View;
+
+
 /* Object event functions -------------------------------------------------------- */
 
 static void destruct(void * obj) {
@@ -28,33 +39,45 @@ static void destruct(void * obj) {
 
 static void render(void * obj, const Event_Render * evt) {
     Label * lab = (Label*) obj;
-    if(!lab->events.visible) return;
+    Label_View view = *(const Label_View*) UI_OBJ_view(lab);
+    if(!view.ui.visible) return;
 
-    Render_setColor(&lab->foreground);
-    if(lab->centered) {
+    Render_setColor(&view.foreground);
+    if(view.centered) {
         Render_drawString(
-                    lab->position.x - Render_getStringWidth(lab->text) / 2,
-                    lab->position.y,
-                    lab->text);
+                    view.ui.position.x - Render_getStringWidth(view.text) / 2,
+                    view.ui.position.y,
+                    view.text);
     } else {
         Render_drawString(
-                    lab->position.x,
-                    lab->position.y,
-                    lab->text);
+                    view.ui.position.x,
+                    view.ui.position.y,
+                    view.text);
     }
 }
 
+static void publish(void * obj) {
+    Label * lab = (Label*) obj;
+    Label_View * view = UI_OBJ_writeView(lab);
+    view->foreground = lab->foreground;
+    view->text = lab->text;
+    view->centered = lab->centered;
+    UI_OBJ_publishView(lab);
+}
+
 
 static const E_Obj_Evts e_obj_evts = {
     .destruct = destruct,
     .render = render,
     .resize = UI_OBJ_resize,
     .update = NULL,
-    .mouseMoveEvt = UI_OBJ_mouseMoveEvt,
-    .mouseButtonEvt = UI_OBJ_mouseButtonEvt,
+    //passive, mouse events pass to childs of panel under it
+    .mouseMoveEvt = NULL,
+    .mouseButtonEvt = NULL,
     .pressKeyEvt = UI_OBJ_pressKeyEvt,
     .releaseKeyEvt = UI_OBJ_releaseKeyEvt,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = publish
 };
 
 /* Object functions -------------------------------------------------------- */
@@ -64,12 +87,19 @@ Label * Label_create(int x, int y, const char * const txt) {
     if(lab == NULL) return NULL;
 
     lab->objEvts = &e_obj_evts;
+    IntrusiveList_initNode(&lab->node);
     lab->events = UI_EVENTS_INIT;
 
     lab->foreground = UI_LABEL_FG_COLOR;
     lab->position.x = x;
     lab->position.y = y;
+    lab->width = 0;
+    lab->height = 0;
     lab->centered = false;
+    if(!UI_OBJ_initView(lab, sizeof(Label_View))) {
+        free(lab);
+        return NULL;
+    }
     if(txt != NULL) {
         lab->text = malloc(sizeof (char) * (strlen(txt) + 1));
         sprintf(lab->text, "%s", txt);
@@ -83,6 +113,7 @@ Label * Label_create(int x, int y, const char * const txt) {
 void Label_destruct(Label * lab) {
     if(lab != NULL) {
         if(lab->text) free(lab->text);
+        UI_OBJ_destructView(lab);
         free(lab);
     }
 }
@@ -90,8 +121,16 @@ void Label_destruct(Label * lab) {
 void Label_changeText(Label * lab, const char * const txt) {
     if(lab == NULL) return;
 
-    if(lab->text) free(lab->text);
-    lab->text = malloc(sizeof (char) * (strlen(txt) + 1));
-    sprintf(lab->text, "%s", txt);
+    char * text = malloc(sizeof (char) * (strlen(txt) + 1));
+    if(text == NULL) return;
+    sprintf(text, "%s", txt);
+
+    //render thread can still draw old text from last view
+    char * old = lab->text;
+    lab->text = text;
+    publish(lab);
+    if(old != NULL) Epoch_retire(old, free);
+    //bounds of label depend on text
+    Damage_markAll();
 }
 
@@ -15,12 +15,14 @@
 #include "../event.h"
 #include "../render.h"
 #include "../engine_object.h"
+#include "../triplebuffer.h"
 #include <stdbool.h>
 
 
 typedef struct {
     //[engine object event]
     const E_Obj_Evts * objEvts;
+    IntrusiveList_Node node;
 
     //[data]
 
@@ -32,6 +34,9 @@ typedef struct {
     GLfloat width;
     GLfloat height;
 
+    //published render state (UI_View)
+    TripleBuffer view;
+
     //data
     Color foreground;
     char * text;
@@ -57,7 +62,8 @@ Label * Label_create(int x, int y, const char * const txt);
 void Label_destruct(Label * lab);
 
 /**
- * @brief Label_changeText
+ * @brief Label_changeText Change text (update thread), old text is freed
+ *        when render thread can not draw it anymore (epoch.h)
  * @param lab
  * @param txt
  */
@@ -12,6 +12,8 @@
 #include "panel.h"
 
 #include "../util.h"
+#include "../damage.h"
+#include "../profiler.h"
 #include "ui_obj.h"
 #include "colors.h"
 #include <stdlib.h>
@@ -19,6 +21,12 @@
 
 #define MOUSE_POS_THRESHOLD 15
 
+//render state of panel, childs publish their own
+typedef struct {
+    UI_View ui;
+    Color background;
+} Panel_View;
+
 
 /* Object event functions -------------------------------------------------------- */
 
@@ -28,41 +36,47 @@ static void destruct(void * obj) {
 }
 
 static void render(void * obj, const Event_Render * evt) {
+    (void) evt;
     Panel * pan = (Panel*) obj;
-    if(!pan->events.visible) return;
+    Panel_View view = *(const Panel_View*) UI_OBJ_view(pan);
+    if(!view.ui.visible) return;
 
     Event_Render panel_evt;
-    panel_evt.window_width = pan->width;
-    panel_evt.window_height = pan->height;
+    panel_evt.window_width = view.ui.width;
+    panel_evt.window_height = view.ui.height;
     panel_evt.sender = pan;
 
     //draw panel
-    Render_setColor(&pan->background);
-    Render_fillRectangle(&pan->position, pan->width, pan->height);
-    Color border_color = COLOR_LIGHTER(pan->background, 0.1);
+    Render_setColor(&view.background);
+    Render_fillRectangle(&view.ui.position, view.ui.width, view.ui.height);
+    Color border_color = COLOR_LIGHTER(view.background, 0.1);
     Render_setColor(&border_color);
-    Render_drawRectangle(&pan->position, pan->width, pan->height);
-
-
-    //render childs
-    Render_setScissor(pan->position.x,pan->position.y + pan->height,
-                      pan->width, pan->height, evt);
-    Render_applyOffset(pan->position.x, pan->position.y, 0.0);
-
-    E_Obj * child;
-    LinkedList_Element * el = pan->childs.first;
-    while(el != NULL) {
-        if(el->ptr != NULL) {
-            child = (E_Obj*) el->ptr;
-            if(child->events) {
-                if(child->events->render) child->events->render(child, &panel_evt);
+    Render_drawRectangle(&view.ui.position, view.ui.width, view.ui.height);
+
+
+    //render childs, childs outside of clip rectangle are skipped
+    if(Render_pushClip(view.ui.position.x, view.ui.position.y, view.ui.width, view.ui.height) && Render_pushTransform()) {
+        Render_translate(view.ui.position.x, view.ui.position.y);
+
+        UI_Obj * child;
+        const UI_View * child_view;
+        IntrusiveList_Node * node = pan->childs.first;
+        while(node != NULL) {
+            child = INTRUSIVELIST_ENTRY(node, UI_Obj, node);
+            child_view = UI_OBJ_view(child);
+            if(child->objEvts && child->objEvts->render &&
+                    !Render_isClipped(child_view->position.x - UI_DAMAGE_MARGIN, child_view->position.y - UI_DAMAGE_MARGIN,
+                                      child_view->width + 2 * UI_DAMAGE_MARGIN, child_view->height + 2 * UI_DAMAGE_MARGIN)) {
+                PROFILER_BEGIN(start);
+                child->objEvts->render(child, &panel_evt);
+                PROFILER_END(start, Profiler_Render, child);
             }
+            node = node->next;
         }
-        el = LinkedList_next(el);
-    }
 
-    Render_clearOffset();
-    Render_resetScissor(evt);
+        Render_popTransform();
+    }
+    Render_popClip();
 }
 
 static void resize(void * obj, const Event_Resize * evt) {
@@ -81,16 +95,15 @@ static void resize(void * obj, const Event_Resize * evt) {
         panel_evt.sender = pan;
 
         E_Obj * child;
-        LinkedList_Element * el = pan->childs.first;
-        while(el != NULL) {
-            if(el->ptr != NULL) {
-                child = (E_Obj*) el->ptr;
-                if(child->events) {
-                    if(child->events->resize) child->events->resize(child, &panel_evt);
-                }
+        IntrusiveList_Node * node = pan->childs.first;
+        while(node != NULL) {
+            child = INTRUSIVELIST_ENTRY(node, E_Obj, node);
+            if(child->events) {
+                if(child->events->resize) child->events->resize(child, &panel_evt);
             }
-            el = LinkedList_next(el);
+            node = node->next;
         }
+        pan->layoutChanged = true;
     }
 }
 
@@ -100,47 +113,108 @@ static void update(void * obj, SceneData * scene, const Event_Update * evt) {
     Event_Update panel_evt = *evt;
     panel_evt.sender = pan;
 
+    //childs mark damage in coordinates of panel
+    Damage_applyOffset(pan->position.x, pan->position.y);
     E_Obj * child;
-    LinkedList_Element * el = pan->childs.first;
-    while(el != NULL) {
-        if(el->ptr != NULL) {
-            child = (E_Obj*) el->ptr;
-            if(child->events) {
-                if(child->events->update) child->events->update(child, scene, &panel_evt);
+    IntrusiveList_Node * node = pan->childs.first;
+    while(node != NULL) {
+        child = INTRUSIVELIST_ENTRY(node, E_Obj, node);
+        if(child->events) {
+            if(child->events->update) {
+                PROFILER_BEGIN(start);
+                child->events->update(child, scene, &panel_evt);
+                PROFILER_END(start, Profiler_Update, child);
             }
         }
-        el = LinkedList_next(el);
+        node = node->next;
+    }
+    Damage_applyOffset(-pan->position.x, -pan->position.y);
+}
+
+static void publish(void * obj) {
+    Panel * pan = (Panel*) obj;
+    Panel_View * view = UI_OBJ_writeView(pan);
+    view->background = pan->background;
+    UI_OBJ_publishView(pan);
+
+    E_Obj * child;
+    IntrusiveList_Node * node = pan->childs.first;
+    while(node != NULL) {
+        child = INTRUSIVELIST_ENTRY(node, E_Obj, node);
+        if(child->events && child->events->publish) child->events->publish(child);
+        node = node->next;
+    }
+}
+
+//only visible childs with handler of event are hit, label over button does not swallow click
+static bool acceptsMove(void * obj) {
+    UI_Obj * child = (UI_Obj*) obj;
+    return child->events.visible && child->objEvts->mouseMoveEvt != NULL;
+}
+
+static bool acceptsButton(void * obj) {
+    UI_Obj * child = (UI_Obj*) obj;
+    return child->events.visible && child->objEvts->mouseButtonEvt != NULL;
+}
+
+static E_Obj * childAt(Panel * pan, float x, float y, bool (*accept)(void * obj)) {
+    if(pan->layoutChanged) {
+        HitBVH_clear(&pan->hitIndex);
+        IntrusiveList_Node * node = pan->childs.first;
+        while(node != NULL) {
+            UI_Obj * child = INTRUSIVELIST_ENTRY(node, UI_Obj, node);
+            HitRect bounds = {child->position.x, child->position.y,
+                              child->position.x + child->width, child->position.y + child->height};
+            HitBVH_insert(&pan->hitIndex, bounds, child);
+            node = node->next;
+        }
+        pan->layoutChanged = false;
     }
+    return (E_Obj*) HitBVH_query(&pan->hitIndex, x, y, accept);
+}
+
+static void sendOutside(E_Obj * child, SceneData * scene, const Event_Mouse * evt,
+                        void (*handler)(void * obj, SceneData * scene, const Event_Mouse * evt)) {
+    //coordinates outside of all childs -> child clears its hover / focus
+    Event_Mouse outside_evt = *evt;
+    outside_evt.x = -1;
+    outside_evt.y = -1;
+    if(handler) handler(child, scene, &outside_evt);
 }
 
 static void mouseMoveEvt(void * obj, SceneData * scene, const Event_Mouse * evt) {
     Panel * pan = (Panel*) obj;
     if(!pan->events.enabled || !pan->events.visible) return;
 
+    E_Obj * child = NULL;
+    Event_Mouse panel_evt = *evt;
+    panel_evt.x -= pan->position.x;
+    panel_evt.y -= pan->position.y;
+    panel_evt.sender = pan;
+
     if(IN_RANGE(evt->x, pan->position.x - MOUSE_POS_THRESHOLD,
                 pan->position.x + pan->width + MOUSE_POS_THRESHOLD)) {
         if(IN_RANGE(evt->y, pan->position.y - MOUSE_POS_THRESHOLD,
                     pan->position.y + pan->height + MOUSE_POS_THRESHOLD)) {
+            child = childAt(pan, panel_evt.x, panel_evt.y, acceptsMove);
+        }
+    }
 
-            Event_Mouse panel_evt = *evt;
-            panel_evt.x -= pan->position.x;
-            panel_evt.y -= pan->position.y;
-            panel_evt.sender = pan;
-
-            E_Obj * child;
-            LinkedList_Element * el = pan->childs.first;
-            while(el != NULL) {
-                if(el->ptr != NULL) {
-                    child = (E_Obj*) el->ptr;
-                    if(child->events) {
-                        if(child->events->mouseMoveEvt) child->events->mouseMoveEvt(child, scene, &panel_evt);
-                    }
-                }
-                el = LinkedList_next(el);
-            }
-
+    Damage_applyOffset(pan->position.x, pan->position.y);
+    //leave
+    if(pan->hover != NULL && pan->hover != child) {
+        sendOutside(pan->hover, scene, &panel_evt, pan->hover->events->mouseMoveEvt);
+    }
+    //enter / move
+    if(child != NULL) {
+        if(child->events->mouseMoveEvt) {
+            PROFILER_BEGIN(start);
+            child->events->mouseMoveEvt(child, scene, &panel_evt);
+            PROFILER_END(start, Profiler_Input, child);
         }
     }
+    Damage_applyOffset(-pan->position.x, -pan->position.y);
+    pan->hover = child;
 }
 
 static void mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * evt) {
@@ -159,17 +233,22 @@ static void mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * ev
             panel_evt.y -= pan->position.y;
             panel_evt.sender = pan;
 
-            E_Obj * child;
-            LinkedList_Element * el = pan->childs.first;
-            while(el != NULL) {
-                if(el->ptr != NULL) {
-                    child = (E_Obj*) el->ptr;
-                    if(child->events) {
-                        if(child->events->mouseButtonEvt) child->events->mouseButtonEvt(child, scene, &panel_evt);
-                    }
+            E_Obj * child = childAt(pan, panel_evt.x, panel_evt.y, acceptsButton);
+
+            Damage_applyOffset(pan->position.x, pan->position.y);
+            //focus moves to other child
+            if(pan->focus != NULL && pan->focus != child) {
+                sendOutside(pan->focus, scene, &panel_evt, pan->focus->events->mouseButtonEvt);
+            }
+            if(child != NULL) {
+                if(child->events->mouseButtonEvt) {
+                    PROFILER_BEGIN(start);
+                    child->events->mouseButtonEvt(child, scene, &panel_evt);
+                    PROFILER_END(start, Profiler_Input, child);
                 }
-                el = LinkedList_next(el);
             }
+            Damage_applyOffset(-pan->position.x, -pan->position.y);
+            pan->focus = child;
 
         }
     }
@@ -183,17 +262,21 @@ static void pressKeyEvt(void * obj, SceneData * scene, const Event_Key * evt) {
         Event_Key panel_evt = *evt;
         panel_evt.sender = pan;
 
+        Damage_applyOffset(pan->position.x, pan->position.y);
         E_Obj * child;
-        LinkedList_Element * el = pan->childs.first;
-        while(el != NULL) {
-            if(el->ptr != NULL) {
-                child = (E_Obj*) el->ptr;
-                if(child->events) {
-                    if(child->events->pressKeyEvt) child->events->pressKeyEvt(child, scene, &panel_evt);
+        IntrusiveList_Node * node = pan->childs.first;
+        while(node != NULL) {
+            child = INTRUSIVELIST_ENTRY(node, E_Obj, node);
+            if(child->events) {
+                if(child->events->pressKeyEvt) {
+                    PROFILER_BEGIN(start);
+                    child->events->pressKeyEvt(child, scene, &panel_evt);
+                    PROFILER_END(start, Profiler_Input, child);
                 }
             }
-            el = LinkedList_next(el);
+            node = node->next;
         }
+        Damage_applyOffset(-pan->position.x, -pan->position.y);
     }
 }
 
@@ -205,17 +288,21 @@ static void releaseKeyEvt(void * obj, SceneData * scene, const Event_Key * evt)
         Event_Key panel_evt = *evt;
         panel_evt.sender = pan;
 
+        Damage_applyOffset(pan->position.x, pan->position.y);
         E_Obj * child;
-        LinkedList_Element * el = pan->childs.first;
-        while(el != NULL) {
-            if(el->ptr != NULL) {
-                child = (E_Obj*) el->ptr;
-                if(child->events) {
-                    if(child->events->releaseKeyEvt) child->events->releaseKeyEvt(child, scene, &panel_evt);
+        IntrusiveList_Node * node = pan->childs.first;
+        while(node != NULL) {
+            child = INTRUSIVELIST_ENTRY(node, E_Obj, node);
+            if(child->events) {
+                if(child->events->releaseKeyEvt) {
+                    PROFILER_BEGIN(start);
+                    child->events->releaseKeyEvt(child, scene, &panel_evt);
+                    PROFILER_END(start, Profiler_Input, child);
                 }
             }
-            el = LinkedList_next(el);
+            node = node->next;
         }
+        Damage_applyOffset(-pan->position.x, -pan->position.y);
     }
 }
 
@@ -229,7 +316,8 @@ static const E_Obj_Evts e_obj_evts = {
     .mouseButtonEvt = mouseButtonEvt,
     .pressKeyEvt = pressKeyEvt,
     .releaseKeyEvt = releaseKeyEvt,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = publish
 };
 
 /* Object functions -------------------------------------------------------- */
@@ -239,6 +327,7 @@ Panel * Panel_create(int x, int y, size_t width, size_t height) {
     if(pan == NULL) return NULL;
 
     pan->objEvts = &e_obj_evts;
+    IntrusiveList_initNode(&pan->node);
     pan->events = UI_EVENTS_INIT;
 
     pan->background = UI_PANEL_BG_COLOR;
@@ -246,21 +335,44 @@ Panel * Panel_create(int x, int y, size_t width, size_t height) {
     pan->position.y = y;
     pan->width = width;
     pan->height = height;
+    if(!UI_OBJ_initView(pan, sizeof(Panel_View))) {
+        free(pan);
+        return NULL;
+    }
 
-    LinkedList_init(&pan->childs);
+    IntrusiveList_init(&pan->childs);
+    HitBVH_init(&pan->hitIndex);
+    pan->layoutChanged = false;
+    pan->hover = NULL;
+    pan->focus = NULL;
 
     return pan;
 }
 
 void Panel_destruct(Panel * pan) {
     if(pan != NULL) {
-        LinkedList_destruct(&pan->childs);
+        //unlink and destruct all childs
+        E_Obj * child;
+        IntrusiveList_Node * node;
+        while((node = pan->childs.first) != NULL) {
+            IntrusiveList_unlink(&pan->childs, node);
+            child = INTRUSIVELIST_ENTRY(node, E_Obj, node);
+            if(child->events && child->events->destruct) child->events->destruct(child);
+        }
+        HitBVH_destruct(&pan->hitIndex);
+        UI_OBJ_destructView(pan);
         free(pan);
     }
 }
 
 bool Panel_insertChild(Panel * pan, E_Obj * obj) {
     if(pan == NULL || obj == NULL) return false;
-    return E_Obj_insertToList(&pan->childs, obj);;
+    if(!IntrusiveList_append(&pan->childs, &obj->node)) return false;
+    pan->layoutChanged = true;
+    return true;
+}
+
+void Panel_invalidateLayout(Panel * pan) {
+    if(pan != NULL) pan->layoutChanged = true;
 }
 
@@ -15,13 +15,16 @@
 #include "../event.h"
 #include "../render.h"
 #include "../engine_object.h"
+#include "../triplebuffer.h"
 #include "../linkedlist.h"
+#include "../hittest.h"
 #include <stdbool.h>
 
 
 typedef struct {
     //[engine object event]
     const E_Obj_Evts * objEvts;
+    IntrusiveList_Node node;
 
     //[data]
 
@@ -33,9 +36,18 @@ typedef struct {
     GLfloat width;
     GLfloat height;
 
+    //published render state (UI_View)
+    TripleBuffer view;
+
     //data
     Color background;
-    LinkedList childs;
+    IntrusiveList childs;
+
+    //mouse events are passed only to child under cursor
+    HitBVH hitIndex;
+    bool layoutChanged;  /** bounds of childs changed, index is rebuilt by next mouse event */
+    E_Obj * hover;  /** child that received last mouse move */
+    E_Obj * focus;  /** child that received last mouse button event */
 } Panel;
 
 /**
@@ -58,9 +70,15 @@ void Panel_destruct(Panel * pan);
 /**
  * @brief Panel_insertChild
  * @param pan
- * @param obj
+ * @param obj UI object (layout of ui_obj.h)
  * @return
  */
 bool Panel_insertChild(Panel * pan, E_Obj * obj);
 
+/**
+ * @brief Panel_invalidateLayout Call after position or size of child was changed
+ * @param pan
+ */
+void Panel_invalidateLayout(Panel * pan);
+
 #endif // PANEL_H
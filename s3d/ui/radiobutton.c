@@ -12,11 +12,22 @@
 #include "radiobutton.h"
 
 #include "../util.h"
+#include "../damage.h"
 #include "ui_obj.h"
 #include "colors.h"
 #include <stdlib.h>
 
 
+//render state of radio button
+typedef struct {
+    UI_View ui;
+    bool value;
+    Color background;
+    Color borderColor;
+    Color foreground;
+} RadioButton_View;
+
+
 /* Object event functions -------------------------------------------------------- */
 
 static void destruct(void * obj) {
@@ -26,39 +37,51 @@ static void destruct(void * obj) {
 
 static void render(void * obj, const Event_Render * evt) {
     RadioButton * rb = (RadioButton*) obj;
-    if(!rb->events.visible) return;
+    RadioButton_View view = *(const RadioButton_View*) UI_OBJ_view(rb);
+    if(!view.ui.visible) return;
 
-    Point2D p = rb->position;
-    p.x += rb->width/2;
-    p.y += rb->height/2;
+    Point2D p = view.ui.position;
+    p.x += view.ui.width/2;
+    p.y += view.ui.height/2;
 
-    Render_setColor(&rb->background);
+    Render_setColor(&view.background);
     //Render_fillRectangle(&rb->position, rb->size, rb->size);
-    Render_setColor(&rb->borderColor);
+    Render_setColor(&view.borderColor);
     Render_lineWidth(2);
-    Render_drawEllipse(&p, rb->width/2, rb->height/2);
+    Render_drawEllipse(&p, view.ui.width/2, view.ui.height/2);
     Render_lineWidth(RENDER_DEFAULT_LINE_WIDTH);
 
-    if(rb->value) {
-        Render_setColor(&rb->foreground);
-        Render_fillEllipse(&p, rb->width/3, rb->height/3);
+    if(view.value) {
+        Render_setColor(&view.foreground);
+        Render_fillEllipse(&p, view.ui.width/3, view.ui.height/3);
     }
 
     if(rb->label != NULL) {
-        if(rb->label->objEvts->render) {
-            int center = rb->height/2 + Render_getStringHeight()/3;
+        if(rb->label->objEvts->render && Render_pushTransform()) {
+            int center = view.ui.height/2 + Render_getStringHeight()/3;
             //shift origin
-            glTranslatef(rb->position.x, rb->position.y + center, 0);
+            Render_translate(view.ui.position.x, view.ui.position.y + center);
 
             //render
             rb->label->objEvts->render(rb->label, evt);
 
-            //shift origin back
-            glTranslatef(-rb->position.x, -rb->position.y - center, 0);
+            Render_popTransform();
         }
     }
 }
 
+static void publish(void * obj) {
+    RadioButton * rb = (RadioButton*) obj;
+    RadioButton_View * view = UI_OBJ_writeView(rb);
+    view->value = rb->value;
+    view->background = rb->background;
+    view->borderColor = rb->borderColor;
+    view->foreground = rb->foreground;
+    UI_OBJ_publishView(rb);
+
+    if(rb->label != NULL) rb->label->objEvts->publish(rb->label);
+}
+
 static void resize(void * obj, const Event_Resize * evt) {
     UI_Obj * uiobj = (UI_Obj*) obj;
     if(uiobj->events.resizable) {
@@ -71,6 +94,7 @@ static void mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * ev
     RadioButton * rb = (RadioButton*) obj;
     if(!rb->events.enabled || !rb->events.visible) return;
 
+    bool focus = rb->events.focus;
     rb->events.focus = false;
     if(evt->x >= 0 && evt->y >= 0) {
         if(IN_RANGE(evt->x, rb->position.x, rb->position.x + rb->width)) {
@@ -79,26 +103,36 @@ static void mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * ev
                 if(evt->state == EVT_M_DOWN) {
 
                     //change value of radio button, set false value for all in group
+                    if(!rb->value) UI_OBJ_damage(rb);
                     rb->value = true;
                     if(rb->group) {
                         RadioButton * child;
-                        LinkedList_Element * el = rb->group->radiobuttons.first;
-                        while(el != NULL) {
-                            if(el->ptr != obj) {
-                                child = (RadioButton*) el->ptr;
+                        IntrusiveList_Node * node = rb->group->radiobuttons.first;
+                        while(node != NULL) {
+                            child = INTRUSIVELIST_ENTRY(node, RadioButton, groupNode);
+                            if(child != rb && child->value) {
                                 child->value = false;
+                                UI_OBJ_damage(child);
                             }
-                            el = LinkedList_next(el);
+                            node = node->next;
                         }
                     }
 
-                    if(rb->events.mousePressAction) rb->events.mousePressAction(rb, evt);
+                    if(rb->events.mousePressAction) {
+                        //action can change any object
+                        Damage_markAll();
+                        rb->events.mousePressAction(rb, evt);
+                    }
                 } else if(evt->state == EVT_M_UP) {
-                    if(rb->events.mouseReleaseAction) rb->events.mouseReleaseAction(rb, evt);
+                    if(rb->events.mouseReleaseAction) {
+                        Damage_markAll();
+                        rb->events.mouseReleaseAction(rb, evt);
+                    }
                 }
             }
         }
     }
+    if(focus != rb->events.focus) UI_OBJ_damage(rb);
 }
 
 static const E_Obj_Evts e_obj_evts = {
@@ -110,7 +144,8 @@ static const E_Obj_Evts e_obj_evts = {
     .mouseButtonEvt = mouseButtonEvt,
     .pressKeyEvt = UI_OBJ_pressKeyEvt,
     .releaseKeyEvt = UI_OBJ_releaseKeyEvt,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = publish
 };
 
 /* Object functions -------------------------------------------------------- */
@@ -121,6 +156,7 @@ RadioButton * RadioButton_create(int x, int y, size_t size, bool value,
     if(rb == NULL) return NULL;
 
     rb->objEvts = &e_obj_evts;
+    IntrusiveList_initNode(&rb->node);
     rb->events = UI_EVENTS_INIT;
     rb->position.x = x;
     rb->position.y = y;
@@ -128,10 +164,16 @@ RadioButton * RadioButton_create(int x, int y, size_t size, bool value,
     rb->height = size;
     rb->value = value;
     rb->group = NULL;
+    IntrusiveList_initNode(&rb->groupNode);
     rb->background = UI_CHECK_BG_COLOR;
     rb->borderColor = UI_CHECK_BORDER_COLOR;
     rb->foreground = UI_CHECK_FG_COLOR;
+    if(!UI_OBJ_initView(rb, sizeof(RadioButton_View))) {
+        free(rb);
+        return NULL;
+    }
 
+    rb->label = NULL;
     if(txt != NULL) {
         if(*txt != 0) {
             rb->label = Label_create(size + 10, 0, txt);
@@ -144,7 +186,10 @@ RadioButton * RadioButton_create(int x, int y, size_t size, bool value,
 void RadioButton_destruct(RadioButton * rb) {
     if(rb != NULL) {
         rb->events = UI_EVENTS_INIT;
+        if(rb->group) IntrusiveList_unlink(&rb->group->radiobuttons, &rb->groupNode);
+        rb->group = NULL;
         if(rb->label) Label_destruct(rb->label);
+        UI_OBJ_destructView(rb);
     }
 }
 
@@ -153,7 +198,7 @@ RadioButtonGroup * RadioButtonGroup_create() {
     RadioButtonGroup * group = malloc(sizeof(RadioButtonGroup));
     if(group == NULL) return NULL;
 
-    if(!LinkedList_init(&group->radiobuttons)) {
+    if(!IntrusiveList_init(&group->radiobuttons)) {
         free(group);
         return NULL;
     }
@@ -164,17 +209,22 @@ RadioButtonGroup * RadioButtonGroup_create() {
 bool RadioButtonGroup_add(RadioButtonGroup * group, RadioButton * btn) {
     if(group == NULL || btn == NULL ) return false;
 
-    LinkedList_Element * element = malloc(sizeof(LinkedList_Element));
-    element->ptr = btn;
+    if(!IntrusiveList_append(&group->radiobuttons, &btn->groupNode)) return false;
     btn->group = group;
-    element->destruct = NULL;
 
-    return LinkedList_insert(&group->radiobuttons, element);
+    return true;
 }
 
 void RadioButtonGroup_destruct(RadioButtonGroup * group) {
     if(group != NULL) {
-        LinkedList_destruct(&group->radiobuttons);
+        //radio buttons are owned by their parents, only unlink them
+        RadioButton * child;
+        IntrusiveList_Node * node;
+        while((node = group->radiobuttons.first) != NULL) {
+            IntrusiveList_unlink(&group->radiobuttons, node);
+            child = INTRUSIVELIST_ENTRY(node, RadioButton, groupNode);
+            child->group = NULL;
+        }
         free(group);
     }
 }
@@ -15,6 +15,7 @@
 #include "../event.h"
 #include "../render.h"
 #include "../engine_object.h"
+#include "../triplebuffer.h"
 #include "label.h"
 #include <stdbool.h>
 
@@ -24,13 +25,14 @@ typedef struct {
     const E_Obj_Evts * objEvts;
 
     //[data]
-    LinkedList radiobuttons;
+    IntrusiveList radiobuttons;
 } RadioButtonGroup;
 
 
 typedef struct {
     //[engine object event]
     const E_Obj_Evts * objEvts;
+    IntrusiveList_Node node;
 
     //[data]
 
@@ -42,6 +44,9 @@ typedef struct {
     GLfloat width;
     GLfloat height;
 
+    //published render state (UI_View)
+    TripleBuffer view;
+
     //data
     bool value;
     Color background;
@@ -49,6 +54,7 @@ typedef struct {
     Color foreground;
     Label * label;
     RadioButtonGroup * group;
+    IntrusiveList_Node groupNode; /** link in list of group */
 } RadioButton;
 
 
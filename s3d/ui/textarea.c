@@ -60,7 +60,8 @@ static const E_Obj_Evts e_obj_evts = {
     .mouseButtonEvt = mouseButtonEvt,
     .pressKeyEvt = pressKeyEvt,
     .releaseKeyEvt = releaseKeyEvt,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = UI_OBJ_publish
 };
 
 /* Object functions -------------------------------------------------------- */
@@ -71,6 +72,18 @@ TextArea * TextArea_create(int x, int y, size_t width, size_t heigth,
     if(ta == NULL) return NULL;
 
     ta->objEvts = &e_obj_evts;
+    IntrusiveList_initNode(&ta->node);
+    ta->events = UI_EVENTS_INIT;
+
+    ta->position.x = x;
+    ta->position.y = y;
+    ta->width = width;
+    ta->height = heigth;
+    ta->text = NULL;
+    if(!UI_OBJ_initView(ta, sizeof(UI_View))) {
+        free(ta);
+        return NULL;
+    }
 
     return ta;
 }
@@ -78,6 +91,7 @@ TextArea * TextArea_create(int x, int y, size_t width, size_t heigth,
 void TextArea_destruct(TextArea * tf) {
     if(tf != NULL) {
         if(tf->text) free(tf->text);
+        UI_OBJ_destructView(tf);
         free(tf);
     }
 }
@@ -12,6 +12,7 @@
 #include "textfield.h"
 
 #include "../util.h"
+#include "../damage.h"
 #include "ui_obj.h"
 #include "colors.h"
 #include <stdlib.h>
@@ -20,6 +21,19 @@
 #include <ctype.h>
 
 
+//render state of text field, text is copied behind view
+typedef struct {
+    UI_View ui;
+    Color background;
+    Color foreground;
+    Color caret;
+    bool caret_visible;     /** focused and in visible phase of blinking */
+    GLfloat scroll;         /** width of text hidden on left side */
+    GLfloat caret_x;        /** caret position from start of text */
+    char text[];
+} TextField_View;
+
+
 /* Object event functions -------------------------------------------------------- */
 
 static void destruct(void * obj) {
@@ -28,51 +42,67 @@ static void destruct(void * obj) {
 }
 
 static void render(void * obj, const Event_Render * evt) {
+    (void) evt;
     TextField * tf = (TextField*) obj;
-    if(!tf->events.visible) return;
+    const TextField_View * view = UI_OBJ_view(tf);
+    if(!view->ui.visible) return;
 
-    if(tf->events.focus) {
-        Color darker_bg = COLOR_DARKER(tf->background, 0.4);
+    Point2D position = view->ui.position;
+    Color background = view->background;
+    if(view->ui.focus) {
+        Color darker_bg = COLOR_DARKER(background, 0.4);
         Render_setColor(&darker_bg);
     } else {
-        Render_setColor(&tf->background);
+        Render_setColor(&background);
     }
-    Render_fillRectangle(&tf->position, tf->width, tf->height);
-    Color border = COLOR_LIGHTER(tf->background, 0.2);
+    Render_fillRectangle(&position, view->ui.width, view->ui.height);
+    Color border = COLOR_LIGHTER(background, 0.2);
     Render_setColor(&border);
-    Render_drawRectangle(&tf->position, tf->width, tf->height);
+    Render_drawRectangle(&position, view->ui.width, view->ui.height);
 
 
-    Render_setColor(&tf->foreground);
+    Color foreground = view->foreground;
+    Render_setColor(&foreground);
 
-    float line_start = (tf->height + Render_getStringHeight())/2;
+    float line_start = (view->ui.height + Render_getStringHeight())/2;
 
-    Render_setScissor(tf->position.x + 5, tf->position.y + tf->height,
-                      tf->width - 10, tf->height, evt);
-    Render_drawString(tf->position.x + 5 - Render_getStringWidthRange(
-                          tf->text, tf->caret_position - abs(tf->caret_offset), tf->caret_position),
-                      tf->position.y + line_start,
-                      tf->text);
+    Render_pushClip(position.x + 5, position.y, view->ui.width - 10, view->ui.height);
+    Render_drawString(position.x + 5 - view->scroll, position.y + line_start, view->text);
 
-    if(tf->events.focus) {
-        if(tf->caret_time % 2 == 0) {
-            Point2D p1, p2;
-            p1.x = tf->position.x + 5 + Render_getStringWidthIndex(tf->text, tf->caret_position + tf->caret_offset) + 2;
-            p2.x = p1.x;
-            p1.y = tf->position.y + line_start;
-            p2.y = tf->position.y + line_start - Render_getStringHeight();
-            Render_setColor(&tf->caret);
-            Render_drawLine(&p1, &p2);
-        }
+    if(view->caret_visible) {
+        Point2D p1, p2;
+        p1.x = position.x + 5 + view->caret_x + 2;
+        p2.x = p1.x;
+        p1.y = position.y + line_start;
+        p2.y = position.y + line_start - Render_getStringHeight();
+        Color caret = view->caret;
+        Render_setColor(&caret);
+        Render_drawLine(&p1, &p2);
     }
 
-    Render_resetScissor(evt);
+    Render_popClip();
+}
+
+static void publish(void * obj) {
+    TextField * tf = (TextField*) obj;
+    TextField_View * view = UI_OBJ_writeView(tf);
+    view->background = tf->background;
+    view->foreground = tf->foreground;
+    view->caret = tf->caret;
+    view->caret_visible = tf->events.focus && tf->caret_time % 2 == 0;
+    view->scroll = Text_widthRange(&tf->layout, tf->caret_position - abs(tf->caret_offset), tf->caret_position);
+    view->caret_x = Text_width(&tf->layout, tf->caret_position + tf->caret_offset);
+    strcpy(view->text, tf->text);
+    UI_OBJ_publishView(tf);
 }
 
 static void update(void * obj, SceneData * scene, const Event_Update * evt) {
     TextField * tf = (TextField*) obj;
 
-    tf->caret_time = evt->ns_time/4e8;
+    int caret_time = evt->ns_time/4e8;
+    //caret blinks
+    if(tf->events.focus && caret_time % 2 != tf->caret_time % 2) UI_OBJ_damage(tf);
+    tf->caret_time = caret_time;
 }
 
 static void mouseMoveEvt(void * obj, SceneData * scene, const Event_Mouse * evt) {
@@ -82,12 +112,14 @@ static void mouseMoveEvt(void * obj, SceneData * scene, const Event_Mouse * evt)
     if(evt->x >= 0 && evt->y >= 0) {
         if(IN_RANGE(evt->x, tf->position.x, tf->position.x + tf->width)) {
             if(IN_RANGE(evt->y, tf->position.y, tf->position.y + tf->height)) {
+                if(!tf->events.hover) UI_OBJ_damage(tf);
                 tf->events.hover = true;
                 if(tf->events.mouseMovedAction) tf->events.mouseMovedAction(tf, evt);
                 return;
             }
         }
     }
+    if(tf->events.hover) UI_OBJ_damage(tf);
     tf->events.hover = false;
 }
 
@@ -95,32 +127,31 @@ static void mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * ev
     TextField * tf = (TextField*) obj;
     if(!tf->events.enabled || !tf->events.visible) return;
 
+    bool focus = tf->events.focus;
     tf->events.focus = false;
     if(evt->x >= 0 && evt->y >= 0) {
         if(IN_RANGE(evt->x, tf->position.x, tf->position.x + tf->width)) {
             if(IN_RANGE(evt->y, tf->position.y, tf->position.y + tf->height)) {
                 tf->events.focus = true;
                 if(evt->state == EVT_M_DOWN) {
-                    if(tf->events.mousePressAction) tf->events.mousePressAction(tf, evt);
+                    if(tf->events.mousePressAction) {
+                        //action can change any object
+                        Damage_markAll();
+                        tf->events.mousePressAction(tf, evt);
+                    }
                 } else if(evt->state == EVT_M_UP) {
-                    if(tf->events.mouseReleaseAction) tf->events.mouseReleaseAction(tf, evt);
-                }
-
-                int min = INT16_MAX;
-                int v;
-                int index = 0;
-                for(int i = 0; i <= tf->maxTextLength; ++i) {
-                    v = tf->position.x + 5 + Render_getStringWidthIndex(tf->text, i) + 2;
-                    v = abs(v - evt->x);
-                    if(v < min) {
-                        min = v;
-                        index = i;
+                    if(tf->events.mouseReleaseAction) {
+                        Damage_markAll();
+                        tf->events.mouseReleaseAction(tf, evt);
                     }
                 }
-                tf->caret_position = index;
+
+                tf->caret_position = Text_index(&tf->layout, evt->x - (int)tf->position.x - 5 - 2);
+                UI_OBJ_damage(tf);
             }
         }
     }
+    if(focus != tf->events.focus) UI_OBJ_damage(tf);
 }
 
 static void pressKeyEvt(void * obj, SceneData * scene, const Event_Key * evt) {
@@ -128,7 +159,10 @@ static void pressKeyEvt(void * obj, SceneData * scene, const Event_Key * evt) {
     if(!tf->events.enabled || !tf->events.visible) return;
 
     if(tf->events.focus) {
-        if(tf->events.keyPressedAction) tf->events.keyPressedAction(tf, evt);
+        if(tf->events.keyPressedAction) {
+            Damage_markAll();
+            tf->events.keyPressedAction(tf, evt);
+        }
 
         if(isprint(evt->key)) {
             if(strlen(tf->text) + 1 <= (unsigned long)tf->maxTextLength) {
@@ -137,9 +171,9 @@ static void pressKeyEvt(void * obj, SceneData * scene, const Event_Key * evt) {
                 }
                 tf->text[tf->caret_position] = evt->key;
                 tf->caret_position++;
+                Render_layoutString(&tf->layout, tf->text);
 
-                if((unsigned long)Render_getStringWidthIndex(
-                            tf->text, tf->caret_position + tf->caret_offset) > tf->width - 10) {
+                if(Text_width(&tf->layout, tf->caret_position + tf->caret_offset) > tf->width - 10) {
                     tf->caret_offset--;
                 }
             }
@@ -154,6 +188,7 @@ static void pressKeyEvt(void * obj, SceneData * scene, const Event_Key * evt) {
                         tf->caret_offset++;
                     }
                     tf->caret_position--;
+                    Render_layoutString(&tf->layout, tf->text);
                 }
                 break;
             }
@@ -170,6 +205,7 @@ static void pressKeyEvt(void * obj, SceneData * scene, const Event_Key * evt) {
                 break;
             }
         }
+        UI_OBJ_damage(tf);
     }
 }
 
@@ -178,7 +214,10 @@ static void releaseKeyEvt(void * obj, SceneData * scene, const Event_Key * evt)
     if(!tf->events.enabled || !tf->events.visible) return;
 
     if(tf->events.focus) {
-        if(tf->events.keyPressedAction) tf->events.keyPressedAction(tf, evt);
+        if(tf->events.keyPressedAction) {
+            Damage_markAll();
+            tf->events.keyPressedAction(tf, evt);
+        }
     }
 }
 
@@ -192,7 +231,8 @@ static const E_Obj_Evts e_obj_evts = {
     .mouseButtonEvt = mouseButtonEvt,
     .pressKeyEvt = pressKeyEvt,
     .releaseKeyEvt = releaseKeyEvt,
-    .onLoad = NULL
+    .onLoad = NULL,
+    .publish = publish
 };
 
 /* Object functions -------------------------------------------------------- */
@@ -203,6 +243,7 @@ TextField * TextField_create(int x, int y, size_t width, size_t heigth,
     if(tf == NULL) return NULL;
 
     tf->objEvts = &e_obj_evts;
+    IntrusiveList_initNode(&tf->node);
     tf->events = UI_EVENTS_INIT;
 
     tf->position.x = x;
@@ -211,11 +252,24 @@ TextField * TextField_create(int x, int y, size_t width, size_t heigth,
     tf->height = heigth;
     tf->caret_position = 0;
     tf->caret_offset = 0;
+    tf->caret_time = 0;
     tf->background = UI_TEXTFIELD_BG_COLOR;
     tf->foreground = UI_TEXTFIELD_FG_COLOR;
     tf->caret = UI_TEXTFIELD_CARET_COLOR;
     tf->maxTextLength = max_str_len;
     tf->text = calloc(max_str_len + 1, sizeof (char));
+    if(tf->text == NULL || !Text_initLayout(&tf->layout, max_str_len)) {
+        free(tf->text);
+        free(tf);
+        return NULL;
+    }
+    if(!UI_OBJ_initView(tf, sizeof(TextField_View) + max_str_len + 1)) {
+        Text_destructLayout(&tf->layout);
+        free(tf->text);
+        free(tf);
+        return NULL;
+    }
+    Render_layoutString(&tf->layout, tf->text);
 
     return tf;
 }
@@ -223,6 +277,8 @@ TextField * TextField_create(int x, int y, size_t width, size_t heigth,
 void TextField_destruct(TextField * tf) {
     if(tf != NULL) {
         if(tf->text) free(tf->text);
+        Text_destructLayout(&tf->layout);
+        UI_OBJ_destructView(tf);
         free(tf);
     }
 }
@@ -236,5 +292,7 @@ bool TextField_setText(TextField * tf, const char * const txt) {
         *(tf->text + i) = *(txt + i);
     }
     *(tf->text + i) = 0;
+    Render_layoutString(&tf->layout, tf->text);
+    UI_OBJ_damage(tf);
     return true;
 }
@@ -15,12 +15,14 @@
 #include "../event.h"
 #include "../render.h"
 #include "../engine_object.h"
+#include "../triplebuffer.h"
 #include <stdbool.h>
 
 
 typedef struct {
     //[engine object event]
     const E_Obj_Evts * objEvts;
+    IntrusiveList_Node node;
 
     //[data]
 
@@ -32,6 +34,9 @@ typedef struct {
     GLfloat width;
     GLfloat height;
 
+    //published render state (UI_View)
+    TripleBuffer view;
+
     //data
     Color background;
     Color foreground;
@@ -41,6 +46,7 @@ typedef struct {
     int caret_time;
     size_t maxTextLength;
     char * text;
+    Text_Layout layout;     /** widths of prefixes of text */
 } TextField;
 
 
@@ -1,5 +1,50 @@
 #include "ui_obj.h"
 
+#include "../damage.h"
+
+void UI_OBJ_damage(void * obj) {
+    UI_Obj * uiobj = (UI_Obj*) obj;
+    Damage_markRect(uiobj->position.x - UI_DAMAGE_MARGIN, uiobj->position.y - UI_DAMAGE_MARGIN,
+                    uiobj->width + 2 * UI_DAMAGE_MARGIN, uiobj->height + 2 * UI_DAMAGE_MARGIN);
+}
+
+bool UI_OBJ_initView(void * obj, size_t size) {
+    UI_Obj * uiobj = (UI_Obj*) obj;
+    return TripleBuffer_init(&uiobj->view, size);
+}
+
+void * UI_OBJ_writeView(void * obj) {
+    UI_Obj * uiobj = (UI_Obj*) obj;
+    UI_View * view = TripleBuffer_writeBuffer(&uiobj->view);
+    view->position = uiobj->position;
+    view->width = uiobj->width;
+    view->height = uiobj->height;
+    view->visible = uiobj->events.visible;
+    view->hover = uiobj->events.hover;
+    view->focus = uiobj->events.focus;
+    return view;
+}
+
+void UI_OBJ_publishView(void * obj) {
+    UI_Obj * uiobj = (UI_Obj*) obj;
+    TripleBuffer_publish(&uiobj->view);
+}
+
+void UI_OBJ_publish(void * obj) {
+    UI_OBJ_writeView(obj);
+    UI_OBJ_publishView(obj);
+}
+
+const void * UI_OBJ_view(void * obj) {
+    UI_Obj * uiobj = (UI_Obj*) obj;
+    return TripleBuffer_read(&uiobj->view);
+}
+
+void UI_OBJ_destructView(void * obj) {
+    UI_Obj * uiobj = (UI_Obj*) obj;
+    TripleBuffer_destruct(&uiobj->view);
+}
+
 void UI_OBJ_resize(void * obj, const Event_Resize * evt) {
     UI_Obj * uiobj = (UI_Obj*) obj;
     if(uiobj->events.resizable) {
@@ -17,12 +62,14 @@ void UI_OBJ_mouseMoveEvt(void * obj, SceneData * scene, const Event_Mouse * evt)
     if(evt->x >= 0 && evt->y >= 0) {
         if(IN_RANGE(evt->x, uiobj->position.x, uiobj->position.x + uiobj->width)) {
             if(IN_RANGE(evt->y, uiobj->position.y, uiobj->position.y + uiobj->height)) {
+                if(!uiobj->events.hover) UI_OBJ_damage(uiobj);
                 uiobj->events.hover = true;
                 if(uiobj->events.mouseMovedAction) uiobj->events.mouseMovedAction(uiobj, evt);
                 return;
             }
         }
     }
+    if(uiobj->events.hover) UI_OBJ_damage(uiobj);
     uiobj->events.hover = false;
 }
 
@@ -30,19 +77,28 @@ void UI_OBJ_mouseButtonEvt(void * obj, SceneData * scene, const Event_Mouse * ev
     UI_Obj * uiobj = (UI_Obj*) obj;
     if(!uiobj->events.enabled || !uiobj->events.visible) return;
 
+    bool focus = uiobj->events.focus;
     uiobj->events.focus = false;
     if(evt->x >= 0 && evt->y >= 0) {
         if(IN_RANGE(evt->x, uiobj->position.x, uiobj->position.x + uiobj->width)) {
             if(IN_RANGE(evt->y, uiobj->position.y, uiobj->position.y + uiobj->height)) {
                 uiobj->events.focus = true;
                 if(evt->state == EVT_M_DOWN) {
-                    if(uiobj->events.mousePressAction) uiobj->events.mousePressAction(uiobj, evt);
+                    if(uiobj->events.mousePressAction) {
+                        //action can change any object
+                        Damage_markAll();
+                        uiobj->events.mousePressAction(uiobj, evt);
+                    }
                 } else if(evt->state == EVT_M_UP) {
-                    if(uiobj->events.mouseReleaseAction) uiobj->events.mouseReleaseAction(uiobj, evt);
+                    if(uiobj->events.mouseReleaseAction) {
+                        Damage_markAll();
+                        uiobj->events.mouseReleaseAction(uiobj, evt);
+                    }
                 }
             }
         }
     }
+    if(focus != uiobj->events.focus) UI_OBJ_damage(uiobj);
 }
 
 void UI_OBJ_pressKeyEvt(void * obj, SceneData * scene, const Event_Key * evt) {
@@ -50,7 +106,10 @@ void UI_OBJ_pressKeyEvt(void * obj, SceneData * scene, const Event_Key * evt) {
     if(!uiobj->events.enabled || !uiobj->events.visible) return;
 
     if(uiobj->events.focus) {
-        if(uiobj->events.keyPressedAction) uiobj->events.keyPressedAction(uiobj, evt);
+        if(uiobj->events.keyPressedAction) {
+            Damage_markAll();
+            uiobj->events.keyPressedAction(uiobj, evt);
+        }
     }
 }
 
@@ -59,6 +118,9 @@ void UI_OBJ_releaseKeyEvt(void * obj, SceneData * scene, const Event_Key * evt)
     if(!uiobj->events.enabled || !uiobj->events.visible) return;
 
     if(uiobj->events.focus) {
-        if(uiobj->events.keyPressedAction) uiobj->events.keyPressedAction(uiobj, evt);
+        if(uiobj->events.keyPressedAction) {
+            Damage_markAll();
+            uiobj->events.keyPressedAction(uiobj, evt);
+        }
     }
 }
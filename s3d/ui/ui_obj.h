@@ -4,12 +4,27 @@
 #include "../event.h"
 #include "../render.h"
 #include "../engine_object.h"
+#include "../triplebuffer.h"
 #include <stdbool.h>
 
 
+//margin of damaged rectangle around UI object (borders, smoothed lines)
+#define UI_DAMAGE_MARGIN 2
+
+//render state common to all UI objects, views of UI types start with it
+typedef struct {
+    Point2D position;
+    GLfloat width;
+    GLfloat height;
+    bool visible;
+    bool hover;
+    bool focus;
+} UI_View;
+
 typedef struct {
     //[engine object event]
     const E_Obj_Evts * objEvts;
+    IntrusiveList_Node node;
 
     //[data]
 
@@ -21,11 +36,62 @@ typedef struct {
     GLfloat width;
     GLfloat height;
 
+    //published render state (UI_View), render thread reads only this copy
+    TripleBuffer view;
+
     //data
     void * data;
 } UI_Obj;
 
 
+/**
+ * @brief UI_OBJ_damage Mark bounds of UI object as damaged (damage.h)
+ * @param obj
+ */
+void UI_OBJ_damage(void * obj);
+
+/**
+ * @brief UI_OBJ_initView Init buffers of published render state
+ * @param obj
+ * @param size Size of view of UI type (starts with UI_View)
+ * @return
+ */
+bool UI_OBJ_initView(void * obj, size_t size);
+
+/**
+ * @brief UI_OBJ_writeView View to be published (update thread only), common
+ *        part is already filled, UI type fills rest and calls UI_OBJ_publishView
+ * @param obj
+ * @return
+ */
+void * UI_OBJ_writeView(void * obj);
+
+/**
+ * @brief UI_OBJ_publishView Publish view filled after UI_OBJ_writeView
+ * @param obj
+ */
+void UI_OBJ_publishView(void * obj);
+
+/**
+ * @brief UI_OBJ_publish Publish common render state (update thread only),
+ *        publish event of UI types without own state
+ * @param obj
+ */
+void UI_OBJ_publish(void * obj);
+
+/**
+ * @brief UI_OBJ_view Newest published view (render thread only)
+ * @param obj
+ * @return
+ */
+const void * UI_OBJ_view(void * obj);
+
+/**
+ * @brief UI_OBJ_destructView Free buffers of published render state
+ * @param obj
+ */
+void UI_OBJ_destructView(void * obj);
+
 /**
  * @brief UI_OBJ_resize
  * @param obj
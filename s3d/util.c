@@ -12,6 +12,7 @@
 #include "util.h"
 
 #include <stdlib.h>
+#include "render.h"
 #include <string.h>
 
 
@@ -51,21 +52,22 @@ Texture * UTIL_loadTextureBMP(const char * path, bool rgba_mode) {
 
     // Create a buffer
     data = malloc(sizeof(unsigned char) * texture->imageSize);
+    if(data == NULL) {
+        fclose(file);
+        free(texture);
+        return NULL;
+    }
 
     //read the actual data from the file into the buffer
     fread(data, 1, texture->imageSize, file);
     //everything is in memory now, the file can be closed
     fclose(file);
 
-    //create one OpenGL texture
-    glGenTextures(1, &texture->textureID);
-    //"bind" the newly created texture : all future texture functions will modify this texture
-    glBindTexture(GL_TEXTURE_2D, texture->textureID);
-    //give the image to OpenGL
-    glTexImage2D(GL_TEXTURE_2D, 0, rgba_mode ? GL_RGBA : GL_RGB, texture->width,
-                 texture->height, 0, rgba_mode ? GL_BGRA : GL_BGR, GL_UNSIGNED_BYTE, data);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    //data stays in memory (software backend samples it)
+    texture->data = data;
+    texture->rgba = rgba_mode;
+    texture->textureID = 0;
+    Render_loadTexture(texture);
 
     return texture;
 }
@@ -110,6 +112,8 @@ Texture * UTIL_loadTexturePNG(const char * path) {
     }
 
     Texture * texture = malloc(sizeof(Texture));
+    texture->data = NULL;
+    texture->rgba = true;
 
 
     /*
@@ -156,6 +160,13 @@ struct timespec UTIL_getSystemTime() {
     return ts;
 }
 
+void UTIL_destructTexture(void * texture) {
+    if(texture != NULL) {
+        free(((Texture*) texture)->data);
+        free(texture);
+    }
+}
+
 void UTIL_simpleDestructor(void * data) {
     if(data != NULL) {
         free(data);
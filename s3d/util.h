@@ -35,6 +35,8 @@ typedef struct {
     GLuint height;
     GLuint imageSize;
     GLuint textureID;
+    unsigned char * data;   /** BGR or BGRA, rows from bottom aligned to 4 B */
+    bool rgba;
 } Texture;
 
 
@@ -52,6 +54,12 @@ Texture * UTIL_loadTextureBMP(const char * path, bool rgba_mode);
  */
 Texture * UTIL_loadTexturePNG(const char * path);
 
+/**
+ * @brief Free texture and its data
+ * @param texture
+ */
+void UTIL_destructTexture(void * texture);
+
 /**
  * @brief Generate random number in range from 0 to n
  * @param n The highest possible number
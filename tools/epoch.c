@@ -0,0 +1,137 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    TicTacToe
+ * @author  Martin Krcma
+ * @date    3. 5. 2021
+ * <------------------------------------------------------------------>
+ * @file    epoch.c
+ * @brief   Headless stress check of epoch-based reclamation (s3d/epoch.h)
+ *
+ *          usage: TicTacToeEpoch [-j readers] [-n swaps]
+ *
+ *          Writer replaces shared block and retires the old one inside
+ *          its own critical section (nested retire, as scene dispatch does),
+ *          readers hold the block for a while and check it was not released.
+ *          Exit status 1 -> block was released while a reader held it.
+ * <------------------------------------------------------------------>
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../s3d/epoch.h"
+
+
+#define POOL_SIZE 4096
+
+typedef enum {
+    Block_Free, Block_Live, Block_Retired
+} Block_State;
+
+typedef struct {
+    atomic_int state;
+} Block;
+
+
+static Block pool[POOL_SIZE];
+static _Atomic(Block *) shared;
+static atomic_bool running;
+static atomic_ulong reads;
+static atomic_ulong failures;
+static unsigned long swap_count = 200000;
+
+
+static void releaseBlock(void * ptr) {
+    atomic_store(&((Block*) ptr)->state, Block_Free);
+}
+
+static Block * acquireBlock(void) {
+    for(;;) {
+        for(unsigned int i = 0; i < POOL_SIZE; ++i) {
+            int expected = Block_Free;
+            if(atomic_compare_exchange_strong(&pool[i].state, &expected, Block_Live)) return &pool[i];
+        }
+        //all blocks are waiting for reclamation
+        Epoch_collect();
+    }
+}
+
+static void * reader(void * args) {
+    (void) args;
+    while(atomic_load(&running)) {
+        if(!Epoch_enter()) return NULL;
+        Block * b = atomic_load(&shared);
+        for(int i = 0; i < 64; ++i) {
+            if(atomic_load(&b->state) == Block_Free) {
+                atomic_fetch_add(&failures, 1);
+                break;
+            }
+        }
+        Epoch_exit();
+        atomic_fetch_add(&reads, 1);
+    }
+    return NULL;
+}
+
+static void * collector(void * args) {
+    (void) args;
+    while(atomic_load(&running)) {
+        Epoch_collect();
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    unsigned int reader_count = 4;
+
+    int opt;
+    while((opt = getopt(argc, argv, "j:n:")) != -1) {
+        switch(opt) {
+        case 'j':
+            reader_count = strtoul(optarg, NULL, 10);
+            break;
+        case 'n':
+            swap_count = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-j readers] [-n swaps]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(reader_count == 0) reader_count = 1;
+    if(reader_count > EPOCH_MAX_THREADS - 2) reader_count = EPOCH_MAX_THREADS - 2;
+
+    atomic_store(&running, true);
+    atomic_store(&shared, acquireBlock());
+
+    pthread_t threads[EPOCH_MAX_THREADS];
+    for(unsigned int i = 0; i < reader_count; ++i) {
+        if(pthread_create(&threads[i], NULL, reader, NULL)) return 1;
+    }
+    if(pthread_create(&threads[reader_count], NULL, collector, NULL)) return 1;
+
+    //writer, block is unlinked and retired in critical section
+    for(unsigned long i = 0; i < swap_count; ++i) {
+        if(!Epoch_enter()) return 1;
+        Block * old = atomic_exchange(&shared, acquireBlock());
+        atomic_store(&old->state, Block_Retired);
+        Epoch_retire(old, releaseBlock);
+        Epoch_exit();
+        Epoch_collect();
+    }
+
+    atomic_store(&running, false);
+    for(unsigned int i = 0; i <= reader_count; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    Epoch_destruct();
+
+    unsigned long failed = atomic_load(&failures);
+    printf("swaps=%lu reads=%lu failures=%lu\n", swap_count, atomic_load(&reads), failed);
+    return failed ? 1 : 0;
+}
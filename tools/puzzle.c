@@ -0,0 +1,140 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    TicTacToe
+ * @author  Martin Krcma
+ * @date    29. 4. 2021
+ * <------------------------------------------------------------------>
+ * @file    puzzle.c
+ * @brief   Puzzle files of headless tools
+ * <------------------------------------------------------------------>
+ */
+
+#include "puzzle.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+
+#define LINE_BUFFER_SIZE 1024
+
+
+static bool appendPuzzle(Puzzles * puzzles, char * file, unsigned int line,
+                         const char * rows, unsigned int row_count, unsigned int win_length) {
+    size_t length = strlen(rows);
+    Rules rules = {length / row_count, row_count, win_length};
+    if(!Rules_valid(rules)) {
+        fprintf(stderr, "%s:%u: invalid board size or win length\n", file, line);
+        return false;
+    }
+
+    if(puzzles->count == puzzles->size) {
+        unsigned int size = puzzles->size ? puzzles->size * 2 : 16;
+        Puzzle * data = realloc(puzzles->data, sizeof(Puzzle) * size);
+        if(data == NULL) return false;
+        puzzles->data = data;
+        puzzles->size = size;
+    }
+
+    Puzzle * p = &puzzles->data[puzzles->count];
+    p->data = malloc(sizeof(Symbol) * length);
+    if(p->data == NULL) return false;
+    p->file = file;
+    p->line = line;
+    p->rules = rules;
+
+    unsigned int x_count = 0, o_count = 0;
+    for(size_t i = 0; i < length; ++i) {
+        switch(rows[i]) {
+        case 'x':
+            p->data[i] = Symbol_X;
+            ++x_count;
+            break;
+        case 'o':
+            p->data[i] = Symbol_O;
+            ++o_count;
+            break;
+        default:
+            p->data[i] = Symbol_None;
+            break;
+        }
+    }
+    p->turn = x_count > o_count ? Symbol_O : Symbol_X;
+
+    ++puzzles->count;
+    return true;
+}
+
+bool Puzzles_load(Puzzles * puzzles, char * path, unsigned int win_length) {
+    FILE * file = fopen(path, "r");
+    if(file == NULL) {
+        fprintf(stderr, "%s: file could not be opened\n", path);
+        return false;
+    }
+
+    char line[LINE_BUFFER_SIZE];
+    char * rows = NULL;
+    size_t rows_length = 0;
+    size_t row_width = 0;
+    unsigned int row_count = 0;
+    unsigned int line_number = 0, start = 0;
+    bool status = true;
+
+    while(status) {
+        bool eof = fgets(line, LINE_BUFFER_SIZE, file) == NULL;
+        ++line_number;
+
+        //collect cells of one row
+        char row[LINE_BUFFER_SIZE];
+        size_t row_length = 0;
+        if(!eof && line[0] != '#') {
+            for(char * c = line; *c; ++c) {
+                char lower = tolower((unsigned char) *c);
+                if(lower == 'x' || lower == 'o' || lower == '.' || lower == '-') {
+                    row[row_length++] = lower;
+                }
+            }
+        }
+
+        if(row_length > 0) {
+            if(row_count > 0 && row_length != row_width) {
+                fprintf(stderr, "%s:%u: rows of board have different length\n", path, line_number);
+                status = false;
+                break;
+            }
+            row_width = row_length;
+            char * new_rows = realloc(rows, rows_length + row_length + 1);
+            if(new_rows == NULL) {
+                status = false;
+                break;
+            }
+            rows = new_rows;
+            memcpy(rows + rows_length, row, row_length);
+            rows_length += row_length;
+            rows[rows_length] = 0;
+            if(row_count++ == 0) start = line_number;
+        } else if(row_count > 0 && (eof || line[0] != '#')) {
+            //end of board
+            status = appendPuzzle(puzzles, path, start, rows, row_count, win_length);
+            rows_length = 0;
+            row_count = 0;
+        }
+
+        if(eof) break;
+    }
+
+    if(rows) free(rows);
+    fclose(file);
+    return status;
+}
+
+void Puzzles_destruct(Puzzles * puzzles) {
+    for(unsigned int i = 0; i < puzzles->count; ++i) {
+        free(puzzles->data[i].data);
+    }
+    if(puzzles->data) free(puzzles->data);
+    puzzles->data = NULL;
+    puzzles->count = 0;
+    puzzles->size = 0;
+}
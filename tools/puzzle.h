@@ -0,0 +1,55 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    TicTacToe
+ * @author  Martin Krcma
+ * @date    29. 4. 2021
+ * <------------------------------------------------------------------>
+ * @file    puzzle.h
+ * @brief   Puzzle files of headless tools
+ *
+ *          Puzzle file contains boards separated by empty lines, each board
+ *          is written row by row with '.' (empty), 'x' and 'o', all rows of
+ *          board must have same length. Lines starting with '#' are comments.
+ *          X moves first, side to move is derived from number of symbols on board.
+ * <------------------------------------------------------------------>
+ */
+
+#ifndef PUZZLE_H
+#define PUZZLE_H
+
+#include <stdbool.h>
+#include "../obj/cell.h"
+#include "../obj/rules.h"
+
+
+typedef struct {
+    char * file;
+    unsigned int line;  /** line of file where puzzle starts */
+    Symbol * data;
+    Rules rules;
+    Symbol turn;
+} Puzzle;
+
+typedef struct {
+    Puzzle * data;
+    unsigned int count;
+    unsigned int size;
+} Puzzles;
+
+
+/**
+ * @brief Puzzles_load Append all puzzles of file
+ * @param puzzles
+ * @param path Path of puzzle file (must stay valid while puzzles are used)
+ * @param win_length Win length of loaded puzzles
+ * @return
+ */
+bool Puzzles_load(Puzzles * puzzles, char * path, unsigned int win_length);
+
+/**
+ * @brief Puzzles_destruct Free all loaded puzzles
+ * @param puzzles
+ */
+void Puzzles_destruct(Puzzles * puzzles);
+
+#endif // PUZZLE_H
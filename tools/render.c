@@ -0,0 +1,241 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    TicTacToe
+ * @author  Martin Krcma
+ * @date    29. 4. 2021
+ * <------------------------------------------------------------------>
+ * @file    render.c
+ * @brief   Headless rendering of game scene by software render backend
+ *
+ *          usage: TicTacToeRender [-n frames] [-W width] [-H height]
+ *                                 [-b board_size] [-i background.bmp]
+ *                                 [-o frame.ppm] [-c golden.ppm]
+ *
+ *          Board with stones and game over panel is rendered n times,
+ *          last frame is written as PPM image (-o) or compared with
+ *          golden image (-c, exit status 1 if any pixel differs).
+ * <------------------------------------------------------------------>
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../s3d/core.h"
+#include "../s3d/engine_object.h"
+#include "../s3d/scenestore.h"
+#include "../s3d/rendersoft.h"
+#include "../s3d/ui/colors.h"
+#include "../s3d/ui/button.h"
+#include "../s3d/ui/label.h"
+#include "../s3d/ui/panel.h"
+#include "../s3d/ui/textfield.h"
+#include "../s3d/ui/checkbox.h"
+#include "../s3d/ui/image.h"
+
+#include "../obj/gameboard.h"
+#include "../obj/player.h"
+
+
+static int width = 800;
+static int height = 800;
+static unsigned int board_size = 20;
+
+
+static double currentTime(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static SceneData * createScene(Texture * background) {
+    SceneData * scene = SceneData_create();
+    if(scene == NULL) return NULL;
+
+    if(background != NULL) {
+        E_Obj_insertToScene(scene, (E_Obj*) Image_create(0, 0, width, height, background));
+    }
+
+    size_t size = MIN(width, height) * 0.8;
+    GameBoard * board = GameBoard_create((width - size)/2, (height - size) * 0.8, size,
+                                         (Rules){board_size, board_size, 5}, NULL);
+    if(board == NULL) return NULL;
+    E_Obj_insertToScene(scene, (E_Obj*) board);
+
+    Player * p1 = Player_create("Player1", 3, NULL);
+    Player * p2 = Player_create("Player2", 2, NULL);
+    p1->position.x = (width - size)/2;
+    p2->position.x = (width - size)/2 + size - size/2;
+    p1->position.y = p2->position.y = 10;
+    p1->width = p2->width = size/2;
+    GameBoard_setPlayers(board, p1, p2);
+
+    //same stones on each run (fixed linear congruential sequence)
+    unsigned int seed = 1;
+    Symbol symbol = Symbol_X;
+    for(unsigned int i = 0; i < board_size * board_size / 3; ++i) {
+        seed = seed * 1103515245 + 12345;
+        unsigned int cell = (seed >> 8) % (board_size * board_size);
+        if(GameBoard_turn(board, cell % board_size, cell / board_size, symbol)) {
+            symbol = symbol == Symbol_X ? Symbol_O : Symbol_X;
+        }
+    }
+
+    Panel * panel = Panel_create((width - 360)/2, (height - 360)/2, 360, 300);
+    panel->background = COLOR_CHANGE_OPACITY(UI_PANEL_BG_COLOR, 0.8);
+    E_Obj_insertToScene(scene, (E_Obj*) panel);
+
+    Label * label = Label_create(panel->width/2, 50, "Game Over");
+    label->foreground = COLOR_WHITE;
+    label->centered = true;
+    Panel_insertChild(panel, (E_Obj*) label);
+
+    TextField * field = TextField_create(30, 80, 300, 40, 20);
+    TextField_setText(field, "Player1");
+    Panel_insertChild(panel, (E_Obj*) field);
+
+    Panel_insertChild(panel, (E_Obj*) CheckBox_create(30, 140, 20, true, "Player 1 AI"));
+
+    Button * btn = Button_create((panel->width - 250)/2, 220, 250, 50, "Next game");
+    btn->background = COLOR_CHANGE_OPACITY(UI_BUTTON_BG_COLOR, 0.7);
+    Panel_insertChild(panel, (E_Obj*) btn);
+
+    return scene;
+}
+
+static void renderFrame(SceneData * scene, Event_Render * evt) {
+    Color clear = UI_BG_COLOR;
+    Render_clear(evt, &clear);
+
+    const SceneStore_Array * array = &SceneStore_read(scene->gameData)->dispatch[SceneStore_Render];
+    unsigned int count = SceneStore_count(array);
+    for(unsigned int i = 0; i < count; ++i) {
+        array->data[i].handler.render(array->data[i].obj, evt);
+    }
+    Render_flush();
+}
+
+/**
+ * @brief compare Count pixels of framebuffer different from PPM image
+ * @param path
+ * @return -1 if image can not be read or has different size
+ */
+static long compare(const char * path) {
+    FILE * file = fopen(path, "rb");
+    if(file == NULL) return -1;
+
+    int w, h, max;
+    if(fscanf(file, "P6 %d %d %d", &w, &h, &max) != 3 || fgetc(file) == EOF ||
+            w != width || h != height || max != 255) {
+        fclose(file);
+        return -1;
+    }
+
+    const RenderSoft_Framebuffer * fb = RenderSoft_framebuffer();
+    long diff = 0;
+    unsigned char rgb[3];
+    for(long i = 0; i < (long) w * h; ++i) {
+        if(fread(rgb, 1, 3, file) != 3) {
+            fclose(file);
+            return -1;
+        }
+        uint32_t p = fb->pixels[i];
+        if(rgb[0] != ((p >> 16) & 0xFF) || rgb[1] != ((p >> 8) & 0xFF) || rgb[2] != (p & 0xFF)) ++diff;
+    }
+    fclose(file);
+
+    return diff;
+}
+
+int main(int argc, char **argv) {
+    unsigned int frames = 100;
+    const char * background = NULL;
+    const char * output = NULL;
+    const char * golden = NULL;
+
+    int opt;
+    while((opt = getopt(argc, argv, "n:W:H:b:i:o:c:")) != -1) {
+        switch(opt) {
+        case 'n':
+            frames = strtoul(optarg, NULL, 10);
+            break;
+        case 'W':
+            width = strtol(optarg, NULL, 10);
+            break;
+        case 'H':
+            height = strtol(optarg, NULL, 10);
+            break;
+        case 'b':
+            board_size = strtoul(optarg, NULL, 10);
+            break;
+        case 'i':
+            background = optarg;
+            break;
+        case 'o':
+            output = optarg;
+            break;
+        case 'c':
+            golden = optarg;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n frames] [-W width] [-H height] [-b board_size] "
+                            "[-i background.bmp] [-o frame.ppm] [-c golden.ppm]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(frames == 0) frames = 1;
+    if(width <= 0 || height <= 0 || !Rules_valid((Rules){board_size, board_size, 5})) return 2;
+
+    Render_setBackend(&RENDERSOFT_BACKEND);
+    Render_init();
+    Render_viewport(width, height);
+
+    Texture * texture = NULL;
+    if(background != NULL) {
+        texture = UTIL_loadTextureBMP(background, true);
+        if(texture == NULL) return 1;
+    }
+
+    SceneData * scene = createScene(texture);
+    if(scene == NULL) return 1;
+
+    //render state of objects is published by update thread of engine
+    const SceneStore_Array * array = &SceneStore_read(scene->gameData)->dispatch[SceneStore_Publish];
+    unsigned int count = SceneStore_count(array);
+    for(unsigned int i = 0; i < count; ++i) {
+        array->data[i].handler.publish(array->data[i].obj);
+    }
+
+    Event_Render evt = {.window_width = width, .window_height = height, .sender = NULL};
+    double start = currentTime();
+    for(unsigned int i = 0; i < frames; ++i) {
+        renderFrame(scene, &evt);
+    }
+    double time = currentTime() - start;
+    printf("frames=%u size=%dx%d board=%u time=%.3f ms/frame=%.3f fps=%.1f\n",
+           frames, width, height, board_size, time, time * 1e3 / frames, frames / time);
+
+    int status = 0;
+    if(output != NULL && !RenderSoft_writePPM(output)) {
+        fprintf(stderr, "%s: can not write image\n", output);
+        status = 1;
+    }
+    if(golden != NULL) {
+        long diff = compare(golden);
+        if(diff != 0) {
+            fprintf(stderr, "%s: %s\n", golden, diff < 0 ? "can not read image or size differs" : "differs");
+            if(diff > 0) fprintf(stderr, "%ld pixels differ\n", diff);
+            status = 1;
+        }
+    }
+
+    SceneData_destruct(scene);
+    if(texture != NULL) UTIL_destructTexture(texture);
+    RenderSoft_destruct();
+
+    return status;
+}
@@ -0,0 +1,124 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    TicTacToe
+ * @author  Martin Krcma
+ * @date    29. 4. 2021
+ * <------------------------------------------------------------------>
+ * @file    search.c
+ * @brief   Headless AI search of puzzle files, statistics of every search
+ *          are written as JSON lines
+ *
+ *          usage: TicTacToeSearch [-d depth] [-l time_limit] [-n solver_node_limit]
+ *                                 [-t solver_table_size] [-c eval_cache_size]
+ *                                 [-k win_length] [-R] [-E] file...
+ *
+ *          Format of puzzle files is described in puzzle.h, solver table
+ *          size 0 disables the proof-number solver and cache size 0 the
+ *          evaluation cache, -R disables late move reductions and -E
+ *          extensions of forcing moves.
+ * <------------------------------------------------------------------>
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "../obj/ai.h"
+#include "../obj/solver.h"
+#include "puzzle.h"
+
+
+static unsigned int search_depth = 3;
+static unsigned long node_limit = 20000;
+static unsigned int table_size = SOLVER_DEFAULT_TABLE_SIZE;
+static unsigned int win_length = 5;
+static unsigned int cache_size = AI_DEFAULT_EVAL_CACHE_SIZE;
+static double time_limit = 0.0;
+static bool reductions = true;
+static bool extensions = true;
+
+
+static void searchPuzzle(AI * ai, const Puzzle * p) {
+    unsigned int size = p->rules.width * p->rules.height;
+    Cell * cells = calloc(size, sizeof(Cell));
+    if(cells == NULL) return;
+    for(unsigned int i = 0; i < size; ++i) {
+        cells[i].symbol = p->data[i];
+    }
+
+    AI_refeshGameData(ai, cells, p->rules, p->turn);
+    Node move = AI_doTurn(ai);
+    free(cells);
+
+    printf("{\"file\":\"%s\",\"line\":%u,\"turn\":\"%c\",\"move\":[%d,%d],\"stats\":",
+           p->file, p->line, p->turn == Symbol_X ? 'x' : 'o', move.x, move.y);
+    const AI_Stats * stats = AI_getStats(ai);
+    if(stats != NULL) {
+        AI_Stats_writeJSON(stats, stdout);
+    } else {
+        printf("null");
+    }
+    printf("}\n");
+}
+
+int main(int argc, char **argv) {
+    int opt;
+    while((opt = getopt(argc, argv, "d:l:n:t:c:k:RE")) != -1) {
+        switch(opt) {
+        case 'd':
+            search_depth = strtoul(optarg, NULL, 10);
+            break;
+        case 'n':
+            node_limit = strtoul(optarg, NULL, 10);
+            break;
+        case 't':
+            table_size = strtoul(optarg, NULL, 10);
+            break;
+        case 'c':
+            cache_size = strtoul(optarg, NULL, 10);
+            break;
+        case 'k':
+            win_length = strtoul(optarg, NULL, 10);
+            break;
+        case 'l':
+            time_limit = strtod(optarg, NULL);
+            break;
+        case 'R':
+            reductions = false;
+            break;
+        case 'E':
+            extensions = false;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-d depth] [-l time_limit] [-n solver_node_limit] [-t solver_table_size] [-c eval_cache_size] [-k win_length] [-R] [-E] file...\n", argv[0]);
+            return 2;
+        }
+    }
+    if(optind >= argc) {
+        fprintf(stderr, "usage: %s [-d depth] [-l time_limit] [-n solver_node_limit] [-t solver_table_size] [-c eval_cache_size] [-k win_length] [-R] [-E] file...\n", argv[0]);
+        return 2;
+    }
+
+    Puzzles puzzles = {NULL, 0, 0};
+    for(int i = optind; i < argc; ++i) {
+        if(!Puzzles_load(&puzzles, argv[i], win_length)) return 1;
+    }
+
+    AI * ai = AI_create(search_depth, cache_size);
+    if(ai == NULL) return 1;
+    if(!AI_setSolver(ai, table_size, node_limit)) return 1;
+    AI_setSelectiveSearch(ai, reductions, extensions);
+    AI_setTimeLimit(ai, time_limit);
+
+    for(unsigned int i = 0; i < puzzles.count; ++i) {
+        searchPuzzle(ai, &puzzles.data[i]);
+    }
+    fprintf(stderr, "evaluation cache hit rate: %.1f %%\n", AI_getEvalCacheHitRate(ai) * 100.0);
+
+    AI_destruct(ai);
+    Puzzles_destruct(&puzzles);
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * <------------------------------------------------------------------>
+ * @name    TicTacToe
+ * @author  Martin Krcma
+ * @date    29. 4. 2021
+ * <------------------------------------------------------------------>
+ * @file    solve.c
+ * @brief   Headless batch solver of puzzle files
+ *
+ *          usage: TicTacToeSolve [-j threads] [-n node_limit] [-t table_size]
+ *                                [-k win_length] [-J] file...
+ *
+ *          Format of puzzle files is described in puzzle.h, with -J results
+ *          are written as JSON lines.
+ * <------------------------------------------------------------------>
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../obj/solver.h"
+#include "puzzle.h"
+
+
+typedef struct {
+    Puzzles puzzles;
+    Solver_Solution * solutions;
+    double * times;     /** seconds spent by solving of each puzzle */
+} Batch;
+
+
+static atomic_uint next_puzzle;
+static atomic_bool failed;
+static unsigned long node_limit = 1000000;
+static unsigned int table_size = SOLVER_DEFAULT_TABLE_SIZE * 4;
+static unsigned int win_length = 5;
+static bool json = false;
+
+
+static double currentTime(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void * worker(void * args) {
+    Batch * batch = (Batch*) args;
+
+    Solver * solver = Solver_create(table_size);
+    if(solver == NULL) {
+        fprintf(stderr, "failed to create solver with table size %u\n", table_size);
+        atomic_store(&failed, true);
+        return NULL;
+    }
+
+    unsigned int index;
+    while((index = atomic_fetch_add(&next_puzzle, 1)) < batch->puzzles.count) {
+        Puzzle * p = &batch->puzzles.data[index];
+        double start = currentTime();
+        Solver_solve(solver, p->data, p->rules, p->turn, node_limit, &batch->solutions[index]);
+        batch->times[index] = currentTime() - start;
+    }
+
+    Solver_destruct(solver);
+    return NULL;
+}
+
+static const char * RESULT[] = {"unknown", "win", "notwin"};
+
+static void printPuzzle(const Puzzle * p, const Solver_Solution * solution) {
+    printf("%s:%u %c %s nodes=%lu", p->file, p->line, p->turn == Symbol_X ? 'x' : 'o',
+           RESULT[solution->result], solution->nodes);
+    if(solution->result == Solver_Win) {
+        printf(" line=");
+        for(unsigned int i = 0; i < solution->line_length; ++i) {
+            printf("%s%d,%d", i ? ";" : "", solution->line[i].x, solution->line[i].y);
+        }
+    }
+    printf("\n");
+}
+
+static void printPuzzleJSON(const Puzzle * p, const Solver_Solution * solution, double time) {
+    printf("{\"file\":\"%s\",\"line\":%u,\"turn\":\"%c\",\"result\":\"%s\",\"nodes\":%lu,"
+           "\"tt_probes\":%lu,\"tt_hits\":%lu,\"time\":%.6f,\"pv\":[",
+           p->file, p->line, p->turn == Symbol_X ? 'x' : 'o', RESULT[solution->result],
+           solution->nodes, solution->probes, solution->hits, time);
+    for(unsigned int i = 0; i < solution->line_length; ++i) {
+        printf("%s[%d,%d]", i ? "," : "", solution->line[i].x, solution->line[i].y);
+    }
+    printf("]}\n");
+}
+
+int main(int argc, char **argv) {
+    unsigned int thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    int opt;
+    while((opt = getopt(argc, argv, "j:n:t:k:J")) != -1) {
+        switch(opt) {
+        case 'j':
+            thread_count = strtoul(optarg, NULL, 10);
+            break;
+        case 'n':
+            node_limit = strtoul(optarg, NULL, 10);
+            break;
+        case 't':
+            table_size = strtoul(optarg, NULL, 10);
+            break;
+        case 'k':
+            win_length = strtoul(optarg, NULL, 10);
+            break;
+        case 'J':
+            json = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-j threads] [-n node_limit] [-t table_size] [-k win_length] [-J] file...\n", argv[0]);
+            return 2;
+        }
+    }
+    if(optind >= argc) {
+        fprintf(stderr, "usage: %s [-j threads] [-n node_limit] [-t table_size] [-k win_length] [-J] file...\n", argv[0]);
+        return 2;
+    }
+    if(thread_count == 0) thread_count = 1;
+
+    Batch batch = {{NULL, 0, 0}, NULL, NULL};
+    for(int i = optind; i < argc; ++i) {
+        if(!Puzzles_load(&batch.puzzles, argv[i], win_length)) return 1;
+    }
+    if(thread_count > batch.puzzles.count) thread_count = batch.puzzles.count ? batch.puzzles.count : 1;
+
+    batch.solutions = calloc(batch.puzzles.count + 1, sizeof(Solver_Solution));
+    batch.times = calloc(batch.puzzles.count + 1, sizeof(double));
+    if(batch.solutions == NULL || batch.times == NULL) return 1;
+
+    pthread_t * threads = malloc(sizeof(pthread_t) * thread_count);
+    if(threads == NULL) return 1;
+    atomic_init(&next_puzzle, 0);
+    atomic_init(&failed, false);
+    for(unsigned int i = 0; i < thread_count; ++i) {
+        if(pthread_create(&threads[i], NULL, worker, &batch)) return 1;
+    }
+    for(unsigned int i = 0; i < thread_count; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    //puzzles of failed worker could be solved by others, results would be incomplete
+    if(atomic_load(&failed)) return 1;
+
+    for(unsigned int i = 0; i < batch.puzzles.count; ++i) {
+        if(json) {
+            printPuzzleJSON(&batch.puzzles.data[i], &batch.solutions[i], batch.times[i]);
+        } else {
+            printPuzzle(&batch.puzzles.data[i], &batch.solutions[i]);
+        }
+    }
+    free(batch.solutions);
+    free(batch.times);
+    Puzzles_destruct(&batch.puzzles);
+
+    return 0;
+}